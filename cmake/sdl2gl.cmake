@@ -1,4 +1,6 @@
 # CMake setup used for SDL2 Builds.
+# The OpenGL renderer requires OpenGL 3.3 (core profile). Without it, the SDL2
+# surface renderer is used instead.
 
 set(lib_base /usr/include)
 set(sdl_root ${lib_base}/SDL2)
@@ -0,0 +1,122 @@
+/***************************************************************************
+    Audio Buffer Statistics.
+
+    Records the health of the audio output buffer, so that the buffer 
+    size and target latency can be tuned for a particular machine.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <sstream>
+#include "audiostats.hpp"
+
+AudioStats::AudioStats()
+{
+    reset(44100, 0);
+}
+
+AudioStats::~AudioStats()
+{
+}
+
+void AudioStats::reset(uint32_t freq, uint32_t device_samples)
+{
+    this->freq           = freq;
+    this->device_samples = device_samples;
+
+    callbacks         = 0;
+    underflows        = 0;
+    underflow_samples = 0;
+    frames            = 0;
+    overflow_frames   = 0;
+    overflow_waits    = 0;
+    fill_min          = 0;
+    fill_max          = 0;
+    fill_total        = 0;
+    latency           = 0;
+    latency_max       = 0;
+    latency_total     = 0;
+
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        hist[i] = 0;
+}
+
+// Called from the audio callback, with the audio lock held.
+//
+// fill:      Samples available in the buffer when the callback ran
+// underflow: Samples the callback had to repeat because the buffer ran dry
+void AudioStats::record_callback(int32_t fill, int32_t underflow)
+{
+    if (fill < 0)
+        fill = 0;
+
+    if (callbacks == 0 || fill < fill_min) fill_min = fill;
+    if (callbacks == 0 || fill > fill_max) fill_max = fill;
+    fill_total += fill;
+    callbacks++;
+
+    int bucket = to_ms(fill) / HIST_MS;
+    if (bucket >= HIST_BUCKETS)
+        bucket = HIST_BUCKETS - 1;
+    hist[bucket]++;
+
+    if (underflow > 0)
+    {
+        underflows++;
+        underflow_samples += underflow;
+    }
+}
+
+// Called once per emulated frame, with the audio lock held.
+//
+// fill_est: Estimated samples still buffered, ahead of the new frame being written
+// waits:    Number of 1ms waits for space in the buffer
+void AudioStats::record_frame(int32_t fill_est, uint32_t waits)
+{
+    if (fill_est < 0)
+        fill_est = 0;
+
+    latency = fill_est + device_samples;
+    if (latency > latency_max)
+        latency_max = latency;
+    latency_total += latency;
+    frames++;
+
+    if (waits)
+    {
+        overflow_frames++;
+        overflow_waits += waits;
+    }
+}
+
+int32_t AudioStats::to_ms(int64_t samples) const
+{
+    return (int32_t) ((samples * 1000) / freq);
+}
+
+int32_t AudioStats::fill_avg() const
+{
+    return callbacks ? (int32_t) (fill_total / callbacks) : 0;
+}
+
+int32_t AudioStats::latency_avg() const
+{
+    return frames ? (int32_t) (latency_total / frames) : 0;
+}
+
+// Single line summary for logging
+std::string AudioStats::to_string() const
+{
+    std::stringstream ss;
+    ss << "Audio: fill avg "  << to_ms(fill_avg()) << "ms min " << to_ms(fill_min) << "ms max " << to_ms(fill_max) << "ms"
+       << ", latency avg "    << to_ms(latency_avg()) << "ms max " << to_ms(latency_max) << "ms"
+       << ", underflows "     << underflows << " (" << underflow_samples << " samples)"
+       << ", overflows "      << overflow_frames << "/" << frames << " frames (" << overflow_waits << "ms waiting)"
+       << ", fill histogram";
+
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        ss << " " << (i * HIST_MS) << (i == HIST_BUCKETS - 1 ? "+" : "") << ":" << hist[i];
+
+    return ss.str();
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+    Audio Buffer Statistics.
+
+    Records the health of the audio output buffer, so that the buffer 
+    size and target latency can be tuned for a particular machine.
+
+    - Buffer fill each time the audio callback runs, with a histogram.
+    - Underflows: samples the callback had to pad by repeating the last
+      sample, because the emulation hadn't produced enough.
+    - Overflows: frames where the emulation had to wait for the callback
+      to drain the buffer before it could write.
+    - Estimated output latency: buffered samples plus the device buffer.
+
+    All values are stored in sample frames (one sample per channel).
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include <string>
+#include "stdint.hpp"
+
+class AudioStats
+{
+public:
+    // Histogram of buffer fill at callback time. 
+    // Each bucket covers HIST_MS milliseconds. The last bucket also holds anything larger.
+    static const int HIST_BUCKETS = 12;
+    static const int HIST_MS      = 5;
+
+    // Number of audio callbacks
+    uint32_t callbacks;
+
+    // Callbacks that ran out of data, and the total number of samples repeated to cover them
+    uint32_t underflows;
+    uint32_t underflow_samples;
+
+    // Number of frames written, frames which had to wait for space, and total 1ms waits
+    uint32_t frames;
+    uint32_t overflow_frames;
+    uint32_t overflow_waits;
+
+    // Buffer fill at callback time
+    int32_t fill_min;
+    int32_t fill_max;
+    uint32_t hist[HIST_BUCKETS];
+
+    // Estimated output latency, updated every frame
+    int32_t latency;
+    int32_t latency_max;
+
+    AudioStats();
+    ~AudioStats();
+
+    void reset(uint32_t freq, uint32_t device_samples);
+    void record_callback(int32_t fill, int32_t underflow);
+    void record_frame(int32_t fill_est, uint32_t waits);
+
+    int32_t to_ms(int64_t samples) const;
+    int32_t fill_avg() const;
+    int32_t latency_avg() const;
+
+    std::string to_string() const;
+
+private:
+    // Output sample rate
+    uint32_t freq;
+
+    // Size of the device buffer, which adds to the latency
+    uint32_t device_samples;
+
+    uint64_t fill_total;
+    uint64_t latency_total;
+};
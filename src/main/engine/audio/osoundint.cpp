@@ -12,6 +12,7 @@
 #include "engine/outrun.hpp"
 #include "engine/audio/osound.hpp"
 #include "engine/audio/osoundint.hpp"
+#include "enginesnapshot.hpp"
 
 OSoundInt osoundint;
 OSound osound;
@@ -50,6 +51,21 @@ void OSoundInt::init()
     osound.init(ym, pcm_ram);
 }
 
+// Register the sound program and chips with an engine snapshot.
+// The chips only exist once init() has been called.
+void OSoundInt::register_state(EngineSnapshot& snapshot)
+{
+    snapshot.add(this,    sizeof(OSoundInt));
+    snapshot.add(pcm_ram, PCM_RAM_SIZE);
+    snapshot.add(&osound, sizeof(OSound));
+
+    if (pcm != NULL)
+        pcm->register_state(snapshot);
+
+    if (ym != NULL)
+        ym->register_state(snapshot);
+}
+
 // Clear sound queue
 // Source: 0x5086
 void OSoundInt::reset()
@@ -15,6 +15,8 @@
 #include "hwaudio/ym2151.hpp"
 #include "engine/audio/commands.hpp"
 
+class EngineSnapshot;
+
 class OSoundInt
 {
 public:
@@ -51,6 +53,8 @@ public:
     void queue_sound(uint8_t snd);
     void queue_clear();
 
+    void register_state(EngineSnapshot&);
+
 private:
     // 4 MHz
     static const uint32_t SOUND_CLOCK = 4000000;
@@ -141,7 +141,7 @@ void OAnimSeq::flag_seq()
         {
             uint32_t index = anim_flag.anim_addr_curr + (anim_flag.anim_frame << 3);
 
-            anim_flag.sprite->addr    = roms.rom0p->read32(index) & 0xFFFFF;
+            anim_flag.sprite->addr    = roms.rom0p->read32_aligned(index) & 0xFFFFF;
             anim_flag.sprite->pal_src = roms.rom0p->read8(index);
 
 	        uint32_t addr = SPRITE_ZOOM_LOOKUP + (((anim_flag.sprite->z >> 16) << 2) | osprites.sprite_scroll_speed);
@@ -250,11 +250,11 @@ void OAnimSeq::anim_seq_intro(oanimsprite* anim)
 
         uint32_t index              = anim->anim_addr_curr + (anim->anim_frame << 3);
 
-        anim->sprite->addr          = roms.rom0p->read32(index) & 0xFFFFF;
+        anim->sprite->addr          = roms.rom0p->read32_aligned(index) & 0xFFFFF;
         anim->sprite->pal_src       = roms.rom0p->read8(index);
         anim->sprite->zoom          = 0x7F;
         anim->sprite->road_priority = 0x1FE;
-        anim->sprite->priority      = 0x1FE - ((roms.rom0p->read16(index) & 0x70) >> 4);
+        anim->sprite->priority      = 0x1FE - ((roms.rom0p->read16_aligned(index) & 0x70) >> 4);
 
         // Set X
         int16_t sprite_x = (int8_t) roms.rom0p->read8(4 + index);
@@ -533,11 +533,11 @@ void OAnimSeq::anim_seq_outro(oanimsprite* anim)
         // Process Animation Data
         uint32_t index = anim->anim_addr_curr + (anim->anim_frame << 3);
 
-        anim->sprite->addr          = roms.rom0p->read32(index) & 0xFFFFF;
+        anim->sprite->addr          = roms.rom0p->read32_aligned(index) & 0xFFFFF;
         anim->sprite->pal_src       = roms.rom0p->read8(index);
         anim->sprite->zoom          = roms.rom0p->read8(6 + index) >> 1;
         anim->sprite->road_priority = roms.rom0p->read8(6 + index) << 1;
-        anim->sprite->priority      = anim->sprite->road_priority - ((roms.rom0p->read16(index) & 0x70) >> 4); // (bits 4-6)
+        anim->sprite->priority      = anim->sprite->road_priority - ((roms.rom0p->read16_aligned(index) & 0x70) >> 4); // (bits 4-6)
         anim->sprite->x             = (roms.rom0p->read8(4 + index) * anim->sprite->priority) >> 9;
     
         if (roms.rom0p->read8(1 + index) & BIT_7)
@@ -686,8 +686,8 @@ bool OAnimSeq::read_anim_data(oanimsprite* anim)
             if (end_seq >= 2)
                 anim->sprite->shadow = 7;
 
-            anim->anim_addr_curr = roms.rom0p->read32(outrun.adr.anim_endseq_obj8 + (end_seq << 3));
-            anim->anim_addr_next = roms.rom0p->read32(outrun.adr.anim_endseq_obj8 + (end_seq << 3) + 4);
+            anim->anim_addr_curr = roms.rom0p->read32_aligned(outrun.adr.anim_endseq_obj8 + (end_seq << 3));
+            anim->anim_addr_next = roms.rom0p->read32_aligned(outrun.adr.anim_endseq_obj8 + (end_seq << 3) + 4);
             anim->anim_frame = 0;
             return DO_NOTHING;
         }
@@ -698,8 +698,8 @@ bool OAnimSeq::read_anim_data(oanimsprite* anim)
             if (end_seq >= 2)
                 anim->sprite->shadow = 7;
 
-            anim->anim_addr_curr = roms.rom0p->read32(outrun.adr.anim_endseq_objA + (end_seq << 3));
-            anim->anim_addr_next = roms.rom0p->read32(outrun.adr.anim_endseq_objA + (end_seq << 3) + 4);
+            anim->anim_addr_curr = roms.rom0p->read32_aligned(outrun.adr.anim_endseq_objA + (end_seq << 3));
+            anim->anim_addr_next = roms.rom0p->read32_aligned(outrun.adr.anim_endseq_objA + (end_seq << 3) + 4);
             anim->anim_frame = 0;
             return DO_NOTHING;
         }
@@ -370,7 +370,7 @@ void OCrash::do_collision()
     spr_ferrari->zoom = 0x80;
     spr_ferrari->priority = 0x1FD;
     oinitengine.car_x_pos -= slide;
-    spr_ferrari->addr = roms.rom0p->read32(property_table);
+    spr_ferrari->addr = roms.rom0p->read32_aligned(property_table);
 
     if (roms.rom0p->read8(4 + property_table))
         spr_ferrari->control |= OSprites::HFLIP;
@@ -513,7 +513,7 @@ void OCrash::do_bump()
     spr_ferrari->y = 221 - (new_position >> shift);
 
     uint32_t frames = addr + (frame << 3);
-    spr_ferrari->addr = roms.rom0p->read32(frames);
+    spr_ferrari->addr = roms.rom0p->read32_aligned(frames);
     
     if (roms.rom0p->read8(frames + 4))
         spr_ferrari->control |= OSprites::HFLIP;
@@ -526,7 +526,7 @@ void OCrash::do_bump()
     if (++lookup_index >= 0x10)
     {
         addr += (frame_restore << 3);
-        spr_ferrari->addr = roms.rom0p->read32(addr);
+        spr_ferrari->addr = roms.rom0p->read32_aligned(addr);
         spin_pass_frame = (int8_t) roms.rom0p->read8(addr + 6);
         crash_state = 4;      // Trigger smoke cloud
         crash_spin_count = 1; // Denote Crash
@@ -590,7 +590,7 @@ void OCrash::do_car_flip()
     // flip_cont
     olevelobjs.collision_sprite = 0; // Moved this for clarity
     uint32_t frames = addr + (frame << 3);
-    spr_ferrari->addr = roms.rom0p->read32(frames);
+    spr_ferrari->addr = roms.rom0p->read32_aligned(frames);
 
     // ------------------------------------------------------------------------
     // Fast Crash: Car Heads towards camera in sky, before vanishing (0x161E)
@@ -739,7 +739,7 @@ void OCrash::trigger_smoke()
     // Slide Car
     oinitengine.car_x_pos -= slide_copy;
 
-    spr_ferrari->addr = roms.rom0p->read32(addr);
+    spr_ferrari->addr = roms.rom0p->read32_aligned(addr);
 
     // Set Ferrari H-Flip
     if (roms.rom0p->read8(4 + addr))
@@ -1133,7 +1133,7 @@ void OCrash::crash_pass1(oentry* sprite)
 {
     uint32_t frames = (sprite == spr_pass1 ? outrun.adr.sprite_crash_man1 : outrun.adr.sprite_crash_girl1) + (spin_pass_frame << 3);
     
-    sprite->addr    = roms.rom0p->read32(frames);
+    sprite->addr    = roms.rom0p->read32_aligned(frames);
     uint8_t props   = roms.rom0p->read8(4 + frames);
     sprite->pal_src = roms.rom0p->read8(5 + frames);
     sprite->x       = spr_ferrari->x + (int8_t) roms.rom0p->read8(6 + frames);
@@ -1174,7 +1174,7 @@ void OCrash::crash_pass2(oentry* sprite)
     // Use crash_delay to toggle between two distinct frames
     frames += ((coll_count2 & 3) << 4) + (crash_delay & 8);
     
-    sprite->addr    = roms.rom0p->read32(frames);
+    sprite->addr    = roms.rom0p->read32_aligned(frames);
     uint8_t props   = roms.rom0p->read8(4 + frames);
     sprite->pal_src = roms.rom0p->read8(5 + frames);
     sprite->x       = spr_ferrari->x + (int8_t) roms.rom0p->read8(6 + frames);
@@ -1340,7 +1340,7 @@ void OCrash::pass_flip(oentry* sprite)
     sprite->zoom = (uint8_t) zoom;
 
     uint32_t frames = sprite->z + (sprite->xw1 << 3);
-    sprite->addr = roms.rom0p->read32(frames);
+    sprite->addr = roms.rom0p->read32_aligned(frames);
 
     uint16_t offset = sprite->counter > 0x1FF ? 0x1FF : sprite->counter;
     int16_t y_change = (((int8_t) roms.rom0p->read8(6 + frames)) * offset) >> 9; // d1
@@ -1398,7 +1398,7 @@ void OCrash::pass_situp(oentry* sprite)
     sprite->x += x_diff;
 
     uint32_t frames = sprite->z + (sprite->xw1 << 3);
-    sprite->addr    = roms.rom0p->read32(frames);
+    sprite->addr    = roms.rom0p->read32_aligned(frames);
     sprite->pal_src = roms.rom0p->read8(4 + frames);
 
     // Decrement frame delay counter
@@ -1432,7 +1432,7 @@ void OCrash::pass_turnhead(oentry* sprite)
     sprite->x += x_diff;
 
     uint32_t frames = sprite->z + (sprite->xw1 << 3);
-    sprite->addr    = roms.rom0p->read32(frames);
+    sprite->addr    = roms.rom0p->read32_aligned(frames);
     sprite->pal_src = roms.rom0p->read8(4 + frames);
 
     // End of animation sequence.
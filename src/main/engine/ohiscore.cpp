@@ -585,9 +585,7 @@ void OHiScore::setup_minicars_pal(minicar_entry* minicar)
 void OHiScore::blit_score_table()
 {
     // Clear tile table ready for High Score Display
-    uint32_t tile_addr = 0x10E000; // Tile Table 15
-    for (int i = 0; i <= 0x3FF; i++)
-        video.write_tile32(&tile_addr, 0x200020);
+    video.fill_tile32(0x10E000, 0x200020, 0x400); // Tile Table 15
 
     ohud.blit_text2(TEXT2_BEST_OR);   // Print "BEST OUTRUNNERS"
     ohud.blit_text1(TEXT1_SCORE_ETC); // Print Score, Name, Route, Record
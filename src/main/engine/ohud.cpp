@@ -76,10 +76,59 @@ void OHud::clear_timetrial_text()
     blit_text_new(16, 7, "            ");
 }
 
-void OHud::draw_fps_counter(int16_t fps)
+// Frames drawn per second. Frames skipped per second are shown below, when frameskip is enabled.
+void OHud::draw_fps_counter(int16_t fps, int16_t skipped)
 {
     std::string str = "FPS " + Utils::to_string(fps);
     blit_text_new(30, 0, str.c_str());
+
+    if (config.video.frameskip)
+    {
+        str = "SKIP " + Utils::to_string(skipped);
+        str.resize(10, ' ');
+        blit_text_new(30, 2, str.c_str());
+    }
+}
+
+// Speed in turbo mode, as a multiple of real time. 0 clears the text.
+void OHud::draw_turbo(int16_t speed)
+{
+    std::string str = speed ? "TURBO " + Utils::to_string(speed) + "X" : "";
+    str.resize(10, ' ');
+    blit_text_new(30, 1, str.c_str());
+}
+
+// Audio buffer statistics. Times are in milliseconds.
+void OHud::draw_audio_stats(const AudioStats& stats)
+{
+    const int WIDTH = 26;
+    std::string lines[5];
+
+    lines[0] = "FILL "      + Utils::to_string(stats.to_ms(stats.fill_avg())) +
+               " MIN "      + Utils::to_string(stats.to_ms(stats.fill_min)) +
+               " MAX "      + Utils::to_string(stats.to_ms(stats.fill_max));
+    lines[1] = "LATENCY "   + Utils::to_string(stats.to_ms(stats.latency)) +
+               " MAX "      + Utils::to_string(stats.to_ms(stats.latency_max));
+    lines[2] = "UNDERFLOW " + Utils::to_string((int) stats.underflows) +
+               " SMP "      + Utils::to_string((int) stats.underflow_samples);
+    lines[3] = "OVERFLOW "  + Utils::to_string((int) stats.overflow_frames) +
+               " WAIT "     + Utils::to_string((int) stats.overflow_waits);
+
+    // Fill histogram, with each bucket scaled from 0 to 9
+    uint32_t peak = 1;
+    for (int i = 0; i < AudioStats::HIST_BUCKETS; i++)
+        if (stats.hist[i] > peak) peak = stats.hist[i];
+
+    lines[4] = "HIST ";
+    for (int i = 0; i < AudioStats::HIST_BUCKETS; i++)
+        lines[4] += (char) ('0' + (stats.hist[i] * 9 + peak - 1) / peak);
+
+    // Pad, to clear previous values
+    for (int i = 0; i < 5; i++)
+    {
+        lines[i].resize(WIDTH, ' ');
+        blit_text_new(1, 6 + i, lines[i].c_str());
+    }
 }
 
 
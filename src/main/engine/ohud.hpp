@@ -14,6 +14,7 @@
 #pragma once
 
 #include "outrun.hpp"
+#include "audiostats.hpp"
 
 class OHud
 {
@@ -34,7 +35,9 @@ public:
     ~OHud(void);
 
     void draw_main_hud();
-    void draw_fps_counter(int16_t);
+    void draw_fps_counter(int16_t, int16_t);
+    void draw_turbo(int16_t);
+    void draw_audio_stats(const AudioStats&);
     void clear_timetrial_text();
     void do_mini_map();
     void draw_timer1(uint16_t);
@@ -67,7 +67,7 @@ void OLevelObjs::init_entries(uint32_t a4, const uint8_t start_index, const uint
         sprite->shadow     = roms.rom0p->read8(&a4);
         sprite->pal_src    = roms.rom0p->read8(&a4);
         sprite->type       = roms.rom0p->read16(&a4);
-        sprite->addr       = roms.rom0p->read32(outrun.adr.sprite_type_table + sprite->type);
+        sprite->addr       = roms.rom0p->read32_aligned(outrun.adr.sprite_type_table + sprite->type);
         sprite->xw1        = 
         sprite->xw2        = roms.rom0p->read16(&a4);
         sprite->yw         = roms.rom0p->read16(&a4);
@@ -163,7 +163,7 @@ void OLevelObjs::setup_sprite(oentry* sprite, uint32_t z)
     sprite->xw2     = READ8(addr + 1) << 4;
     sprite->yw      = READ16(addr + 2) << 7;
     sprite->type    = ((uint8_t) READ8 (addr + 5)) << 2;
-    sprite->addr    = roms.rom0p->read32(outrun.adr.sprite_type_table + sprite->type);
+    sprite->addr    = roms.rom0p->read32_aligned(outrun.adr.sprite_type_table + sprite->type);
 
     sprite->pal_src = READ8 (addr + 7);
     
@@ -742,7 +742,7 @@ void OLevelObjs::sprite_minitree(oentry* sprite)
     {
         // don't choose a custom frame
         sprite->zoom = (uint8_t) z; // Set Entry Number For Zoom Lookup Table
-        sprite->addr = roms.rom0p->read32(outrun.adr.sprite_minitree); // Set to first frame in table
+        sprite->addr = roms.rom0p->read32_aligned(outrun.adr.sprite_minitree); // Set to first frame in table
     }
     // Use Table to alter sprite based on its y position.
     //
@@ -756,7 +756,7 @@ void OLevelObjs::sprite_minitree(oentry* sprite)
         z <<= 1; // Note we can't use original z16, so don't try to optimize this
         uint8_t offset = roms.rom0.read8(MAP_Y_TO_FRAME + z);
         sprite->zoom = roms.rom0.read8(MAP_Y_TO_FRAME + z + 1);
-        sprite->addr = roms.rom0p->read32(outrun.adr.sprite_minitree + offset);
+        sprite->addr = roms.rom0p->read32_aligned(outrun.adr.sprite_minitree + offset);
     }
     // order_sprites
     osprites.do_spr_order_shadows(sprite);
@@ -875,14 +875,14 @@ void OLevelObjs::sprite_clouds(oentry* sprite)
     {
         // 421c
         sprite->zoom = (uint8_t) z; // Set Entry Number For Zoom Lookup Table
-        sprite->addr = roms.rom0p->read32(outrun.adr.sprite_cloud);
+        sprite->addr = roms.rom0p->read32_aligned(outrun.adr.sprite_cloud);
     }
     else
     {
         // 41f8
         z <<= 1;
         uint8_t lookup_z = roms.rom0.read8(MOVEMENT_LOOKUP_Z + z);
-        sprite->addr = roms.rom0p->read32(outrun.adr.sprite_cloud + lookup_z);
+        sprite->addr = roms.rom0p->read32_aligned(outrun.adr.sprite_cloud + lookup_z);
         sprite->zoom = roms.rom0.read8(MOVEMENT_LOOKUP_Z + z + 1);
     }
     // end
@@ -932,14 +932,14 @@ void OLevelObjs::do_thickness_sprite(oentry* sprite, const uint32_t sprite_table
     {
         //use_large_frame (don't choose a custom frame)
         sprite->zoom = (uint8_t) z; // Set Entry Number For Zoom Lookup Table
-        sprite->addr = roms.rom0p->read32(0x3C + sprite_table_address); // Set default frame for larger sprite
+        sprite->addr = roms.rom0p->read32_aligned(0x3C + sprite_table_address); // Set default frame for larger sprite
     }
     else
     {
         // use custom frame for sprite
         sprite->zoom = 0x80; // cap sprite_z minimum to 0x80
         z = (z >> 1) & 0x3C; // Mask over lower 2 bits, so the frame aligns to a word
-        sprite->addr = roms.rom0p->read32(z + sprite_table_address); // Set Frame Data Based On Zoom Value
+        sprite->addr = roms.rom0p->read32_aligned(z + sprite_table_address); // Set Frame Data Based On Zoom Value
     }
     // order_sprites
     osprites.do_spr_order_shadows(sprite);
@@ -351,7 +351,7 @@ void OMap::draw_piece(oentry* sprite, uint32_t adr)
 
         adr += (map_pos << 3);
 
-        sprite->addr    = roms.rom0p->read32(adr);
+        sprite->addr    = roms.rom0p->read32_aligned(adr);
         sprite->pal_src = roms.rom0p->read8(4 + adr);
         osprites.map_palette(sprite);
     }
@@ -372,8 +372,8 @@ void OMap::move_mini_car(oentry* sprite)
         int16_t pos = (map_stage1 < 4) ? map_pos : map_pos >> 1;
         pos <<= 1; // do not try to merge with previous line
 
-        sprite->x += roms.rom0.read16(movement_table + pos);
-        int16_t y_change = roms.rom0.read16(movement_table + pos + 0x40);
+        sprite->x += roms.rom0.read16_aligned(movement_table + pos);
+        int16_t y_change = roms.rom0.read16_aligned(movement_table + pos + 0x40);
         sprite->y -= y_change;
 
         if (y_change == 0)
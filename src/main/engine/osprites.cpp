@@ -13,6 +13,7 @@
 ***************************************************************************/
 
 #include "../trackloader.hpp"
+#include "../utils.hpp"
 
 #include "engine/oanimseq.hpp"
 #include "engine/ocrash.hpp"
@@ -41,11 +42,7 @@ void OSprites::init()
     for (uint16_t i = 0; i < 0x100; i++)
         pal_lookup[i] = 0;
 
-    for (uint16_t i = 0; i < 0x2000; i++)
-    {
-        sprite_order[i] = 0;
-        sprite_order2[i] = 0;
-    }
+    clear_order();
 
     // Reset hardware entries
     for (uint16_t i = 0; i < JUMP_ENTRIES_TOTAL; i++)
@@ -374,18 +371,29 @@ void OSprites::do_spr_order_shadows(oentry* input)
     if (spr_cnt_main + spr_cnt_shadow >= JUMP_ENTRIES_TOTAL)
         return;
 
-    // Use priority as lookup into table. Assume we're on boundaries of 0x10
-    uint16_t priority = (input->priority & 0x1FF) << 4;
-    uint8_t bytes_to_copy = sprite_order[priority];
+    // Use priority as lookup into table. 
+    // The original buckets dropped anything beyond 14 sprites at the same priority. 
+    // The lists have no such limit, as the total is already capped above.
+    uint16_t priority = input->priority & 0x1FF;
+    uint8_t node = (uint8_t) spr_cnt_main;
+
+    // The sprite counts are also reset outside this class (e.g. OMap), so drop any stale lists 
+    if (node == 0)
+        clear_order();
 
-    // Maximum number of bytes we want to copy is 0x10
-    if (bytes_to_copy < 0xE)
+    order_index[node] = input->jump_index;
+    order_next[node]  = ORDER_END;
+
+    uint32_t bit = 1 << (priority & 31);
+    if (order_used[priority >> 5] & bit)
+        order_next[order_tail[priority]] = node;
+    else
     {
-        bytes_to_copy++;
-        sprite_order[priority] = bytes_to_copy;
-        sprite_order[priority + bytes_to_copy + 1] = input->jump_index; // put at offset +2
-        spr_cnt_main++;
+        order_used[priority >> 5] |= bit;
+        order_head[priority] = node;
     }
+    order_tail[priority] = node;
+    spr_cnt_main++;
 
     // Code to handle shadows under sprites
     // test_shadow: 
@@ -442,60 +450,45 @@ void OSprites::sprite_copy()
 
     if (spr_cnt_main + spr_cnt_shadow > 0x7F)
     {
+        clear_order();
         spr_cnt_main = spr_cnt_shadow = 0;
         finalise_sprites();
         return;
     }
 
-    uint32_t spr_cnt_main_copy = spr_cnt_main;
+    // Hardware entries for the main sprites follow the shadows
+    uint16_t dst_index = spr_cnt_shadow;
 
-    // look up in sprite_order
-    int32_t src_addr = -0x10;
-
-    // copy to sprite_entries
-    uint32_t dst_index = 0;
-
-    // Get next relevant entry (number of bytes to copy, followed by indexes of sprites)
-    while (spr_cnt_main_copy != 0)
+    // Visit each used priority from lowest to highest, 
+    // then each sprite at that priority in the order it was added.
+    for (uint16_t i = 0; i < PRIORITY_LEVELS / 32; i++)
     {
-        src_addr += 0x10;
-        uint8_t bytes_to_copy = sprite_order[src_addr]; // warning: actually reads a word here normally, so this is wrong
+        uint32_t used = order_used[i];
 
-        // Copy the required number of bytes
-        if (bytes_to_copy != 0)
+        while (used)
         {
-            int32_t src_offset = src_addr + 2;
+            uint16_t priority = (i << 5) + Utils::find_first_set(used);
+            used &= used - 1;
 
-            do
+            for (uint8_t node = order_head[priority]; node != ORDER_END; node = order_next[node])
             {
-                // Sprite Index To Draw
-                sprite_order2[dst_index++] = sprite_order[src_offset++];                
-                if (--spr_cnt_main_copy == 0) break; // Loop continues until this is zero.
+                oentry *entry = &jump_table[order_index[node]];
+                entry->dst_index = dst_index++;
+                do_sprite(entry);
             }
-            // Decrement number of bytes to copy
-            while (--bytes_to_copy != 0);
         }
-
-        // Clear number of bytes to copy
-        sprite_order[src_addr] = 0; 
-    }
-
-    // cont2:
-    uint16_t cnt_shadow_copy = spr_cnt_shadow;
-
-    // next_sprite
-    for (uint16_t i = 0; i < spr_cnt_main; i++)
-    {
-        uint16_t jump_index = sprite_order2[i];
-        oentry *entry = &jump_table[jump_index];
-        entry->dst_index = cnt_shadow_copy;
-        cnt_shadow_copy++;
-        do_sprite(entry);
+        order_used[i] = 0;
     }
 
     finalise_sprites();
 }
 
+void OSprites::clear_order()
+{
+    for (uint16_t i = 0; i < PRIORITY_LEVELS / 32; i++)
+        order_used[i] = 0;
+}
+
 // Was originally labelled set_end_marker
 // 
 // Source Address: 0x7942
@@ -611,6 +604,10 @@ void OSprites::do_sprite(oentry* input)
     // which correspond to different screen sizes
     uint32_t src_offsets = input->addr + ZOOM_LOOKUP[index];
 
+    // Width and height indexes are the low bytes of the first two words of the frame
+    const uint8_t w_index = roms.rom0p->read16_aligned(src_offsets) & 0xFF;
+    const uint8_t h_index = roms.rom0p->read16_aligned(src_offsets + 2) & 0xFF;
+
     uint16_t d0 = input->draw_props | (input->zoom << 8);
     uint16_t top_bit = d0 & 0x8000;
     d0 &= 0x7FFF; // Clear top bit
@@ -623,9 +620,9 @@ void OSprites::do_sprite(oentry* input)
             d0 = lookup_mask;
         }
 
-        d0 = (d0 & 0xFF00) + roms.rom0p->read8(src_offsets + 1);
+        d0 = (d0 & 0xFF00) + w_index;
         width = roms.rom0p->read8(WH_TABLE + d0);
-        d0 = (d0 & 0xFF00) + roms.rom0p->read8(src_offsets + 3);
+        d0 = (d0 & 0xFF00) + h_index;
         height = roms.rom0p->read8(WH_TABLE + d0);
     }
     // loc_9560:
@@ -634,12 +631,12 @@ void OSprites::do_sprite(oentry* input)
         d0 &= 0x7C00;
         uint16_t h = d0;
 
-        d0 = (d0 & 0xFF00) + roms.rom0p->read8(src_offsets + 1);
+        d0 = (d0 & 0xFF00) + w_index;
         width = roms.rom0p->read8(WH_TABLE + d0);
         d0 &= 0xFF;
         width += d0;
         
-        h |= roms.rom0p->read8(src_offsets + 3);
+        h |= h_index;
         height = roms.rom0p->read8(WH_TABLE + h);
         h &= 0xFF;
         height += h;
@@ -677,8 +674,8 @@ void OSprites::do_sprite(oentry* input)
     // Set Palette & Sprite Bank Information
     // -------------------------------------------------------------------------
     output->set_pal(input->pal_dst); // Set Sprite Colour Palette
-    output->set_offset(roms.rom0p->read16(src_offsets + 8)); // Set Offset within selected sprite bank
-    output->set_bank(roms.rom0p->read8(src_offsets + 7) << 1); // Set Sprite Bank Value
+    output->set_offset(roms.rom0p->read16_aligned(src_offsets + 8)); // Set Offset within selected sprite bank
+    output->set_bank((roms.rom0p->read16_aligned(src_offsets + 6) & 0xFF) << 1); // Set Sprite Bank Value
 
     // -------------------------------------------------------------------------
     // Set Sprite Height
@@ -686,9 +683,9 @@ void OSprites::do_sprite(oentry* input)
     if (sprite_y1 < 256)
     {
         int16_t y_adj = -(sprite_y1 - 256);
-        y_adj *= roms.rom0p->read16(src_offsets + 2); // Width of line data (Unsigned multiply)
+        y_adj *= roms.rom0p->read16_aligned(src_offsets + 2); // Width of line data (Unsigned multiply)
         y_adj /= height; // Unsigned divide
-        y_adj *= roms.rom0p->read16(src_offsets + 4); // Length of line data (Unsigned multiply)
+        y_adj *= roms.rom0p->read16_aligned(src_offsets + 4); // Length of line data (Unsigned multiply)
         output->inc_offset(y_adj);
         output->data[0x0] = (output->data[0x0] & 0xFF00) | 0x100; // Mask on negative y index
         output->set_height((uint8_t) sprite_y2);
@@ -767,12 +764,12 @@ void OSprites::do_sprite(oentry* input)
     }
 
     // cont2:
-    set_hrender(input, output, roms.rom0p->read16(src_offsets + 4), width);
+    set_hrender(input, output, roms.rom0p->read16_aligned(src_offsets + 4), width);
     
     // -------------------------------------------------------------------------
     // Set Sprite Pitch & Priority
     // -------------------------------------------------------------------------
-    output->set_pitch(roms.rom0p->read8(src_offsets + 5) << 1);
+    output->set_pitch((roms.rom0p->read16_aligned(src_offsets + 4) & 0xFF) << 1);
     output->set_priority(input->shadow << 4); // todo: where does this get set?
 }
 
@@ -170,10 +170,21 @@ private:
 	// Palette Lookup Table
 	uint8_t pal_lookup[0x100];
 
-	// Converted sprite entries in RAM for hardware.
-	uint8_t sprite_order[0x2000];
-	uint8_t sprite_order2[0x2000];
-
+	// Sprites ordered by priority (0 - 0x1FF). 
+	// Originally a table of 0x10 byte buckets at 0x64000, which held a maximum of 14 sprites each.
+	//
+	// Each priority has a linked list of sprite indexes, in the order they were added.
+	// A bit is set in order_used for each priority with sprites waiting to be drawn.
+	const static uint16_t PRIORITY_LEVELS = 0x200;
+	const static uint8_t ORDER_END = 0xFF;
+
+	uint32_t order_used[PRIORITY_LEVELS / 32];
+	uint8_t order_head[PRIORITY_LEVELS];
+	uint8_t order_tail[PRIORITY_LEVELS];
+	uint8_t order_next[JUMP_ENTRIES_TOTAL];  // Next node at the same priority
+	uint8_t order_index[JUMP_ENTRIES_TOTAL]; // Jump table index of each node
+
+    void clear_order();
     void sprite_control();
 	void hide_hwsprite(oentry*, osprite*);
 	void finalise_sprites();
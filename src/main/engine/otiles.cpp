@@ -68,7 +68,7 @@ void OTiles::setup_palette_hud()
     // Write longs of palette data. Read from ROM.
     for (int i = 0; i <= 0x1F; i++)
     {
-        video.write_pal32(&pal_addr, roms.rom0.read32(&src_addr));
+        video.write_pal32(&pal_addr, roms.rom0.read32_aligned(&src_addr));
     }
 }
 
@@ -89,10 +89,10 @@ void OTiles::setup_palette_tilemap()
         uint32_t tile_data_addr = 0x17050 + offset;
         
         // Write 4 x longs of palette data. Read from ROM.
-        video.write_pal32(&pal_addr, roms.rom0.read32(&tile_data_addr));
-        video.write_pal32(&pal_addr, roms.rom0.read32(&tile_data_addr));
-        video.write_pal32(&pal_addr, roms.rom0.read32(&tile_data_addr));
-        video.write_pal32(&pal_addr, roms.rom0.read32(&tile_data_addr));
+        video.write_pal32(&pal_addr, roms.rom0.read32_aligned(&tile_data_addr));
+        video.write_pal32(&pal_addr, roms.rom0.read32_aligned(&tile_data_addr));
+        video.write_pal32(&pal_addr, roms.rom0.read32_aligned(&tile_data_addr));
+        video.write_pal32(&pal_addr, roms.rom0.read32_aligned(&tile_data_addr));
     }
 }
 
@@ -209,8 +209,8 @@ void OTiles::clear_tile_info()
     video.clear_tile_ram();
 
     // 4. Setup new values
-    fg_psel = roms.rom0.read16(TILES_PAGE_FG1);
-    bg_psel = roms.rom0.read16(TILES_PAGE_BG1);
+    fg_psel = roms.rom0.read16_aligned(TILES_PAGE_FG1);
+    bg_psel = roms.rom0.read16_aligned(TILES_PAGE_BG1);
     video.write_text16(HW_FG_PSEL, fg_psel);    // Also write values to hardware
     video.write_text16(HW_BG_PSEL, bg_psel);
 
@@ -298,21 +298,22 @@ void OTiles::copy_fg_tiles(uint32_t dst_addr)
             // next_tilex:
             do
             {
-                uint32_t data = roms.rom0.read16(&src_addr);
+                uint32_t data = roms.rom0.read16_aligned(&src_addr);
 
                 // Compression
                 if (data == 0)
                 {
-                    uint16_t value = roms.rom0.read16(&src_addr); // tile index to copy
-                    uint16_t count = roms.rom0.read16(&src_addr); // number of times to copy value
+                    uint16_t value = roms.rom0.read16_aligned(&src_addr); // tile index to copy
+                    uint16_t count = roms.rom0.read16_aligned(&src_addr); // number of times to copy value
                 
-                    // copy_compressed:
-                    for (uint16_t i = 0; i <= count; i++)
-                    {
-                        video.write_tile16(&tileram_addr, value);
-                        if (--x < 0)
-                            break; // Break out of do/while loop to compression_done
-                    }
+                    // copy_compressed: (stops at the end of the row)
+                    uint32_t run = count + 1;
+                    if (run > (uint32_t) (x + 1))
+                        run = x + 1;
+
+                    video.fill_tile16(tileram_addr, value, run);
+                    tileram_addr += run << 1;
+                    x -= (int16_t) run;
                 }
                 // No Compression
                 else
@@ -360,21 +361,22 @@ void OTiles::copy_bg_tiles(uint32_t dst_addr)
             // next_tilex:
             do
             {
-                uint32_t data = roms.rom0.read16(&src_addr);
+                uint32_t data = roms.rom0.read16_aligned(&src_addr);
 
                 // Compression
                 if (data == 0)
                 {
-                    uint16_t value = roms.rom0.read16(&src_addr); // tile index to copy
-                    uint16_t count = roms.rom0.read16(&src_addr); // number of times to copy value
+                    uint16_t value = roms.rom0.read16_aligned(&src_addr); // tile index to copy
+                    uint16_t count = roms.rom0.read16_aligned(&src_addr); // number of times to copy value
                 
-                    // copy_compressed:
-                    for (uint16_t i = 0; i <= count; i++)
-                    {
-                        video.write_tile16(&tileram_addr, value);
-                        if (--x < 0)
-                            break; // Break out of do/while loop to compression_done
-                    }
+                    // copy_compressed: (stops at the end of the row)
+                    uint32_t run = count + 1;
+                    if (run > (uint32_t) (x + 1))
+                        run = x + 1;
+
+                    video.fill_tile16(tileram_addr, value, run);
+                    tileram_addr += run << 1;
+                    x -= (int16_t) run;
                 }
                 // No Compression
                 else
@@ -486,23 +488,19 @@ void OTiles::clear_old_name_table()
     if (page & 1)
     {
         // Clear FG Tiles 2 [4 pages, (each 64x32 page table)]
-        for (uint32_t i = 0x104C00; i < 0x108C00; i += 2)
-            video.write_tile16(i, 0);
+        video.fill_tile16(0x104C00, 0, (0x108C00 - 0x104C00) >> 1);
 
         // Clear BG Tiles 2 [3 pages]
-        for (uint32_t i = 0x10B700; i < 0x10E700; i += 2)
-            video.write_tile16(i, 0);
+        video.fill_tile16(0x10B700, 0, (0x10E700 - 0x10B700) >> 1);
     }
     // Even
     else
     {
         // Clear FG Tiles 1 [4 pages, (each 64x32 page table)]
-        for (uint32_t i = 0x100C00; i < 0x104C00; i += 2)
-            video.write_tile16(i, 0);
+        video.fill_tile16(0x100C00, 0, (0x104C00 - 0x100C00) >> 1);
 
         // Clear BG Tiles 1 [3 pages]
-        for (uint32_t i = 0x108700; i < 0x10B700; i += 2)
-            video.write_tile16(i, 0);
+        video.fill_tile16(0x108700, 0, (0x10B700 - 0x108700) >> 1);
     }
 }
 
@@ -521,7 +519,7 @@ void OTiles::h_scroll_tilemaps()
     if (oinitengine.end_stage_props & BIT_0)
     {
         // Road position is used as an offset into the table. (Note it's reset at beginning of road split)
-        h_scroll_lookup = roms.rom0.read16(H_SCROLL_TABLE + ((oroad.road_pos >> 16) << 1));
+        h_scroll_lookup = roms.rom0.read16_aligned(H_SCROLL_TABLE + ((oroad.road_pos >> 16) << 1));
         
         int32_t tilemap_h_target = h_scroll_lookup << 5;
         tilemap_h_target <<= 16;
@@ -617,7 +615,7 @@ void OTiles::update_fg_page()
     cur_stage &= 1;
     cur_stage *= 8;
     h += cur_stage;
-    fg_psel = roms.rom0.read16(TILES_PAGE_FG1 + h);
+    fg_psel = roms.rom0.read16_aligned(TILES_PAGE_FG1 + h);
 }
 
 void OTiles::update_bg_page()
@@ -641,7 +639,7 @@ void OTiles::update_bg_page()
     cur_stage &= 1;
     cur_stage = ((cur_stage * 2) + cur_stage) << 1;
     h += cur_stage;
-    bg_psel = roms.rom0.read16(TILES_PAGE_BG1 + h);
+    bg_psel = roms.rom0.read16_aligned(TILES_PAGE_BG1 + h);
 }
 
 // Initalize Next Tilemap. On Level Switch.
@@ -759,12 +757,11 @@ void OTiles::init_tilemap_palette(uint16_t stage_id)
 
 void OTiles::copy_to_palram(const uint8_t blocks, uint32_t src, uint32_t dst)
 {
+    // Each block is 16 bytes
     for (uint8_t i = 0; i <= blocks; i++)
     {
-        video.write_pal32(&dst, roms.rom0.read32(src));
-        video.write_pal32(&dst, roms.rom0.read32(src + 0x4));
-        video.write_pal32(&dst, roms.rom0.read32(src + 0x8));
-        video.write_pal32(&dst, roms.rom0.read32(src + 0xc));
+        video.copy_pal_rom(dst, &roms.rom0, src, 8);
+        dst += 0x10;
     }
 }
 
@@ -798,7 +795,7 @@ void OTiles::split_tilemaps()
 void OTiles::update_fg_page_split()
 {
     fg_h_scroll = tilemap_h_scr >> 16;
-    fg_psel = roms.rom0.read16(TILES_PAGE_FG2 + ((page & 1) ? 0x6 : 0xE));
+    fg_psel = roms.rom0.read16_aligned(TILES_PAGE_FG2 + ((page & 1) ? 0x6 : 0xE));
 }
 
 // Setup Background tilemap, with relevant h-scroll and page information. Ready for forthcoming HW write.
@@ -807,7 +804,7 @@ void OTiles::update_fg_page_split()
 void OTiles::update_bg_page_split()
 {
     bg_h_scroll = (((tilemap_h_scr >> 16) & 0xFFF) * 3) >> 2;
-    bg_psel = roms.rom0.read16(TILES_PAGE_BG2 + ((page & 1) ? 0x4 : 0xA));
+    bg_psel = roms.rom0.read16_aligned(TILES_PAGE_BG2 + ((page & 1) ? 0x4 : 0xA));
 }
 
 // Fill tilemap background with a solid color
@@ -823,8 +820,7 @@ void OTiles::fill_tilemap_color(uint16_t color)
 
     video.write_pal16(&pal_addr, color);
 
-    for (uint16_t i = 0; i <= 0x7FF; i++)
-        video.write_tile16(&dst, TILE);
+    video.fill_tile16(dst, TILE, 0x800);
 }
 
 // Set Tilemap Scroll. Reset Pages
@@ -521,7 +521,7 @@ void OTraffic::update_props(oentry* sprite)
     sprite->pal_src = roms.rom0p->read8(outrun.adr.traffic_props + sprite->type + 4) + traffic_pal_cycle;
 
     int16_t traffic_type = (roms.rom0p->read8(outrun.adr.traffic_props + sprite->type + 7) << 5) + (traffic_frame << 2) + incline;
-    sprite->addr = roms.rom0p->read32(outrun.adr.traffic_data + traffic_type);
+    sprite->addr = roms.rom0p->read32_aligned(outrun.adr.traffic_data + traffic_type);
 
     osprites.map_palette(sprite);
     traffic_speed_total += sprite->traffic_speed;
@@ -27,7 +27,7 @@ outils::~outils(void)
 // Output:         Long Random
 
 // Seed for random number generator
-static uint32_t rnd_seed = 0;
+uint32_t outils::rnd_seed = 0;
 
 void outils::reset_random_seed()
 {
@@ -17,6 +17,9 @@ class outils
 public:
     static const uint8_t DEC_TO_HEX[];
 
+    // Seed for random number generator. Saved with the engine snapshot.
+    static uint32_t rnd_seed;
+
 	outils();
 	~outils();
 
@@ -154,7 +154,7 @@ void Outrun::tick(Packet* packet, bool tick_frame)
 
     // Draw FPS
     if (config.video.fps_count)
-        ohud.draw_fps_counter(cannonball::fps_counter);
+        ohud.draw_fps_counter(cannonball::fps_counter, cannonball::skip_counter);
 }
 
 // Vertical Interrupt
@@ -0,0 +1,122 @@
+/***************************************************************************
+    Engine Context.
+
+    A complete copy of the game state: the engine objects, the emulated
+    video and sound hardware, the random seed and the frame counters.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <cstring>
+
+#include "enginesnapshot.hpp"
+#include "main.hpp"
+#include "roms.hpp"
+#include "trackloader.hpp"
+#include "video.hpp"
+#include "engine/outrun.hpp"
+#include "engine/oanimseq.hpp"
+#include "engine/oattractai.hpp"
+#include "engine/obonus.hpp"
+#include "engine/ocrash.hpp"
+#include "engine/oferrari.hpp"
+#include "engine/ohiscore.hpp"
+#include "engine/ohud.hpp"
+#include "engine/oinputs.hpp"
+#include "engine/olevelobjs.hpp"
+#include "engine/ologo.hpp"
+#include "engine/omap.hpp"
+#include "engine/omusic.hpp"
+#include "engine/ooutputs.hpp"
+#include "engine/opalette.hpp"
+#include "engine/osmoke.hpp"
+#include "engine/ostats.hpp"
+#include "engine/otiles.hpp"
+#include "engine/otraffic.hpp"
+#include "engine/outils.hpp"
+
+EngineSnapshot::EngineSnapshot()
+{
+    // Engine
+    add(&outrun,      sizeof(outrun));
+    add(outrun.outputs, sizeof(OOutputs));
+    add(&oanimseq,    sizeof(oanimseq));
+    add(&oattractai,  sizeof(oattractai));
+    add(&obonus,      sizeof(obonus));
+    add(&ocrash,      sizeof(ocrash));
+    add(&oferrari,    sizeof(oferrari));
+    add(&ohiscore,    sizeof(ohiscore));
+    add(&ohud,        sizeof(ohud));
+    add(&oinitengine, sizeof(oinitengine));
+    add(&oinputs,     sizeof(oinputs));
+    add(&olevelobjs,  sizeof(olevelobjs));
+    add(&ologo,       sizeof(ologo));
+    add(&omap,        sizeof(omap));
+    add(&omusic,      sizeof(omusic));
+    add(&opalette,    sizeof(opalette));
+    add(&oroad,       sizeof(oroad));
+    add(&osmoke,      sizeof(osmoke));
+    add(&osprites,    sizeof(osprites));
+    add(&ostats,      sizeof(ostats));
+    add(&otiles,      sizeof(otiles));
+    add(&otraffic,    sizeof(otraffic));
+    add(&outils::rnd_seed, sizeof(outils::rnd_seed));
+
+    // Track and ROM selection
+    add(&trackloader, sizeof(trackloader));
+    add(&roms.rom0p,  sizeof(roms.rom0p));
+    add(&roms.rom1p,  sizeof(roms.rom1p));
+
+    // Hardware
+    video.register_state(*this);
+    osoundint.register_state(*this);
+
+    add(&cannonball::state,      sizeof(cannonball::state));
+    add(&cannonball::frame,      sizeof(cannonball::frame));
+    add(&cannonball::tick_frame, sizeof(cannonball::tick_frame));
+
+    save();
+}
+
+EngineSnapshot::~EngineSnapshot()
+{
+}
+
+void EngineSnapshot::add(void* data, uint32_t size)
+{
+    Block b = { data, size };
+    blocks.push_back(b);
+    state.resize(state.size() + size);
+}
+
+void EngineSnapshot::save()
+{
+    uint8_t* dst = &state[0];
+
+    for (uint32_t i = 0; i < blocks.size(); i++)
+    {
+        memcpy(dst, blocks[i].data, blocks[i].size);
+        dst += blocks[i].size;
+    }
+
+    video.get_palette(palette);
+}
+
+void EngineSnapshot::load()
+{
+    const uint8_t* src = &state[0];
+
+    for (uint32_t i = 0; i < blocks.size(); i++)
+    {
+        memcpy(blocks[i].data, src, blocks[i].size);
+        src += blocks[i].size;
+    }
+
+    video.set_palette(palette);
+}
+
+uint32_t EngineSnapshot::size() const
+{
+    return state.size() + sizeof(palette);
+}
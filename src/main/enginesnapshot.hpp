@@ -0,0 +1,56 @@
+/***************************************************************************
+    Engine State Snapshot.
+
+    A complete copy of the game state: the engine objects, the emulated
+    video and sound hardware, the random seed and the frame counters.
+    ROMs, decoded graphics, track data and configuration are not copied.
+
+    The engine addresses its state through the global objects, so a
+    snapshot is copied in and out of those objects in place. Pointers
+    between them therefore remain valid. This is not a separate engine
+    instance: only one game is live per process, and games can't run
+    concurrently on different threads. Used by replay validation and
+    run-ahead.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include "stdint.hpp"
+#include "globals.hpp"
+
+class EngineSnapshot
+{
+public:
+    // Create after the engine, video and sound have been initialized.
+    // The snapshot starts as a copy of the running game.
+    EngineSnapshot();
+    ~EngineSnapshot();
+
+    // Register a block of state to be copied.
+    void add(void* data, uint32_t size);
+
+    // Copy the running game into this snapshot
+    void save();
+
+    // Replace the running game with this snapshot
+    void load();
+
+    // Size of the copied state in bytes
+    uint32_t size() const;
+
+private:
+    struct Block
+    {
+        void* data;
+        uint32_t size;
+    };
+
+    std::vector<Block> blocks;
+    std::vector<uint8_t> state;
+
+    uint16_t palette[S16_PALETTE_ENTRIES];
+};
@@ -0,0 +1,306 @@
+/***************************************************************************
+    Offline Audio Renderer.
+
+    Boots only the sound hardware and ported Z80 sound program, plays a
+    sequence of sound commands and renders the result straight to a WAV
+    file as fast as possible.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <ctime>
+
+#include "roms.hpp"
+#include "setup.hpp"
+#include "frontend/audiorender.hpp"
+#include "frontend/config.hpp"
+#include "engine/audio/osoundint.hpp"
+#include "hwaudio/mixer.hpp"
+
+// Matches the output format of the SDL audio backend
+static const uint32_t FREQ     = 44100;
+static const uint32_t CHANNELS = 2;
+
+struct CommandName
+{
+    const char* name;
+    uint8_t cmd;
+};
+
+static const CommandName COMMAND_NAMES[] =
+{
+    {"FM_RESET",         sound::FM_RESET},
+    {"RESET",            sound::RESET},
+    {"MUSIC_BREEZE",     sound::MUSIC_BREEZE},
+    {"MUSIC_SPLASH",     sound::MUSIC_SPLASH},
+    {"COIN_IN",          sound::COIN_IN},
+    {"MUSIC_MAGICAL",    sound::MUSIC_MAGICAL},
+    {"YM_CHECKPOINT",    sound::YM_CHECKPOINT},
+    {"INIT_SLIP",        sound::INIT_SLIP},
+    {"STOP_SLIP",        sound::STOP_SLIP},
+    {"INIT_CHEERS",      sound::INIT_CHEERS},
+    {"STOP_CHEERS",      sound::STOP_CHEERS},
+    {"CRASH1",           sound::CRASH1},
+    {"REBOUND",          sound::REBOUND},
+    {"CRASH2",           sound::CRASH2},
+    {"NEW_COMMAND",      sound::NEW_COMMAND},
+    {"SIGNAL1",          sound::SIGNAL1},
+    {"SIGNAL2",          sound::SIGNAL2},
+    {"INIT_WEIRD",       sound::INIT_WEIRD},
+    {"STOP_WEIRD",       sound::STOP_WEIRD},
+    {"REVS",             sound::REVS},
+    {"BEEP1",            sound::BEEP1},
+    {"UFO",              sound::UFO},
+    {"BEEP2",            sound::BEEP2},
+    {"INIT_CHEERS2",     sound::INIT_CHEERS2},
+    {"VOICE_CHECKPOINT", sound::VOICE_CHECKPOINT},
+    {"VOICE_CONGRATS",   sound::VOICE_CONGRATS},
+    {"VOICE_GETREADY",   sound::VOICE_GETREADY},
+    {"INIT_SAFETYZONE",  sound::INIT_SAFETYZONE},
+    {"STOP_SAFETYZONE",  sound::STOP_SAFETYZONE},
+    {"YM_SET_LEVELS",    sound::YM_SET_LEVELS},
+    {"PCM_WAVE",         sound::PCM_WAVE},
+    {"MUSIC_LASTWAVE",   sound::MUSIC_LASTWAVE},
+    {"MUSIC_BREEZE2",    sound::MUSIC_BREEZE2},
+    {"MUSIC_MAGICAL2",   sound::MUSIC_MAGICAL2},
+    {"MUSIC_SPLASH2",    sound::MUSIC_SPLASH2},
+};
+
+static const uint32_t COMMAND_COUNT = sizeof(COMMAND_NAMES) / sizeof(COMMAND_NAMES[0]);
+
+AudioRender::AudioRender(void)
+{
+}
+
+AudioRender::~AudioRender(void)
+{
+}
+
+// Entry point. argv[0] is the output filename, argv[1] the duration in seconds.
+// Returns a process exit code.
+int AudioRender::run(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        usage();
+        return 1;
+    }
+
+    const char* filename = argv[0];
+    const double seconds = atof(argv[1]);
+
+    if (seconds <= 0)
+    {
+        usage();
+        return 1;
+    }
+
+    if (!roms.load_sound_roms())
+    {
+        std::cerr << "Unable to load sound ROMs" << std::endl;
+        return 1;
+    }
+
+    // Config determines the tick rate and which PCM samples are used
+    config.load(FILENAME_CONFIG);
+
+    if (config.sound.fix_samples)
+        roms.load_pcm_rom(true);
+
+    events.clear();
+    for (int i = 2; i < argc; i++)
+    {
+        Event e;
+        if (!parse_event(argv[i], e))
+        {
+            std::cerr << "Unknown sound event: " << argv[i] << std::endl;
+            return 1;
+        }
+        events.push_back(e);
+    }
+
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+    {
+        std::cerr << "Unable to open " << filename << " for writing" << std::endl;
+        return 1;
+    }
+
+    osoundint.has_booted = true;
+    osoundint.init();
+
+    const uint32_t frames       = (uint32_t) (seconds * config.fps + 0.5);
+    const uint32_t frame_length = osoundint.pcm->buffer_size;
+    int16_t* out                = new int16_t[frame_length];
+    uint8_t* le                 = new uint8_t[frame_length * 2];
+
+    // Header is rewritten once the final length is known
+    write_wav_header(f, 0);
+
+    std::clock_t start = std::clock();
+
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        // Events are kept in the order given, so those sharing a frame stay in order
+        for (uint32_t i = 0; i < events.size(); i++)
+        {
+            const Event& e = events[i];
+            if (e.frame != frame)
+                continue;
+
+            if (e.engine)
+            {
+                osoundint.engine_data[sound::ENGINE_PITCH_H] = e.value >> 8;
+                osoundint.engine_data[sound::ENGINE_PITCH_L] = e.value & 0xFF;
+                osoundint.engine_data[sound::ENGINE_VOL]     = e.volume;
+            }
+            else
+            {
+                osoundint.queue_sound_service((uint8_t) e.value);
+            }
+        }
+
+        osoundint.tick();
+        osoundint.pcm->stream_update();
+        osoundint.ym->stream_update();
+
+        Mixer::copy(out, osoundint.pcm->get_buffer(), frame_length, osoundint.pcm->get_gain());
+        Mixer::add (out, osoundint.ym->get_buffer(),  frame_length, osoundint.ym->get_gain());
+
+        // WAV data is always little endian
+        for (uint32_t i = 0; i < frame_length; i++)
+        {
+            le[(i << 1) + 0] = out[i] & 0xFF;
+            le[(i << 1) + 1] = (out[i] >> 8) & 0xFF;
+        }
+        fwrite(le, 1, frame_length * 2, f);
+    }
+
+    std::clock_t end = std::clock();
+
+    const uint32_t data_bytes = frames * frame_length * 2;
+    fseek(f, 0, SEEK_SET);
+    write_wav_header(f, data_bytes);
+    fclose(f);
+
+    delete[] out;
+    delete[] le;
+
+    const double samples = (double) frames * (frame_length / CHANNELS);
+    const double elapsed = (double) (end - start) / CLOCKS_PER_SEC;
+
+    std::cout << "Rendered " << frames << " frames (" << (samples / FREQ) << "s) to " << filename << std::endl;
+    if (elapsed > 0)
+    {
+        std::cout << "Time: " << elapsed << "s, " 
+                  << (uint32_t) (samples / elapsed) << " samples/s, "
+                  << ((samples / FREQ) / elapsed) << "x real time" << std::endl;
+    }
+
+    return 0;
+}
+
+// Parse <sound>[@<seconds>] or engine:<pitch>:<volume>[@<seconds>]
+bool AudioRender::parse_event(const std::string& token, Event& e)
+{
+    std::string name = token;
+    e.frame  = 0;
+    e.engine = false;
+    e.value  = 0;
+    e.volume = 0;
+
+    size_t at = token.find('@');
+    if (at != std::string::npos)
+    {
+        name = token.substr(0, at);
+        double t = atof(token.substr(at + 1).c_str());
+        if (t < 0)
+            return false;
+        e.frame = (uint32_t) (t * config.fps + 0.5);
+    }
+
+    if (name.compare(0, 7, "engine:") == 0)
+    {
+        size_t split = name.find(':', 7);
+        if (split == std::string::npos)
+            return false;
+
+        e.engine = true;
+        e.value  = (uint16_t) strtoul(name.substr(7, split - 7).c_str(), NULL, 0);
+        e.volume = (uint8_t)  strtoul(name.substr(split + 1).c_str(), NULL, 0) & 0x3F;
+        return true;
+    }
+
+    return parse_command(name, e.value);
+}
+
+// Accepts a command name from commands.hpp (case insensitive) or a number
+bool AudioRender::parse_command(const std::string& name, uint16_t& cmd)
+{
+    if (name.empty())
+        return false;
+
+    for (uint32_t i = 0; i < COMMAND_COUNT; i++)
+    {
+        const char* a = COMMAND_NAMES[i].name;
+        const char* b = name.c_str();
+        while (*a && toupper(*a) == toupper(*b)) { a++; b++; }
+
+        if (*a == 0 && *b == 0)
+        {
+            cmd = COMMAND_NAMES[i].cmd;
+            return true;
+        }
+    }
+
+    char* end;
+    unsigned long value = strtoul(name.c_str(), &end, 0);
+    if (*end != 0 || value > 0xFF)
+        return false;
+
+    cmd = (uint16_t) value;
+    return true;
+}
+
+static void write32(FILE* f, uint32_t v)
+{
+    uint8_t b[4] = { (uint8_t) v, (uint8_t) (v >> 8), (uint8_t) (v >> 16), (uint8_t) (v >> 24) };
+    fwrite(b, 1, 4, f);
+}
+
+static void write16(FILE* f, uint16_t v)
+{
+    uint8_t b[2] = { (uint8_t) v, (uint8_t) (v >> 8) };
+    fwrite(b, 1, 2, f);
+}
+
+void AudioRender::write_wav_header(FILE* f, uint32_t data_bytes)
+{
+    fwrite("RIFF", 1, 4, f);
+    write32(f, 36 + data_bytes);
+    fwrite("WAVE", 1, 4, f);
+
+    fwrite("fmt ", 1, 4, f);
+    write32(f, 16);
+    write16(f, 1);                       // PCM
+    write16(f, CHANNELS);
+    write32(f, FREQ);
+    write32(f, FREQ * CHANNELS * 2);     // Byte rate
+    write16(f, CHANNELS * 2);            // Block align
+    write16(f, 16);                      // Bits per sample
+
+    fwrite("data", 1, 4, f);
+    write32(f, data_bytes);
+}
+
+void AudioRender::usage()
+{
+    std::cerr << "Usage: cannonball -render_audio <output.wav> <seconds> [event ...]" << std::endl;
+    std::cerr << "  <sound>[@<seconds>]                  e.g. MUSIC_BREEZE or 0x81@2.5" << std::endl;
+    std::cerr << "  engine:<pitch>:<volume>[@<seconds>]  e.g. engine:0x1200:0x3F" << std::endl;
+}
@@ -0,0 +1,55 @@
+/***************************************************************************
+    Offline Audio Renderer.
+
+    Boots only the sound hardware and ported Z80 sound program, plays a
+    sequence of sound commands and renders the result straight to a WAV
+    file as fast as possible.
+
+    Useful as an audio benchmark that doesn't depend on an audio device,
+    and for producing reference output to compare audio changes against.
+
+    Usage:
+    cannonball -render_audio <output.wav> <seconds> [event ...]
+
+    Events:
+    <sound>[@<seconds>]                  Send a sound command, e.g. MUSIC_BREEZE or 0x81
+    engine:<pitch>:<volume>[@<seconds>]  Set Ferrari engine pitch (0-0xFFFF) & volume (0-0x3F)
+
+    Events without a time are sent at the start, in the order given.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "stdint.hpp"
+
+class AudioRender
+{
+public:
+    AudioRender(void);
+    ~AudioRender(void);
+
+    int run(int argc, char* argv[]);
+
+private:
+    // A sound command or engine setting, sent at a particular frame
+    struct Event
+    {
+        uint32_t frame;
+        bool engine;
+        uint16_t value;   // Sound command or engine pitch
+        uint8_t volume;   // Engine volume
+    };
+
+    std::vector<Event> events;
+
+    bool parse_event(const std::string& token, Event& e);
+    bool parse_command(const std::string& name, uint16_t& cmd);
+    void write_wav_header(FILE* f, uint32_t data_bytes);
+    void usage();
+};
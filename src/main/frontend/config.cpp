@@ -84,6 +84,10 @@ void Config::load(const std::string &filename)
     video.widescreen = pt_config.get("video.widescreen",         1); // Enable Widescreen Mode
     video.hires      = pt_config.get("video.hires",              0); // Hi-Resolution Mode
     video.filtering  = pt_config.get("video.filtering",          0); // Open GL Filtering Mode
+    video.frameskip  = pt_config.get("video.frameskip",          0); // Frameskip: Default is Off
+
+    if (video.frameskip < 0) video.frameskip = 0;
+    if (video.frameskip > 4) video.frameskip = 4;
           
     set_fps(video.fps);
 
@@ -94,6 +98,8 @@ void Config::load(const std::string &filename)
     sound.advertise   = pt_config.get("sound.advertise",   1);
     sound.preview     = pt_config.get("sound.preview",     1);
     sound.fix_samples = pt_config.get("sound.fix_samples", 1);
+    sound.stats       = pt_config.get("sound.stats",       0);
+    sound.stats_log   = pt_config.get("sound.stats_log",   0);
 
     // Custom Music
     for (int i = 0; i < 4; i++)
@@ -121,6 +127,7 @@ void Config::load(const std::string &filename)
     controls.gear          = pt_config.get("controls.gear", 0);
     controls.steer_speed   = pt_config.get("controls.steerspeed", 3);
     controls.pedal_speed   = pt_config.get("controls.pedalspeed", 4);
+    controls.runahead      = pt_config.get("controls.runahead", 0);
     controls.keyconfig[0]  = pt_config.get("controls.keyconfig.up",    273);
     controls.keyconfig[1]  = pt_config.get("controls.keyconfig.down",  274);
     controls.keyconfig[2]  = pt_config.get("controls.keyconfig.left",  276);
@@ -155,6 +162,9 @@ void Config::load(const std::string &filename)
     controls.min_force     = pt_config.get("controls.analog.haptic.min_force", 8500);
     controls.force_duration= pt_config.get("controls.analog.haptic.force_duration", 20);
 
+    if (controls.runahead < 0) controls.runahead = 0;
+    if (controls.runahead > 2) controls.runahead = 2;
+
     // ------------------------------------------------------------------------
     // Engine Settings
     // ------------------------------------------------------------------------
@@ -46,6 +46,7 @@ struct video_settings_t
     int widescreen;
     int fps;
     int fps_count;
+    int frameskip;    // Most frames in a row not drawn when drawing falls behind (0 = Off)
     int hires;
     int filtering;
 };
@@ -56,6 +57,8 @@ struct sound_settings_t
     int advertise;
     int preview;
     int fix_samples;
+    int stats;        // Display audio buffer statistics
+    int stats_log;    // Log audio buffer statistics every n seconds (0 = Off)
     custom_music_t custom_music[4];
 };
 
@@ -69,6 +72,7 @@ struct controls_settings_t
     int gear;
     int steer_speed;   // Steering Digital Speed
     int pedal_speed;   // Pedal Digital Speed
+    int runahead;      // Frames to run ahead of the displayed frame (0 = Off)
     int padconfig[8];  // Joypad Button Config
     int keyconfig[12]; // Keyboard Button Config
     int pad_id;        // Use the N'th joystick on the system.
@@ -388,7 +388,7 @@ void Menu::tick_ui()
 
     // Draw FPS
     if (config.video.fps_count)
-        ohud.draw_fps_counter(cannonball::fps_counter);
+        ohud.draw_fps_counter(cannonball::fps_counter, cannonball::skip_counter);
 
     oroad.tick();
 }
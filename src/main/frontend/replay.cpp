@@ -0,0 +1,450 @@
+/***************************************************************************
+    Time Trial Replays.
+
+    A replay stores the settings that affect the simulation, the controls
+    for every frame of a time trial and the result the player achieved.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef SDL2
+#include "sdl2/input.hpp"
+#else
+#include "sdl/input.hpp"
+#endif
+
+#include "main.hpp"
+#include "mappedfile.hpp"
+#include "frontend/config.hpp"
+#include "frontend/replay.hpp"
+#include "engine/outrun.hpp"
+#include "engine/oinputs.hpp"
+#include "engine/ostats.hpp"
+
+static const char MAGIC[8] = {'C', 'B', 'R', 'E', 'P', 'L', 'A', 'Y'};
+
+// Bytes stored per frame
+static const uint32_t FRAME_SIZE = 6;
+
+// ------------------------------------------------------------------------------------------------
+// Little endian reading and writing
+// ------------------------------------------------------------------------------------------------
+
+static void put8(std::vector<uint8_t>& d, uint32_t v)
+{
+    d.push_back(v & 0xFF);
+}
+
+static void put16(std::vector<uint8_t>& d, uint32_t v)
+{
+    d.push_back(v & 0xFF);
+    d.push_back((v >> 8) & 0xFF);
+}
+
+static void put32(std::vector<uint8_t>& d, uint32_t v)
+{
+    put16(d, v & 0xFFFF);
+    put16(d, v >> 16);
+}
+
+struct Reader
+{
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok;
+
+    uint32_t get8()
+    {
+        if (p + 1 > end) { ok = false; return 0; }
+        return *p++;
+    }
+
+    uint32_t get16()
+    {
+        if (p + 2 > end) { ok = false; return 0; }
+        uint32_t v = p[0] | (p[1] << 8);
+        p += 2;
+        return v;
+    }
+
+    uint32_t get32()
+    {
+        uint32_t lo = get16();
+        return lo | (get16() << 16);
+    }
+};
+
+Replay::Replay(void)
+{
+    recording = false;
+    memset(&settings, 0, sizeof(settings));
+    memset(&result, 0, sizeof(result));
+}
+
+Replay::~Replay(void)
+{
+}
+
+uint16_t Replay::pack_keys(const bool* keys)
+{
+    uint16_t packed = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        if (keys[i])
+            packed |= 1 << i;
+    }
+    return packed;
+}
+
+void Replay::unpack_keys(uint16_t packed, bool* keys)
+{
+    for (int i = 0; i < 16; i++)
+        keys[i] = ((packed >> i) & 1) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Recording
+// ------------------------------------------------------------------------------------------------
+
+// Capture the settings for a new race. Call before the race is initialized.
+void Replay::start()
+{
+    Settings& s = settings;
+
+    s.frame           = cannonball::frame;
+    s.keys_old        = pack_keys(input.keys_old);
+    s.analog          = input.analog;
+    s.gamepad         = input.gamepad;
+    s.fps             = config.fps;
+    s.tick_fps        = config.tick_fps;
+    s.s16_width       = config.s16_width;
+    s.s16_x_off       = config.s16_x_off;
+
+    s.dip_time        = config.engine.dip_time;
+    s.dip_traffic     = config.engine.dip_traffic;
+    s.freeplay        = config.engine.freeplay;
+    s.freeze_timer    = config.engine.freeze_timer;
+    s.disable_traffic = config.engine.disable_traffic;
+    s.jap             = config.engine.jap;
+    s.prototype       = config.engine.prototype;
+    s.randomgen       = config.engine.randomgen;
+    s.level_objects   = config.engine.level_objects;
+    s.fix_bugs        = config.engine.fix_bugs;
+    s.fix_timer       = config.engine.fix_timer;
+    s.layout_debug    = config.engine.layout_debug;
+    s.new_attract     = config.engine.new_attract;
+
+    s.gear            = config.controls.gear;
+    s.steer_speed     = config.controls.steer_speed;
+    s.pedal_speed     = config.controls.pedal_speed;
+
+    s.level            = outrun.ttrial.level;
+    s.laps             = outrun.ttrial.laps;
+    s.traffic          = outrun.custom_traffic;
+    s.best_lap_counter = outrun.ttrial.best_lap_counter;
+    memcpy(s.best_lap, outrun.ttrial.best_lap, sizeof(s.best_lap));
+
+    frames.clear();
+    recording = true;
+}
+
+// Record the controls for the current frame, before the engine has read them
+void Replay::add_frame()
+{
+    Frame f;
+    f.keys       = pack_keys(input.keys);
+    f.wheel      = input.a_wheel;
+    f.accel      = input.a_accel;
+    f.brake      = input.a_brake;
+    f.tick_frame = cannonball::tick_frame;
+    frames.push_back(f);
+}
+
+// Store the result once the game over screen is reached
+void Replay::finish()
+{
+    get_result(result, frames.size());
+    recording = false;
+}
+
+bool Replay::is_recording()
+{
+    return recording;
+}
+
+void Replay::cancel()
+{
+    frames.clear();
+    recording = false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Playback
+// ------------------------------------------------------------------------------------------------
+
+// Restore the settings for the race. The race should be initialized afterwards.
+void Replay::apply_settings()
+{
+    const Settings& s = settings;
+
+    cannonball::frame    = s.frame;
+    cannonball::frame_ms = 1000.0 / s.fps;
+    unpack_keys(s.keys_old, input.keys_old);
+    input.analog         = s.analog;
+    input.gamepad        = s.gamepad != 0;
+    config.fps           = s.fps;
+    config.tick_fps      = s.tick_fps;
+    config.s16_width     = s.s16_width;
+    config.s16_x_off     = s.s16_x_off;
+
+    config.engine.dip_time        = s.dip_time;
+    config.engine.dip_traffic     = s.dip_traffic;
+    config.engine.freeplay        = s.freeplay != 0;
+    config.engine.freeze_timer    = s.freeze_timer != 0;
+    config.engine.disable_traffic = s.disable_traffic != 0;
+    config.engine.jap             = s.jap;
+    config.engine.prototype       = s.prototype;
+    config.engine.randomgen       = s.randomgen;
+    config.engine.level_objects   = s.level_objects;
+    config.engine.fix_bugs        = s.fix_bugs != 0;
+    config.engine.fix_timer       = s.fix_timer != 0;
+    config.engine.layout_debug    = s.layout_debug != 0;
+    config.engine.new_attract     = s.new_attract;
+
+    config.controls.gear          = s.gear;
+    config.controls.steer_speed   = s.steer_speed;
+    config.controls.pedal_speed   = s.pedal_speed;
+    config.cannonboard.enabled    = false;
+
+    // Matches TTrial::tick()
+    outrun.cannonball_mode         = Outrun::MODE_TTRIAL;
+    outrun.custom_traffic          = s.traffic;
+    outrun.ttrial.level            = s.level;
+    outrun.ttrial.laps             = s.laps;
+    outrun.ttrial.current_lap      = 0;
+    outrun.ttrial.best_lap_counter = s.best_lap_counter;
+    memcpy(outrun.ttrial.best_lap, s.best_lap, sizeof(s.best_lap));
+    outrun.ttrial.new_high_score   = false;
+    outrun.ttrial.overtakes        = 0;
+    outrun.ttrial.crashes          = 0;
+    outrun.ttrial.vehicle_cols     = 0;
+    ostats.credits = 1;
+
+    oinputs.init();
+}
+
+// Set the controls for a frame, as if they had just been read from SDL
+void Replay::apply_frame(uint32_t index)
+{
+    const Frame& f = frames[index];
+
+    unpack_keys(f.keys, input.keys);
+    input.a_wheel          = f.wheel;
+    input.a_accel          = f.accel;
+    input.a_brake          = f.brake;
+    cannonball::tick_frame = f.tick_frame != 0;
+    cannonball::frame      = settings.frame + index + 1;
+}
+
+void Replay::get_result(Result& r, uint32_t frames)
+{
+    r.frames           = frames;
+    r.laps             = outrun.ttrial.current_lap;
+    r.best_lap_counter = outrun.ttrial.best_lap_counter;
+    r.overtakes        = outrun.ttrial.overtakes;
+    r.vehicle_cols     = outrun.ttrial.vehicle_cols;
+    r.crashes          = outrun.ttrial.crashes;
+
+    // Laps that weren't reached may hold values from an earlier race
+    memset(r.lap_counters, 0, sizeof(r.lap_counters));
+    memset(r.laptimes, 0, sizeof(r.laptimes));
+
+    for (int i = 0; i < r.laps && i < TTrial::MAX_LAPS; i++)
+    {
+        r.lap_counters[i] = ostats.stage_counters[i];
+        memcpy(r.laptimes[i], outrun.ttrial.laptimes[i], 3);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// File Handling
+// ------------------------------------------------------------------------------------------------
+
+bool Replay::save(const std::string& filename)
+{
+    std::vector<uint8_t> d;
+    d.reserve(128 + frames.size() * FRAME_SIZE);
+
+    d.insert(d.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    put32(d, VERSION);
+
+    const Settings& s = settings;
+    put32(d, s.frame);
+    put16(d, s.keys_old);
+    put8(d, s.analog);
+    put8(d, s.gamepad);
+    put8(d, s.fps);
+    put8(d, s.tick_fps);
+    put16(d, s.s16_width);
+    put16(d, s.s16_x_off);
+    put8(d, s.dip_time);
+    put8(d, s.dip_traffic);
+    put8(d, s.freeplay);
+    put8(d, s.freeze_timer);
+    put8(d, s.disable_traffic);
+    put8(d, s.jap);
+    put8(d, s.prototype);
+    put8(d, s.randomgen);
+    put8(d, s.level_objects);
+    put8(d, s.fix_bugs);
+    put8(d, s.fix_timer);
+    put8(d, s.layout_debug);
+    put8(d, s.new_attract);
+    put8(d, s.gear);
+    put8(d, s.steer_speed);
+    put8(d, s.pedal_speed);
+    put8(d, s.level);
+    put8(d, s.laps);
+    put8(d, s.traffic);
+    put16(d, s.best_lap_counter);
+    for (int i = 0; i < 3; i++)
+        put8(d, s.best_lap[i]);
+
+    const Result& r = result;
+    put32(d, r.frames);
+    put8(d, r.laps);
+    for (int i = 0; i < TTrial::MAX_LAPS; i++)
+    {
+        put16(d, r.lap_counters[i]);
+        for (int j = 0; j < 3; j++)
+            put8(d, r.laptimes[i][j]);
+    }
+    put16(d, r.best_lap_counter);
+    put16(d, r.overtakes);
+    put16(d, r.vehicle_cols);
+    put16(d, r.crashes);
+
+    put32(d, frames.size());
+    for (uint32_t i = 0; i < frames.size(); i++)
+    {
+        const Frame& f = frames[i];
+        put16(d, f.keys);
+        put8(d, f.wheel);
+        put8(d, f.accel);
+        put8(d, f.brake);
+        put8(d, f.tick_frame);
+    }
+
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (file == NULL)
+        return false;
+
+    const bool ok = fwrite(&d[0], 1, d.size(), file) == d.size();
+    return (fclose(file) == 0) && ok;
+}
+
+bool Replay::load(const std::string& filename, std::string& error)
+{
+    MappedFile file;
+    if (!file.open(filename.c_str()))
+    {
+        error = "unable to open file";
+        return false;
+    }
+
+    if (file.size < sizeof(MAGIC) || memcmp(file.data, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        error = "not a replay file";
+        return false;
+    }
+
+    Reader in;
+    in.p   = file.data + sizeof(MAGIC);
+    in.end = file.data + file.size;
+    in.ok  = true;
+
+    if (in.get32() != VERSION)
+    {
+        error = "unsupported replay version";
+        return false;
+    }
+
+    Settings& s = settings;
+    s.frame           = in.get32();
+    s.keys_old        = in.get16();
+    s.analog          = in.get8();
+    s.gamepad         = in.get8();
+    s.fps             = in.get8();
+    s.tick_fps        = in.get8();
+    s.s16_width       = in.get16();
+    s.s16_x_off       = in.get16();
+    s.dip_time        = in.get8();
+    s.dip_traffic     = in.get8();
+    s.freeplay        = in.get8();
+    s.freeze_timer    = in.get8();
+    s.disable_traffic = in.get8();
+    s.jap             = in.get8();
+    s.prototype       = in.get8();
+    s.randomgen       = in.get8();
+    s.level_objects   = in.get8();
+    s.fix_bugs        = in.get8();
+    s.fix_timer       = in.get8();
+    s.layout_debug    = in.get8();
+    s.new_attract     = in.get8();
+    s.gear            = in.get8();
+    s.steer_speed     = in.get8();
+    s.pedal_speed     = in.get8();
+    s.level           = in.get8();
+    s.laps            = in.get8();
+    s.traffic         = in.get8();
+    s.best_lap_counter = in.get16();
+    for (int i = 0; i < 3; i++)
+        s.best_lap[i]  = in.get8();
+
+    Result& r = result;
+    r.frames = in.get32();
+    r.laps   = in.get8();
+    for (int i = 0; i < TTrial::MAX_LAPS; i++)
+    {
+        r.lap_counters[i] = in.get16();
+        for (int j = 0; j < 3; j++)
+            r.laptimes[i][j] = in.get8();
+    }
+    r.best_lap_counter = in.get16();
+    r.overtakes        = in.get16();
+    r.vehicle_cols     = in.get16();
+    r.crashes          = in.get16();
+
+    const uint32_t count = in.get32();
+
+    const uint32_t remaining = in.end - in.p;
+
+    if (!in.ok || remaining % FRAME_SIZE != 0 || remaining / FRAME_SIZE != count)
+    {
+        error = "file is truncated or corrupt";
+        return false;
+    }
+
+    if ((s.fps != 30 && s.fps != 60) || s.laps == 0 || s.laps > TTrial::MAX_LAPS)
+    {
+        error = "invalid settings";
+        return false;
+    }
+
+    frames.resize(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Frame& f     = frames[i];
+        f.keys       = in.get16();
+        f.wheel      = in.get8();
+        f.accel      = in.get8();
+        f.brake      = in.get8();
+        f.tick_frame = in.get8();
+    }
+
+    return true;
+}
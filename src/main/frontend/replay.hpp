@@ -0,0 +1,121 @@
+/***************************************************************************
+    Time Trial Replays.
+
+    A replay stores the settings that affect the simulation, the controls
+    for every frame of a time trial and the result the player achieved.
+
+    Recording starts as the race is initialized and ends when the game
+    over screen is reached. Playing the controls back from the same
+    settings reproduces the race exactly, so the stored result can be
+    checked against a fresh simulation.
+
+    All values are stored little endian.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "stdint.hpp"
+#include "frontend/ttrial.hpp"
+
+class Replay
+{
+public:
+    // Settings captured at the start of the race
+    struct Settings
+    {
+        int32_t  frame;                             // cannonball::frame
+        uint16_t keys_old;                          // Keys held on the previous frame. One bit per Input::presses
+        uint8_t  analog;
+        uint8_t  gamepad;
+        uint8_t  fps;
+        uint8_t  tick_fps;
+        uint16_t s16_width;
+        uint16_t s16_x_off;
+
+        // Engine
+        uint8_t  dip_time;
+        uint8_t  dip_traffic;
+        uint8_t  freeplay;
+        uint8_t  freeze_timer;
+        uint8_t  disable_traffic;
+        uint8_t  jap;
+        uint8_t  prototype;
+        uint8_t  randomgen;
+        uint8_t  level_objects;
+        uint8_t  fix_bugs;
+        uint8_t  fix_timer;
+        uint8_t  layout_debug;
+        uint8_t  new_attract;
+
+        // Controls
+        uint8_t  gear;
+        uint8_t  steer_speed;
+        uint8_t  pedal_speed;
+
+        // Time Trial
+        uint8_t  level;
+        uint8_t  laps;
+        uint8_t  traffic;
+        int16_t  best_lap_counter;
+        uint8_t  best_lap[3];
+    };
+
+    // Time trial result at the game over screen
+    struct Result
+    {
+        uint32_t frames;                            // Frames from the start of the race
+        uint8_t  laps;                              // Laps completed
+        int16_t  lap_counters[TTrial::MAX_LAPS];    // Lap timer counters
+        uint8_t  laptimes[TTrial::MAX_LAPS][3];     // Lap times (minutes, seconds, milliseconds)
+        int16_t  best_lap_counter;
+        uint16_t overtakes;
+        uint16_t vehicle_cols;
+        uint16_t crashes;
+    };
+
+    // Controls for a single frame
+    struct Frame
+    {
+        uint16_t keys;                              // One bit per Input::presses
+        uint8_t  wheel;
+        uint8_t  accel;
+        uint8_t  brake;
+        uint8_t  tick_frame;
+    };
+
+    Settings settings;
+    Result result;
+    std::vector<Frame> frames;
+
+    Replay(void);
+    ~Replay(void);
+
+    // Recording
+    void start();
+    void add_frame();
+    void finish();
+    bool is_recording();
+    void cancel();
+
+    // Playback
+    void apply_settings();
+    void apply_frame(uint32_t index);
+    static void get_result(Result& r, uint32_t frames);
+
+    bool save(const std::string& filename);
+    bool load(const std::string& filename, std::string& error);
+
+private:
+    // Increment when the file format changes
+    static const uint32_t VERSION = 1;
+
+    bool recording;
+
+    static uint16_t pack_keys(const bool* keys);
+    static void unpack_keys(uint16_t packed, bool* keys);
+};
@@ -0,0 +1,468 @@
+/***************************************************************************
+    Time Trial Replay Validator.
+
+    Re-simulates a directory of time trial replays without video or sound
+    and checks each one reaches the result it claims.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#endif
+
+#ifdef SDL2
+#include "sdl2/input.hpp"
+#else
+#include "sdl/input.hpp"
+#endif
+
+#include "main.hpp"
+#include "roms.hpp"
+#include "setup.hpp"
+#include "enginesnapshot.hpp"
+#include "frontend/config.hpp"
+#include "frontend/replaycheck.hpp"
+#include "engine/outrun.hpp"
+#include "engine/oinputs.hpp"
+
+// Engine state straight after boot. Loaded before each replay, so replays don't affect each other.
+static EngineSnapshot* clean = NULL;
+
+static double now_seconds()
+{
+#ifdef _WIN32
+    return GetTickCount() / 1000.0;
+#else
+    timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + (tv.tv_usec / 1000000.0);
+#endif
+}
+
+static int cpu_count()
+{
+#ifdef _WIN32
+    return 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : (int) n;
+#endif
+}
+
+static std::string json_escape(const std::string& s)
+{
+    std::string out;
+    for (uint32_t i = 0; i < s.length(); i++)
+    {
+        const unsigned char c = s[i];
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (c < 0x20)
+        {
+            char buf[8];
+            sprintf(buf, "\\u%04x", c);
+            out += buf;
+        }
+        else
+        {
+            out += c;
+        }
+    }
+    return out;
+}
+
+static void write_result(FILE* f, const Replay::Result& r)
+{
+    fprintf(f, "{\"frames\": %u, \"laps\": %u, \"lap_counters\": [", r.frames, r.laps);
+    for (int i = 0; i < TTrial::MAX_LAPS; i++)
+        fprintf(f, "%s%d", i ? ", " : "", r.lap_counters[i]);
+
+    // As stored by the engine: minutes and seconds in BCD, then an index into the millisecond table
+    fprintf(f, "], \"laptimes\": [");
+    for (int i = 0; i < TTrial::MAX_LAPS; i++)
+        fprintf(f, "%s[%u, %u, %u]", i ? ", " : "", r.laptimes[i][0], r.laptimes[i][1], r.laptimes[i][2]);
+
+    fprintf(f, "], \"best_lap_counter\": %d, \"overtakes\": %u, \"vehicle_cols\": %u, \"crashes\": %u}",
+            r.best_lap_counter, r.overtakes, r.vehicle_cols, r.crashes);
+}
+
+// Settings that change the race, so a report shows how each time was set
+static void write_settings(FILE* f, const Replay::Settings& s)
+{
+    fprintf(f, "{\"level\": %u, \"laps\": %u, \"traffic\": %u, \"disable_traffic\": %u, "
+               "\"dip_time\": %u, \"dip_traffic\": %u, \"freeze_timer\": %u, \"fix_timer\": %u,\n      "
+               "\"fix_bugs\": %u, \"level_objects\": %u, \"prototype\": %u, \"jap\": %u, "
+               "\"randomgen\": %u, \"layout_debug\": %u, \"fps\": %u, \"tick_fps\": %u, "
+               "\"gear\": %u, \"analog\": %u}",
+            s.level, s.laps, s.traffic, s.disable_traffic,
+            s.dip_time, s.dip_traffic, s.freeze_timer, s.fix_timer,
+            s.fix_bugs, s.level_objects, s.prototype, s.jap,
+            s.randomgen, s.layout_debug, s.fps, s.tick_fps,
+            s.gear, s.analog);
+}
+
+ReplayCheck::ReplayCheck(void)
+{
+    jap_loaded = false;
+}
+
+ReplayCheck::~ReplayCheck(void)
+{
+}
+
+// Entry point. argv[0] is the replay directory.
+// Returns a process exit code.
+int ReplayCheck::run(int argc, char* argv[])
+{
+    if (argc < 1)
+    {
+        usage();
+        return 1;
+    }
+
+    std::string report;
+    int jobs = cpu_count();
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-jobs") == 0 && i + 1 < argc)
+            jobs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-report") == 0 && i + 1 < argc)
+            report = argv[++i];
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (!list_replays(argv[0]))
+    {
+        std::cerr << "Unable to read directory " << argv[0] << std::endl;
+        return 1;
+    }
+
+    if (files.empty())
+    {
+        std::cerr << "No replays found in " << argv[0] << std::endl;
+        return 1;
+    }
+
+    if (!roms.load_revb_roms())
+    {
+        std::cerr << "Unable to load ROMs" << std::endl;
+        return 1;
+    }
+
+    // Settings that affect the simulation are replaced by those stored in each replay
+    config.load(FILENAME_CONFIG);
+
+    osoundint.init();
+    clean = new EngineSnapshot();
+
+    if (jobs < 1)
+        jobs = 1;
+    if (jobs > (int) files.size())
+        jobs = files.size();
+
+    const double start = now_seconds();
+
+    Outcome* outcomes = NULL;
+    jobs = run_workers(outcomes, jobs);
+
+    const double seconds = now_seconds() - start;
+
+    int passed = 0;
+    for (uint32_t i = 0; i < files.size(); i++)
+    {
+        const Outcome& o = outcomes[i];
+        if (o.status == RESULT_PASS)
+            passed++;
+        else
+            std::cout << files[i] << ": " << (o.status == RESULT_FAIL ? "FAIL" : "ERROR") << " (" << o.message << ")" << std::endl;
+    }
+
+    std::cout << passed << " of " << files.size() << " replays passed. "
+              << jobs << " jobs, " << seconds << "s";
+    if (seconds > 0)
+        std::cout << ", " << (int) (files.size() * 60.0 / seconds) << " replays per minute";
+    std::cout << std::endl;
+
+    if (!report.empty() && !write_report(report, outcomes, jobs, seconds))
+        std::cerr << "Unable to write report " << report << std::endl;
+
+#ifdef _WIN32
+    delete[] outcomes;
+#else
+    munmap(outcomes, files.size() * sizeof(Outcome));
+#endif
+    delete clean;
+
+    return passed == (int) files.size() ? 0 : 1;
+}
+
+// Find every replay in a directory, sorted by name so reports are in a stable order
+bool ReplayCheck::list_replays(const std::string& dir)
+{
+    files.clear();
+
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA((dir + "\\*.rpl").c_str(), &data);
+    if (find == INVALID_HANDLE_VALUE)
+        return GetLastError() == ERROR_FILE_NOT_FOUND;
+
+    do
+    {
+        if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+            files.push_back(dir + "\\" + data.cFileName);
+    }
+    while (FindNextFileA(find, &data));
+    FindClose(find);
+#else
+    DIR* d = opendir(dir.c_str());
+    if (d == NULL)
+        return false;
+
+    while (dirent* e = readdir(d))
+    {
+        const std::string name = e->d_name;
+        if (name.length() > 4 && name.compare(name.length() - 4, 4, ".rpl") == 0)
+            files.push_back(dir + "/" + name);
+    }
+    closedir(d);
+#endif
+
+    std::sort(files.begin(), files.end());
+    return true;
+}
+
+// Check every replay, sharing them between worker processes.
+// Outcomes are written to shared memory, and a shared counter hands out the next replay to check,
+// so workers finishing short replays pick up the remaining work.
+// Returns the number of workers used.
+int ReplayCheck::run_workers(Outcome*& outcomes, int jobs)
+{
+#ifdef _WIN32
+    outcomes = new Outcome[files.size()];
+    for (uint32_t i = 0; i < files.size(); i++)
+        check(files[i], outcomes[i]);
+    return 1;
+#else
+    const size_t length = files.size() * sizeof(Outcome);
+    outcomes = (Outcome*) mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    uint32_t* next = (uint32_t*) mmap(NULL, sizeof(uint32_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (outcomes == MAP_FAILED || next == MAP_FAILED)
+    {
+        std::cerr << "Unable to allocate shared memory" << std::endl;
+        exit(1);
+    }
+
+    for (uint32_t i = 0; i < files.size(); i++)
+    {
+        outcomes[i].status = RESULT_ERROR;
+        strcpy(outcomes[i].message, "not checked");
+    }
+    *next = 0;
+
+    std::vector<pid_t> workers;
+
+    for (int w = 1; w < jobs; w++)
+    {
+        pid_t pid = fork();
+        if (pid < 0)
+            break;
+
+        if (pid == 0)
+        {
+            check_next(outcomes, next);
+            _exit(0);
+        }
+        workers.push_back(pid);
+    }
+
+    // This process is a worker too
+    check_next(outcomes, next);
+
+    for (uint32_t i = 0; i < workers.size(); i++)
+        waitpid(workers[i], NULL, 0);
+
+    munmap(next, sizeof(uint32_t));
+    return workers.size() + 1;
+#endif
+}
+
+#ifndef _WIN32
+// Check replays until none are left
+void ReplayCheck::check_next(Outcome* outcomes, uint32_t* next)
+{
+    uint32_t i;
+    while ((i = __sync_fetch_and_add(next, 1)) < files.size())
+        check(files[i], outcomes[i]);
+}
+#endif
+
+// Re-simulate a replay from boot, following the same steps as the main loop in time trial mode
+void ReplayCheck::check(const std::string& filename, Outcome& out)
+{
+    Replay replay;
+    std::string error;
+
+    memset(&out, 0, sizeof(Outcome));
+    out.status = RESULT_ERROR;
+
+    if (!replay.load(filename, error))
+    {
+        strncpy(out.message, error.c_str(), sizeof(out.message) - 1);
+        return;
+    }
+
+    out.level    = replay.settings.level;
+    out.loaded   = true;
+    out.settings = replay.settings;
+    out.claimed  = replay.result;
+
+    // The race was seeded from the clock, so it can't be reproduced
+    if (!replay.settings.randomgen)
+    {
+        strcpy(out.message, "non-deterministic settings");
+        return;
+    }
+
+    if (replay.settings.jap && !jap_loaded)
+    {
+        if (!roms.load_japanese_roms())
+        {
+            strcpy(out.message, "Japanese ROMs not found");
+            return;
+        }
+        jap_loaded = true;
+    }
+
+    clean->load();
+    replay.apply_settings();
+    outrun.init();
+    cannonball::state = cannonball::STATE_GAME;
+
+    bool pause    = false;
+    bool finished = false;
+    uint32_t frame;
+
+    for (frame = 0; frame < replay.frames.size() && !finished; frame++)
+    {
+        replay.apply_frame(frame);
+
+        if (cannonball::tick_frame)
+            oinputs.tick(NULL);
+        oinputs.do_gear();
+
+        if (input.has_pressed(Input::TIMER))
+            outrun.freeze_timer = !outrun.freeze_timer;
+
+        if (input.has_pressed(Input::PAUSE))
+            pause = !pause;
+
+        if (!pause || input.has_pressed(Input::STEP))
+            outrun.tick(NULL, cannonball::tick_frame);
+
+        input.frame_done();
+
+        finished = outrun.game_state == GS_GAMEOVER;
+    }
+
+    Replay::get_result(out.actual, frame);
+
+    out.status = RESULT_FAIL;
+
+    if (!finished)
+        strcpy(out.message, "race did not finish");
+    else if (out.actual.frames != out.claimed.frames)
+        strcpy(out.message, "race finished on a different frame");
+    else if (out.actual.laps != out.claimed.laps ||
+             memcmp(out.actual.lap_counters, out.claimed.lap_counters, sizeof(out.actual.lap_counters)) != 0 ||
+             memcmp(out.actual.laptimes, out.claimed.laptimes, sizeof(out.actual.laptimes)) != 0)
+        strcpy(out.message, "lap times differ");
+    else if (out.actual.best_lap_counter != out.claimed.best_lap_counter)
+        strcpy(out.message, "best lap differs");
+    else if (out.actual.overtakes    != out.claimed.overtakes ||
+             out.actual.vehicle_cols != out.claimed.vehicle_cols ||
+             out.actual.crashes      != out.claimed.crashes)
+        strcpy(out.message, "race counters differ");
+    else
+        out.status = RESULT_PASS;
+}
+
+bool ReplayCheck::write_report(const std::string& filename, const Outcome* outcomes, int jobs, double seconds)
+{
+    FILE* f = fopen(filename.c_str(), "w");
+    if (f == NULL)
+        return false;
+
+    int counts[3] = {0, 0, 0};
+    for (uint32_t i = 0; i < files.size(); i++)
+        counts[outcomes[i].status]++;
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"replays\": %u,\n", (uint32_t) files.size());
+    fprintf(f, "  \"passed\": %d,\n", counts[RESULT_PASS]);
+    fprintf(f, "  \"failed\": %d,\n", counts[RESULT_FAIL]);
+    fprintf(f, "  \"errors\": %d,\n", counts[RESULT_ERROR]);
+    fprintf(f, "  \"jobs\": %d,\n", jobs);
+    fprintf(f, "  \"seconds\": %.3f,\n", seconds);
+    fprintf(f, "  \"replays_per_minute\": %.1f,\n", seconds > 0 ? files.size() * 60.0 / seconds : 0.0);
+    fprintf(f, "  \"results\": [\n");
+
+    static const char* STATUS[] = {"pass", "fail", "error"};
+
+    for (uint32_t i = 0; i < files.size(); i++)
+    {
+        const Outcome& o = outcomes[i];
+
+        fprintf(f, "    {\"file\": \"%s\", \"status\": \"%s\"", json_escape(files[i]).c_str(), STATUS[o.status]);
+
+        if (o.message[0])
+            fprintf(f, ", \"message\": \"%s\"", json_escape(o.message).c_str());
+
+        if (o.loaded)
+        {
+            fprintf(f, ",\n     \"settings\": ");
+            write_settings(f, o.settings);
+        }
+
+        if (o.status != RESULT_ERROR)
+        {
+            fprintf(f, ", \"level\": %u,\n     \"claimed\": ", o.level);
+            write_result(f, o.claimed);
+            fprintf(f, ",\n     \"actual\": ");
+            write_result(f, o.actual);
+        }
+
+        fprintf(f, "}%s\n", i + 1 < files.size() ? "," : "");
+    }
+
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+}
+
+void ReplayCheck::usage()
+{
+    std::cerr << "Usage: cannonball -check_replays <directory> [-jobs <n>] [-report <file.json>]" << std::endl;
+}
@@ -0,0 +1,70 @@
+/***************************************************************************
+    Time Trial Replay Validator.
+
+    Re-simulates a directory of time trial replays without video or sound
+    and checks each one reaches the result it claims. Only the engine is
+    ticked, so a replay runs many times faster than real time.
+
+    Replays are shared between worker processes, one per core by default.
+    The ROMs are loaded once before the workers start, so they are shared
+    by all of them.
+
+    Usage:
+    cannonball -check_replays <directory> [-jobs <n>] [-report <file.json>]
+
+    Every .rpl file in the directory is checked. A JSON report is written
+    if requested, including the simulation settings each replay was
+    recorded with. The exit code is 0 if every replay passed.
+
+    Replays recorded without the fixed random seed can't be reproduced,
+    and are reported as errors.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "stdint.hpp"
+#include "frontend/replay.hpp"
+
+class ReplayCheck
+{
+public:
+    ReplayCheck(void);
+    ~ReplayCheck(void);
+
+    int run(int argc, char* argv[]);
+
+private:
+    enum
+    {
+        RESULT_PASS,
+        RESULT_FAIL,
+        RESULT_ERROR,
+    };
+
+    // Outcome of a single replay. Plain data, so workers can write it to shared memory.
+    struct Outcome
+    {
+        uint8_t status;
+        uint8_t level;
+        uint8_t loaded;                 // Settings were read from the file
+        char message[64];
+        Replay::Settings settings;
+        Replay::Result claimed;
+        Replay::Result actual;
+    };
+
+    std::vector<std::string> files;
+    bool jap_loaded;
+
+    bool list_replays(const std::string& dir);
+    void check(const std::string& filename, Outcome& out);
+    int  run_workers(Outcome*& outcomes, int jobs);
+    void check_next(Outcome* outcomes, uint32_t* next);
+    bool write_report(const std::string& filename, const Outcome* outcomes, int jobs, double seconds);
+    void usage();
+};
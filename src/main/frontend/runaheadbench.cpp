@@ -0,0 +1,111 @@
+/***************************************************************************
+    Run-Ahead Benchmark.
+
+    Measures what run-ahead costs on this machine.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#include "main.hpp"
+#include "roms.hpp"
+#include "setup.hpp"
+#include "runahead.hpp"
+#include "enginesnapshot.hpp"
+#include "frontend/config.hpp"
+#include "frontend/runaheadbench.hpp"
+#include "engine/outrun.hpp"
+
+// Frames run before timing starts, so the attract mode is underway
+static const int WARMUP_FRAMES = 300;
+
+RunAheadBench::RunAheadBench(void)
+{
+}
+
+RunAheadBench::~RunAheadBench(void)
+{
+}
+
+int RunAheadBench::run(int argc, char* argv[])
+{
+    int seconds = argc >= 1 ? atoi(argv[0]) : 60;
+    if (seconds < 1)
+        seconds = 60;
+
+    if (!roms.load_revb_roms())
+    {
+        std::cerr << "Unable to load ROMs" << std::endl;
+        return 1;
+    }
+
+    config.load(FILENAME_CONFIG);
+    config.controls.haptic = 0;
+
+    osoundint.init();
+    outrun.cannonball_mode = Outrun::MODE_ORIGINAL;
+    outrun.init();
+    cannonball::state = cannonball::STATE_GAME;
+
+    for (int i = 0; i < WARMUP_FRAMES; i++)
+        RunAhead::tick_engine(NULL);
+
+    const int frames = seconds * config.fps;
+
+    // Every mode runs the same frames from here
+    EngineSnapshot start;
+
+    double engine = time_frames(frames, 0);
+    start.load();
+
+    // Snapshot and restore on their own
+    std::clock_t begin = std::clock();
+    for (int i = 0; i < frames; i++)
+    {
+        start.save();
+        start.load();
+    }
+    double copy = (double) (std::clock() - begin) / CLOCKS_PER_SEC;
+
+    double ahead1 = time_frames(frames, 1);
+    start.load();
+    double ahead2 = time_frames(frames, 2);
+    start.load();
+
+    const double us = 1000000.0 / frames;
+
+    printf("Frames per mode:       %d (%d seconds at %d fps)\n", frames, seconds, config.fps);
+    printf("State size:            %.1f KB\n", start.size() / 1024.0);
+    printf("Engine only:           %.1f us/frame\n", engine * us);
+    printf("Snapshot and restore:  %.1f us/frame\n", copy * us);
+    printf("Run-ahead 1:           %.1f us/frame (%.2fx)\n", ahead1 * us, ahead1 / engine);
+    printf("Run-ahead 2:           %.1f us/frame (%.2fx)\n", ahead2 * us, ahead2 / engine);
+    printf("Cost per extra frame:  %.1f us\n", (ahead2 - ahead1) * us);
+    printf("Frame budget:          %.1f us\n", 1000000.0 / config.fps);
+
+    return 0;
+}
+
+// Time a number of real frames, each followed by running ahead. Returns CPU seconds.
+double RunAheadBench::time_frames(int frames, int ahead)
+{
+    RunAhead runahead;
+    if (ahead)
+        runahead.run(ahead, NULL, false); // Allocate the saved state outside of the timing
+
+    std::clock_t begin = std::clock();
+
+    for (int i = 0; i < frames; i++)
+    {
+        RunAhead::tick_engine(NULL);
+        if (ahead)
+            runahead.run(ahead, NULL, false);
+    }
+
+    return (double) (std::clock() - begin) / CLOCKS_PER_SEC;
+}
@@ -0,0 +1,32 @@
+/***************************************************************************
+    Run-Ahead Benchmark.
+
+    Measures what run-ahead costs on this machine. The engine is booted
+    without video or sound and the attract mode is run from the same
+    starting point without run-ahead, then running one and two frames
+    ahead. Drawing is not included, as it costs the same in every mode.
+
+    Usage:
+    cannonball -benchmark_runahead [seconds]
+
+    Seconds is the length of game time run in each mode (default 60).
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include "stdint.hpp"
+
+class RunAheadBench
+{
+public:
+    RunAheadBench(void);
+    ~RunAheadBench(void);
+
+    int run(int argc, char* argv[]);
+
+private:
+    double time_frames(int frames, int ahead);
+};
@@ -0,0 +1,131 @@
+/***************************************************************************
+    Decoded Graphics Cache.
+
+    Converting the tile, sprite and road ROMs into the formats used by the
+    renderers is one of the slower parts of booting on low-end hardware.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+
+#include "gfxcache.hpp"
+#include "mappedfile.hpp"
+#include "roms.hpp"
+#include "hwvideo/hwtiles.hpp"
+#include "hwvideo/hwsprites.hpp"
+#include "hwvideo/hwroad.hpp"
+
+static const char MAGIC[8] = {'C', 'B', 'G', 'F', 'X', 0, 0, 0};
+
+GfxCache::GfxCache()
+{
+}
+
+GfxCache::~GfxCache()
+{
+}
+
+// Restore converted graphics from the cache.
+// Returns false if the cache is missing or out of date, in which case nothing is changed.
+bool GfxCache::load(const char* filename, Roms* roms, hwtiles* tiles, hwsprites* sprites, HWRoad* road)
+{
+    MappedFile file;
+    if (!file.open(filename))
+        return false;
+
+    const uint32_t payload = hwtiles::DECODED_SIZE + hwsprites::DECODED_SIZE + HWRoad::DECODED_SIZE;
+    if (file.size != sizeof(Header) + payload)
+        return false;
+
+    Header expected, found;
+    make_header(&expected, roms);
+    memcpy(&found, file.data, sizeof(Header));
+
+    // Everything but the checksum must match
+    expected.checksum = found.checksum;
+    if (memcmp(&expected, &found, sizeof(Header)) != 0)
+        return false;
+
+    const uint8_t* data = file.data + sizeof(Header);
+    uint64_t s1 = 0, s2 = 0;
+    checksum(data, payload, &s1, &s2);
+    if (fold(s1, s2) != found.checksum)
+        return false;
+
+    tiles->set_decoded(data);
+    data += hwtiles::DECODED_SIZE;
+    sprites->set_decoded(data);
+    data += hwsprites::DECODED_SIZE;
+    road->set_decoded(data);
+
+    return true;
+}
+
+// Write the converted graphics from the video layers to the cache
+bool GfxCache::save(const char* filename, Roms* roms, hwtiles* tiles, hwsprites* sprites, HWRoad* road)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return false;
+
+    Header h;
+    make_header(&h, roms);
+    uint64_t s1 = 0, s2 = 0;
+    checksum(tiles->get_decoded(),   hwtiles::DECODED_SIZE,   &s1, &s2);
+    checksum(sprites->get_decoded(), hwsprites::DECODED_SIZE, &s1, &s2);
+    checksum(road->get_decoded(),    HWRoad::DECODED_SIZE,    &s1, &s2);
+    h.checksum = fold(s1, s2);
+
+    bool ok = fwrite(&h, sizeof(Header), 1, f) == 1 &&
+              fwrite(tiles->get_decoded(),   hwtiles::DECODED_SIZE,   1, f) == 1 &&
+              fwrite(sprites->get_decoded(), hwsprites::DECODED_SIZE, 1, f) == 1 &&
+              fwrite(road->get_decoded(),    HWRoad::DECODED_SIZE,    1, f) == 1;
+
+    ok = (fclose(f) == 0) && ok;
+
+    // Don't leave a partial cache behind
+    if (!ok)
+        remove(filename);
+
+    return ok;
+}
+
+void GfxCache::make_header(Header* h, Roms* roms)
+{
+    memset(h, 0, sizeof(Header));
+    memcpy(h->magic, MAGIC, sizeof(MAGIC));
+    h->version      = VERSION;
+    h->byte_order   = 0x01020304; // Decoded data is stored in native byte order
+    h->tiles_crc    = roms->tiles.crc;
+    h->sprites_crc  = roms->sprites.crc;
+    h->road_crc     = roms->road.crc;
+    h->tiles_size   = hwtiles::DECODED_SIZE;
+    h->sprites_size = hwsprites::DECODED_SIZE;
+    h->road_size    = HWRoad::DECODED_SIZE;
+}
+
+// Fletcher style checksum over 32-bit words. Much cheaper than a CRC, which would
+// cost a good part of the time the cache saves. length must be a multiple of 4.
+void GfxCache::checksum(const uint8_t* data, uint32_t length, uint64_t* s1, uint64_t* s2)
+{
+    uint64_t a = *s1, b = *s2;
+
+    for (uint32_t i = 0; i < length; i += 4)
+    {
+        uint32_t word;
+        memcpy(&word, data + i, 4);
+        a += word;
+        b += a;
+    }
+
+    *s1 = a;
+    *s2 = b;
+}
+
+uint32_t GfxCache::fold(uint64_t s1, uint64_t s2)
+{
+    return (uint32_t) (s1 ^ (s1 >> 32)) ^ (uint32_t) (s2 ^ (s2 >> 32)) * 0x9E3779B1u;
+}
@@ -0,0 +1,55 @@
+/***************************************************************************
+    Decoded Graphics Cache.
+
+    Converting the tile, sprite and road ROMs into the formats used by the
+    renderers is one of the slower parts of booting on low-end hardware.
+
+    The converted graphics are written to a cache file on first boot.
+    Later boots map the file and copy the data straight into the video
+    layers. The cache is rebuilt if the ROM CRCs, the cache version or the
+    host byte order change, or if the file fails its checksum.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include "stdint.hpp"
+
+class Roms;
+class hwtiles;
+class hwsprites;
+class HWRoad;
+
+class GfxCache
+{
+public:
+    GfxCache();
+    ~GfxCache();
+
+    bool load(const char* filename, Roms* roms, hwtiles* tiles, hwsprites* sprites, HWRoad* road);
+    bool save(const char* filename, Roms* roms, hwtiles* tiles, hwsprites* sprites, HWRoad* road);
+
+private:
+    // Increment when any of the decoded formats change
+    static const uint32_t VERSION = 1;
+
+    struct Header
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        uint32_t tiles_crc;
+        uint32_t sprites_crc;
+        uint32_t road_crc;
+        uint32_t tiles_size;
+        uint32_t sprites_size;
+        uint32_t road_size;
+        uint32_t checksum;
+    };
+
+    void make_header(Header* h, Roms* roms);
+    void checksum(const uint8_t* data, uint32_t length, uint64_t* s1, uint64_t* s2);
+    uint32_t fold(uint64_t s1, uint64_t s2);
+};
@@ -0,0 +1,134 @@
+/***************************************************************************
+    Audio Mixer
+
+    Mixes the 16-bit output streams of the sound chips (and any custom
+    music) together, using saturating 16-bit arithmetic.
+
+    SSE2 and NEON versions are used where available, otherwise falls
+    back to plain C++.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include "hwaudio/mixer.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIXER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MIXER_NEON
+#include <arm_neon.h>
+#endif
+
+static inline int16_t clip16(int32_t v)
+{
+    if (v > 32767)
+        return 32767;
+    else if (v < -32768)
+        return -32768;
+    return (int16_t) v;
+}
+
+static inline int16_t scale(int16_t v, int32_t gain)
+{
+    return clip16((v * gain) >> 8);
+}
+
+#ifdef MIXER_SSE2
+// Multiply 8 samples by an 8.8 gain, saturating the result back to 16-bits.
+static inline __m128i scale_x8(__m128i v, __m128i gain)
+{
+    __m128i lo = _mm_mullo_epi16(v, gain);
+    __m128i hi = _mm_mulhi_epi16(v, gain);
+    __m128i p0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 8);
+    __m128i p1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 8);
+    return _mm_packs_epi32(p0, p1);
+}
+#endif
+
+void Mixer::copy(int16_t* dst, const int16_t* src, uint32_t length, int32_t gain)
+{
+    uint32_t i = 0;
+
+    if (gain == GAIN_UNITY)
+    {
+        for (; i < length; i++)
+            dst[i] = src[i];
+        return;
+    }
+
+#if defined MIXER_SSE2
+    const __m128i g = _mm_set1_epi16((int16_t) gain);
+    for (; i + 8 <= length; i += 8)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i*) (src + i));
+        _mm_storeu_si128((__m128i*) (dst + i), scale_x8(s, g));
+    }
+#elif defined MIXER_NEON
+    for (; i + 8 <= length; i += 8)
+    {
+        int16x8_t s = vld1q_s16(src + i);
+        int16x4_t lo = vqshrn_n_s32(vmull_n_s16(vget_low_s16(s), (int16_t) gain), 8);
+        int16x4_t hi = vqshrn_n_s32(vmull_n_s16(vget_high_s16(s), (int16_t) gain), 8);
+        vst1q_s16(dst + i, vcombine_s16(lo, hi));
+    }
+#endif
+
+    for (; i < length; i++)
+        dst[i] = scale(src[i], gain);
+}
+
+void Mixer::add(int16_t* dst, const int16_t* src, uint32_t length, int32_t gain)
+{
+    uint32_t i = 0;
+
+#if defined MIXER_SSE2
+    const __m128i g = _mm_set1_epi16((int16_t) gain);
+    if (gain == GAIN_UNITY)
+    {
+        for (; i + 8 <= length; i += 8)
+        {
+            __m128i d = _mm_loadu_si128((const __m128i*) (dst + i));
+            __m128i s = _mm_loadu_si128((const __m128i*) (src + i));
+            _mm_storeu_si128((__m128i*) (dst + i), _mm_adds_epi16(d, s));
+        }
+    }
+    else
+    {
+        for (; i + 8 <= length; i += 8)
+        {
+            __m128i d = _mm_loadu_si128((const __m128i*) (dst + i));
+            __m128i s = _mm_loadu_si128((const __m128i*) (src + i));
+            _mm_storeu_si128((__m128i*) (dst + i), _mm_adds_epi16(d, scale_x8(s, g)));
+        }
+    }
+#elif defined MIXER_NEON
+    if (gain == GAIN_UNITY)
+    {
+        for (; i + 8 <= length; i += 8)
+            vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), vld1q_s16(src + i)));
+    }
+    else
+    {
+        for (; i + 8 <= length; i += 8)
+        {
+            int16x8_t s = vld1q_s16(src + i);
+            int16x4_t lo = vqshrn_n_s32(vmull_n_s16(vget_low_s16(s), (int16_t) gain), 8);
+            int16x4_t hi = vqshrn_n_s32(vmull_n_s16(vget_high_s16(s), (int16_t) gain), 8);
+            vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), vcombine_s16(lo, hi)));
+        }
+    }
+#endif
+
+    if (gain == GAIN_UNITY)
+    {
+        for (; i < length; i++)
+            dst[i] = clip16(dst[i] + src[i]);
+    }
+    else
+    {
+        for (; i < length; i++)
+            dst[i] = clip16(dst[i] + scale(src[i], gain));
+    }
+}
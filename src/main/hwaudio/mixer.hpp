@@ -0,0 +1,29 @@
+/***************************************************************************
+    Audio Mixer
+
+    Mixes the 16-bit output streams of the sound chips (and any custom
+    music) together, using saturating 16-bit arithmetic.
+
+    SSE2 and NEON versions are used where available, otherwise falls
+    back to plain C++.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include "stdint.hpp"
+
+class Mixer
+{
+public:
+    // Gain is 8.8 fixed point. 
+    static const int32_t GAIN_UNITY = 0x100;
+
+    // dst = src * gain
+    static void copy(int16_t* dst, const int16_t* src, uint32_t length, int32_t gain);
+
+    // dst = dst + (src * gain), saturated to 16-bits
+    static void add(int16_t* dst, const int16_t* src, uint32_t length, int32_t gain);
+};
@@ -54,13 +54,15 @@
  * 
  */
 
+#include <cstring> // memset
 #include "hwaudio/segapcm.hpp"
+#include "enginesnapshot.hpp"
 
 SegaPCM::SegaPCM(uint32_t clock, RomLoader* rom, uint8_t* ram, int32_t bank)
 {
     this->ram = ram;
     pcm_rom = rom->rom;  
-    low = new uint8_t[16];
+    mix = NULL;
     max_addr = rom->length;
     bankshift = bank & 0xFF;
     rgnmask = max_addr - 1;
@@ -81,19 +83,29 @@ SegaPCM::SegaPCM(uint32_t clock, RomLoader* rom, uint8_t* ram, int32_t bank)
 
 SegaPCM::~SegaPCM()
 {
-    delete[] low;
+    delete[] mix;
 }
 
 void SegaPCM::init(int32_t fps)
 {
     int FREQ = 44100;
-    downsample = (32000.0 / (double) FREQ);
+    downsample = (32000 << 16) / FREQ;
     SoundChip::init(STEREO, FREQ, fps);
+
+    delete[] mix;
+    mix = new int32_t[buffer_size];
+}
+
+// Register the sample position of each channel with an engine snapshot.
+// The registers themselves live in the PCM RAM owned by OSoundInt.
+void SegaPCM::register_state(EngineSnapshot& snapshot)
+{
+    snapshot.add(low, sizeof(low));
 }
 
 void SegaPCM::stream_update()
 {
-    SoundChip::clear_buffer();
+    memset(mix, 0, buffer_size * sizeof(int32_t));
 
     // loop over channels
     for (int ch = 0; ch < 16; ch++)
@@ -109,13 +121,18 @@ void SegaPCM::stream_update()
             uint32_t loop = (regs[0x05] << 16) | (regs[0x04] << 8);
             uint8_t end   =  regs[0x06] + 1;
 
-            uint32_t i;
+            // Cannonball Change: Output at a fixed 44,100Hz.
+            // The pitch delta only changes between frames, so scale it once here.
+            const uint32_t step = (regs[7] * downsample) >> 16;
+            const int32_t vol_l = regs[2];
+            const int32_t vol_r = regs[3];
+
+            int32_t* out = mix;
+            uint32_t i   = 0;
 
             // loop over samples on this channel
-            for (i = 0; i < frame_size; i++) 
+            while (i < frame_size) 
             {
-                int8_t v = 0;
-
                 // handle looping if we've hit the end
                 if ((addr >> 16) == end) 
                 {
@@ -130,17 +147,36 @@ void SegaPCM::stream_update()
                     }
                 }
 
-                // fetch the sample
-                v = rom[(addr >> 8) & rgnmask] - 0x80;
+                // Number of samples we can output before the end address is reached.
+                // The address can't skip the 64K end page, as step is always < 0x100.
+                // At least one sample is output, in case the loop point is inside the end page.
+                uint32_t run = frame_size - i;
+                if ((addr >> 16) == end)
+                {
+                    run = 1;
+                }
+                else if (step)
+                {
+                    uint32_t remain = ((((uint32_t) end << 16) - addr) & 0xffffff) + step - 1;
+                    remain /= step;
+                    if (remain < run)
+                        run = remain;
+                }
 
-                // apply panning
-                write_buffer(LEFT,  i, read_buffer(LEFT,  i) + (v * regs[2]));
-                write_buffer(RIGHT, i, read_buffer(RIGHT, i) + (v * regs[3]));
+                i += run;
+
+                for (; run; run--) 
+                {
+                    // fetch the sample
+                    int32_t v = (int8_t) (rom[(addr >> 8) & rgnmask] - 0x80);
 
-                // Advance.
-                // Cannonball Change: Output at a fixed 44,100Hz. 
-                double increment = ((double)regs[7]) * downsample;
-                addr = (addr + (int) increment) & 0xffffff;
+                    // apply panning
+                    *out++ += v * vol_l;
+                    *out++ += v * vol_r;
+
+                    // Advance.
+                    addr = (addr + step) & 0xffffff;
+                }
             }
 
             // store back the updated address and info
@@ -149,4 +185,10 @@ void SegaPCM::stream_update()
             low[ch] = regs[0x86] & 1 ? 0 : addr;
         }
     }
+
+    // Output the accumulated channels. 
+    // Truncating here wraps identically to truncating after every channel.
+    int16_t* buffer = get_buffer();
+    for (uint32_t i = 0; i < buffer_size; i++)
+        buffer[i] = (int16_t) mix[i];
 }
\ No newline at end of file
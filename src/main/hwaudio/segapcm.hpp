@@ -16,6 +16,8 @@
 #include "romloader.hpp"
 #include "hwaudio/soundchip.hpp"
 
+class EngineSnapshot;
+
 class SegaPCM : public SoundChip
 {
 public:
@@ -30,16 +32,21 @@ public:
     ~SegaPCM();
     void init(int32_t fps);
     void stream_update();
+    void register_state(EngineSnapshot&);
 
 private:
     // PCM Chip Emulation
     uint8_t* ram;
-    uint8_t* low;
+    uint8_t low[16];
     uint8_t* pcm_rom;
     int32_t max_addr;
     int32_t bankshift;
     int32_t bankmask;
     int32_t rgnmask;
 
-    double downsample;
+    // 32,000Hz to 44,100Hz pitch ratio (16.16 fixed point)
+    uint32_t downsample;
+
+    // Per-frame mix accumulator for all 16 channels (interleaved stereo)
+    int32_t* mix;
 };
\ No newline at end of file
@@ -10,10 +10,11 @@
 
 #include "stdint.hpp"
 #include "hwaudio/soundchip.hpp"
+#include "hwaudio/mixer.hpp"
 
 SoundChip::SoundChip()
 {
-    volume     = 1.0;
+    gain       = Mixer::GAIN_UNITY;
     initalized = false;
 }
 
@@ -45,7 +46,7 @@ void SoundChip::set_volume(uint8_t v)
     if (v > 10) 
         return;
     
-    volume = (float) (v / 10.0);
+    gain = (v * Mixer::GAIN_UNITY) / 10;
 }
 
 void SoundChip::clear_buffer()
@@ -56,7 +57,6 @@ void SoundChip::clear_buffer()
 
 void SoundChip::write_buffer(const uint8_t channel, uint32_t address, int16_t value)
 {
-    //buffer[channel + (address * channels)] = (int16_t) (value * volume); // Unused for now
     buffer[channel + (address * channels)] = value;
 }
 
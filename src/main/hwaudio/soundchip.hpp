@@ -35,6 +35,9 @@ public:
     int16_t* get_buffer();
     void set_volume(uint8_t);
 
+    // Output gain applied when mixing (8.8 fixed point)
+    int32_t get_gain() { return gain; }
+
 protected:
     const static uint8_t MONO             = 1;
     const static uint8_t STEREO           = 2;
@@ -45,8 +48,8 @@ protected:
     //  Buffer size for one frame (excluding channel info)
     uint32_t frame_size;
 
-    // Volume of sound chip
-    float volume;
+    // Volume of sound chip, as a mixer gain (8.8 fixed point)
+    int32_t gain;
 
     void clear_buffer();
     void write_buffer(const uint8_t, uint32_t, int16_t);
@@ -15,6 +15,7 @@
 #include <cstring>  // For memset on GCC
 
 #include "hwaudio/ym2151.hpp"
+#include "enginesnapshot.hpp"
 
 signed int     chanout[8];
 signed int     m2,c1,c2;            /* Phase Modulation input for operators 2,3,4  */
@@ -67,8 +68,8 @@ uint8_t        connects[8];         /* channels connections */
     uint8_t    tim_B;               /* timer B enable (0-disabled) */
     int32_t    tim_A_val;           /* current value of timer A */
     int32_t    tim_B_val;           /* current value of timer B */
-    uint32_t   tim_A_tab[1024];     /* timer A deltas */
-    uint32_t   tim_B_tab[256];      /* timer B deltas */
+    const uint32_t* tim_A_tab;      /* timer A deltas */
+    const uint32_t* tim_B_tab;      /* timer B deltas */
 #endif
 uint32_t       timer_A_index;       /* timer A index */
 uint32_t       timer_B_index;       /* timer B index */
@@ -91,14 +92,27 @@ uint32_t       timer_B_index_old;   /* timer B previous index */
 *              9       note code + DT2 + LFO PM
 *              10      note code + DT2 + LFO PM
 */
-uint32_t       freq[11*768];        /* 11 octaves, 768 'cents' per octave */
+const uint32_t* freq;               /* 11 octaves, 768 'cents' per octave */
 
 /*  Frequency deltas for DT1. These deltas alter operator frequency
 *   after it has been taken from frequency-deltas table.
 */
-int32_t        dt1_freq[8*32];      /* 8 DT1 levels, 32 KC values */
+const int32_t* dt1_freq;            /* 8 DT1 levels, 32 KC values */
 
-uint32_t       noise_tab[32];       /* 17bit Noise Generator periods */
+const uint32_t* noise_tab;          /* 17bit Noise Generator periods */
+
+/*  The tables above point to the precomputed versions in ym2151tables.hpp,
+*   or for other clocks and sample rates, to these generated at runtime.
+*/
+static uint32_t gen_freq[11*768];
+static int32_t  gen_dt1_freq[8*32];
+static uint32_t gen_noise_tab[32];
+#ifndef USE_MAME_TIMERS
+static uint32_t gen_tim_A_tab[1024];
+static uint32_t gen_tim_B_tab[256];
+#endif
+static int      gen_clock = 0;      /* clock and sample rate of the generated tables */
+static int      gen_sampfreq = 0;
 
 
 #define M_PI             3.14159265358979323846
@@ -140,15 +154,11 @@ uint32_t       noise_tab[32];       /* 17bit Noise Generator periods */
 *   TL_RES_LEN - sinus resolution (X axis)
 */
 #define TL_TAB_LEN (13*2*TL_RES_LEN)
-static signed int tl_tab[TL_TAB_LEN];
 
 #define ENV_QUIET        (TL_TAB_LEN>>3)
 
-/* sin waveform table in 'decibel' scale */
-static unsigned int sin_tab[SIN_LEN];
-
-/* translate from D1L to volume index (16 D1L levels) */
-static uint32_t d1l_tab[16];
+/* tl_tab, sin_tab, d1l_tab and the default chip tables */
+#include "hwaudio/ym2151tables.hpp"
 
 #define RATE_STEPS (8)
 static const uint8_t eg_inc[19*RATE_STEPS]={
@@ -419,77 +429,9 @@ YM2151::~YM2151()
 }
 
 
+// The operator tables are precomputed in ym2151tables.hpp
 void YM2151::init_tables()
 {
-    signed int i,x,n;
-    double o,m;
-
-    for (x=0; x<TL_RES_LEN; x++)
-    {
-        m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
-        m = floor(m);
-
-        /* we never reach (1<<16) here due to the (x+1) */
-        /* result fits within 16 bits at maximum */
-
-        n = (int)m;        /* 16 bits here */
-        n >>= 4;        /* 12 bits here */
-        if (n&1)        /* round to closest */
-            n = (n>>1)+1;
-        else
-            n = n>>1;
-                        /* 11 bits here (rounded) */
-        n <<= 2;        /* 13 bits here (as in real chip) */
-        tl_tab[ x*2 + 0 ] = n;
-        tl_tab[ x*2 + 1 ] = -tl_tab[ x*2 + 0 ];
-
-        for (i=1; i<13; i++)
-        {
-            tl_tab[ x*2+0 + i*2*TL_RES_LEN ] =  tl_tab[ x*2+0 ]>>i;
-            tl_tab[ x*2+1 + i*2*TL_RES_LEN ] = -tl_tab[ x*2+0 + i*2*TL_RES_LEN ];
-        }
-    #if 0
-        logerror("tl %04i", x*2);
-        for (i=0; i<13; i++)
-            logerror(", [%02i] %4i", i*2, tl_tab[ x*2 /*+1*/ + i*2*TL_RES_LEN ]);
-        logerror("\n");
-    #endif
-    }
-    /*logerror("TL_TAB_LEN = %i (%i bytes)\n",TL_TAB_LEN, (int)sizeof(tl_tab));*/
-    /*logerror("ENV_QUIET= %i\n",ENV_QUIET );*/
-
-
-    for (i=0; i<SIN_LEN; i++)
-    {
-        /* non-standard sinus */
-        m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* verified on the real chip */
-
-        /* we never reach zero here due to ((i*2)+1) */
-
-        if (m>0.0)
-            o = 8*log(1.0/m)/log(2.0);    /* convert to 'decibels' */
-        else
-            o = 8*log(-1.0/m)/log(2.0);    /* convert to 'decibels' */
-
-        o = o / (ENV_STEP/4);
-
-        n = (int)(2.0*o);
-        if (n&1)                        /* round to closest */
-            n = (n>>1)+1;
-        else
-            n = n>>1;
-
-        sin_tab[ i ] = n*2 + (m>=0.0? 0: 1 );
-        /*logerror("sin [0x%4x]= %4i (tl_tab value=%8x)\n", i, sin_tab[i],tl_tab[sin_tab[i]]);*/
-    }
-    /* calculate d1l_tab table */
-    for (i=0; i<16; i++)
-    {
-        m = (i!=15 ? i : i+16) * (4.0/ENV_STEP);   /* every 3 'dB' except for all bits = 1 = 45+48 'dB' */
-        d1l_tab[i] = (uint32_t) m;
-        /*logerror("d1l_tab[%02x]=%08x\n",i,d1l_tab[i] );*/
-    }
-
 #ifdef SAVE_SAMPLE
     sample[8]=fopen("sampsum.pcm","wb");
 #endif
@@ -506,6 +448,8 @@ void YM2151::init_tables()
 }
 
 
+// Point to the chip tables for the current clock and sample rate.
+// Only generated when they differ from the precomputed defaults.
 void YM2151::init_chip_tables()
 {
     int i,j;
@@ -513,6 +457,35 @@ void YM2151::init_chip_tables()
     double scaler;
     double pom;
 
+#ifndef USE_MAME_TIMERS
+    if (clock == YM2151_TABLES_CLOCK && sampfreq == YM2151_TABLES_RATE)
+    {
+        freq      = freq_default;
+        dt1_freq  = dt1_freq_default;
+        noise_tab = noise_tab_default;
+        tim_A_tab = tim_A_tab_default;
+        tim_B_tab = tim_B_tab_default;
+        return;
+    }
+
+    freq      = gen_freq;
+    dt1_freq  = gen_dt1_freq;
+    noise_tab = gen_noise_tab;
+    tim_A_tab = gen_tim_A_tab;
+    tim_B_tab = gen_tim_B_tab;
+#else
+    freq      = gen_freq;
+    dt1_freq  = gen_dt1_freq;
+    noise_tab = gen_noise_tab;
+#endif
+
+    /* already generated for this configuration */
+    if (clock == gen_clock && sampfreq == gen_sampfreq)
+        return;
+
+    gen_clock    = clock;
+    gen_sampfreq = sampfreq;
+
     scaler = ( (double)clock / 64.0 ) / ( (double)sampfreq );
     /*logerror("scaler    = %20.15f\n", scaler);*/
 
@@ -539,29 +512,29 @@ void YM2151::init_chip_tables()
 
 
         /* octave 2 - reference octave */
-        freq[ 768+2*768+i ] = ((int)(phaseinc*mult)) & 0xffffffc0; /* adjust to X.10 fixed point */
+        gen_freq[ 768+2*768+i ] = ((int)(phaseinc*mult)) & 0xffffffc0; /* adjust to X.10 fixed point */
         /* octave 0 and octave 1 */
         for (j=0; j<2; j++)
         {
-            freq[768 + j*768 + i] = (freq[ 768+2*768+i ] >> (2-j) ) & 0xffffffc0; /* adjust to X.10 fixed point */
+            gen_freq[768 + j*768 + i] = (gen_freq[ 768+2*768+i ] >> (2-j) ) & 0xffffffc0; /* adjust to X.10 fixed point */
         }
         /* octave 3 to 7 */
         for (j=3; j<8; j++)
         {
-            freq[768 + j*768 + i] = freq[ 768+2*768+i ] << (j-2);
+            gen_freq[768 + j*768 + i] = gen_freq[ 768+2*768+i ] << (j-2);
         }
 
     #if 0
-            pom = (double)freq[ 768+2*768+i ] / ((double)(1<<FREQ_SH));
+            pom = (double)gen_freq[ 768+2*768+i ] / ((double)(1<<FREQ_SH));
             pom = pom * (double)sampfreq / (double)SIN_LEN;
-            logerror("1freq[%4i][%08x]= real %20.15f Hz  emul %20.15f Hz\n", i, freq[ 768+2*768+i ], Hz, pom);
+            logerror("1freq[%4i][%08x]= real %20.15f Hz  emul %20.15f Hz\n", i, gen_freq[ 768+2*768+i ], Hz, pom);
     #endif
     }
 
     /* octave -1 (all equal to: oct 0, _KC_00_, _KF_00_) */
     for (i=0; i<768; i++)
     {
-        freq[ 0*768 + i ] = freq[1*768+0];
+        gen_freq[ 0*768 + i ] = gen_freq[1*768+0];
     }
 
     /* octave 8 and 9 (all equal to: oct 7, _KC_14_, _KF_63_) */
@@ -569,16 +542,16 @@ void YM2151::init_chip_tables()
     {
         for (i=0; i<768; i++)
         {
-            freq[768+ j*768 + i ] = freq[768 + 8*768 -1];
+            gen_freq[768+ j*768 + i ] = gen_freq[768 + 8*768 -1];
         }
     }
 
 #if 0
         for (i=0; i<11*768; i++)
         {
-            pom = (double)freq[i] / ((double)(1<<FREQ_SH));
+            pom = (double)gen_freq[i] / ((double)(1<<FREQ_SH));
             pom = pom * (double)sampfreq / (double)SIN_LEN;
-            logerror("freq[%4i][%08x]= emul %20.15f Hz\n", i, freq[i], pom);
+            logerror("freq[%4i][%08x]= emul %20.15f Hz\n", i, gen_freq[i], pom);
         }
 #endif
 
@@ -593,16 +566,16 @@ void YM2151::init_chip_tables()
             phaseinc = (Hz*SIN_LEN) / (double)sampfreq;
 
             /*positive and negative values*/
-            dt1_freq[ (j+0)*32 + i ] = (int32_t) (phaseinc * mult);
-            dt1_freq[ (j+4)*32 + i ] = -dt1_freq[ (j+0)*32 + i ];
+            gen_dt1_freq[ (j+0)*32 + i ] = (int32_t) (phaseinc * mult);
+            gen_dt1_freq[ (j+4)*32 + i ] = -gen_dt1_freq[ (j+0)*32 + i ];
 
 #if 0
             {
                 int x = j*32 + i;
-                pom = (double)dt1_freq[x] / mult;
+                pom = (double)gen_dt1_freq[x] / mult;
                 pom = pom * (double)sampfreq / (double)SIN_LEN;
                 logerror("DT1(%03i)[%02i %02i][%08x]= real %19.15f Hz  emul %19.15f Hz\n",
-                         x, j, i, dt1_freq[x], Hz, pom);
+                         x, j, i, gen_dt1_freq[x], Hz, pom);
             }
 #endif
         }
@@ -621,7 +594,7 @@ void YM2151::init_chip_tables()
             timer_A_time[i] = pom;
         #else
             //tim_A_tab[i] = pom.as_double() * (double)sampfreq * mult;  /* number of samples that timer period takes (fixed point) */
-            tim_A_tab[i] = (int)(pom * (double)sampfreq * mult); 
+            gen_tim_A_tab[i] = (int)(pom * (double)sampfreq * mult); 
         #endif
     }
     for (i=0; i<256; i++)
@@ -633,7 +606,7 @@ void YM2151::init_chip_tables()
             timer_B_time[i] = pom;
         #else
             //tim_B_tab[i] = pom.as_double() * (double)sampfreq * mult;  /* number of samples that timer period takes (fixed point) */
-            tim_B_tab[i] = (int)(pom * (double)sampfreq * mult); 
+            gen_tim_B_tab[i] = (int)(pom * (double)sampfreq * mult); 
         #endif
     }
 
@@ -645,7 +618,7 @@ void YM2151::init_chip_tables()
         j = 32-j;
         j = (int) (65536.0 / (double)(j*32.0));    /* number of samples per one shift of the shift register */
         /*noise_tab[i] = j * 64;*/    /* number of chip clock cycles per one shift */
-        noise_tab[i] = (uint32_t) (j * 64 * scaler);
+        gen_noise_tab[i] = (uint32_t) (j * 64 * scaler);
         /*logerror("noise_tab[%02x]=%08x\n", i, noise_tab[i]);*/
     }
 }
@@ -1281,6 +1254,58 @@ int YM2151::read_status()
     return status;
 }
 
+/*
+*   Register the chip state with an engine snapshot.
+*   Tables that only depend on the clock and sample rate are not included.
+*/
+void YM2151::register_state(EngineSnapshot& snapshot)
+{
+    #define YM_STATE(x) snapshot.add(&x, sizeof(x))
+
+    YM_STATE(irq);
+    YM_STATE(chanout);
+    YM_STATE(m2);
+    YM_STATE(c1);
+    YM_STATE(c2);
+    YM_STATE(mem);
+    YM_STATE(oper);
+    YM_STATE(pan);
+    YM_STATE(eg_cnt);
+    YM_STATE(eg_timer);
+    YM_STATE(lfo_phase);
+    YM_STATE(lfo_timer);
+    YM_STATE(lfo_timer_add);
+    YM_STATE(lfo_counter);
+    YM_STATE(lfo_counter_add);
+    YM_STATE(lfo_wsel);
+    YM_STATE(amd);
+    YM_STATE(pmd);
+    YM_STATE(lfa);
+    YM_STATE(lfp);
+    YM_STATE(test);
+    YM_STATE(ct);
+    YM_STATE(noise);
+    YM_STATE(noise_rng);
+    YM_STATE(noise_p);
+    YM_STATE(noise_f);
+    YM_STATE(csm_req);
+    YM_STATE(irq_enable);
+    YM_STATE(status);
+    YM_STATE(connects);
+#ifndef USE_MAME_TIMERS
+    YM_STATE(tim_A);
+    YM_STATE(tim_B);
+    YM_STATE(tim_A_val);
+    YM_STATE(tim_B_val);
+#endif
+    YM_STATE(timer_A_index);
+    YM_STATE(timer_B_index);
+    YM_STATE(timer_A_index_old);
+    YM_STATE(timer_B_index_old);
+
+    #undef YM_STATE
+}
+
 /*
 *   Initialize YM2151 emulator(s).
 *
@@ -16,6 +16,8 @@
 #include "romloader.hpp"
 #include "hwaudio/soundchip.hpp"
 
+class EngineSnapshot;
+
 /* struct describing a single operator */
 typedef struct
 {
@@ -80,6 +82,7 @@ public:
     void stream_update();
     void write_reg(int r, int v);
     int read_status();
+    void register_state(EngineSnapshot&);
 
 private:
     int clock;        /*chip clock in Hz (passed from 2151intf.c)*/
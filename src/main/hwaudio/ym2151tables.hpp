@@ -0,0 +1,1788 @@
+/***************************************************************************
+    Yamaha YM2151 Lookup Tables.
+
+    Precomputed output of the table generation in the MAME driver, so they
+    don't need to be rebuilt with pow/sin/log on every init, and so they
+    live in read-only memory.
+
+    The operator tables (tl_tab, sin_tab, d1l_tab) don't depend on the clock
+    or sample rate.
+
+    The remaining tables are for the OutRun configuration: a 4MHz clock and
+    44.1KHz output. Other configurations generate them at runtime
+    (see YM2151::init_chip_tables).
+
+    Included only by ym2151.cpp.
+
+    See http://mamedev.org/source/docs/license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+/* Clock and sample rate the chip tables below were generated for */
+#define YM2151_TABLES_CLOCK 4000000
+#define YM2151_TABLES_RATE  44100
+
+/* ----------------------------------------------------------------------------
+   Operator tables
+   ----------------------------------------------------------------------------*/
+
+/* Total level: 13 amplitude levels * 2 signs * 256 steps */
+static const signed int tl_tab[TL_TAB_LEN] =
+{
+    8168, -8168, 8148, -8148, 8124, -8124, 8104, -8104, 8080, -8080, 8060, -8060, 8040, -8040, 8016, -8016,
+    7996, -7996, 7972, -7972, 7952, -7952, 7932, -7932, 7908, -7908, 7888, -7888, 7864, -7864, 7844, -7844,
+    7824, -7824, 7804, -7804, 7780, -7780, 7760, -7760, 7740, -7740, 7720, -7720, 7696, -7696, 7676, -7676,
+    7656, -7656, 7636, -7636, 7616, -7616, 7592, -7592, 7572, -7572, 7552, -7552, 7532, -7532, 7512, -7512,
+    7492, -7492, 7472, -7472, 7452, -7452, 7432, -7432, 7412, -7412, 7392, -7392, 7372, -7372, 7352, -7352,
+    7332, -7332, 7312, -7312, 7292, -7292, 7272, -7272, 7252, -7252, 7232, -7232, 7212, -7212, 7192, -7192,
+    7176, -7176, 7156, -7156, 7136, -7136, 7116, -7116, 7096, -7096, 7076, -7076, 7060, -7060, 7040, -7040,
+    7020, -7020, 7000, -7000, 6984, -6984, 6964, -6964, 6944, -6944, 6928, -6928, 6908, -6908, 6888, -6888,
+    6868, -6868, 6852, -6852, 6832, -6832, 6816, -6816, 6796, -6796, 6776, -6776, 6760, -6760, 6740, -6740,
+    6724, -6724, 6704, -6704, 6688, -6688, 6668, -6668, 6652, -6652, 6632, -6632, 6616, -6616, 6596, -6596,
+    6580, -6580, 6560, -6560, 6544, -6544, 6524, -6524, 6508, -6508, 6492, -6492, 6472, -6472, 6456, -6456,
+    6436, -6436, 6420, -6420, 6404, -6404, 6384, -6384, 6368, -6368, 6352, -6352, 6336, -6336, 6316, -6316,
+    6300, -6300, 6284, -6284, 6264, -6264, 6248, -6248, 6232, -6232, 6216, -6216, 6200, -6200, 6180, -6180,
+    6164, -6164, 6148, -6148, 6132, -6132, 6116, -6116, 6100, -6100, 6080, -6080, 6064, -6064, 6048, -6048,
+    6032, -6032, 6016, -6016, 6000, -6000, 5984, -5984, 5968, -5968, 5952, -5952, 5936, -5936, 5920, -5920,
+    5904, -5904, 5888, -5888, 5872, -5872, 5856, -5856, 5840, -5840, 5824, -5824, 5808, -5808, 5792, -5792,
+    5776, -5776, 5760, -5760, 5744, -5744, 5732, -5732, 5716, -5716, 5700, -5700, 5684, -5684, 5668, -5668,
+    5652, -5652, 5636, -5636, 5624, -5624, 5608, -5608, 5592, -5592, 5576, -5576, 5564, -5564, 5548, -5548,
+    5532, -5532, 5516, -5516, 5504, -5504, 5488, -5488, 5472, -5472, 5456, -5456, 5444, -5444, 5428, -5428,
+    5412, -5412, 5400, -5400, 5384, -5384, 5368, -5368, 5356, -5356, 5340, -5340, 5328, -5328, 5312, -5312,
+    5296, -5296, 5284, -5284, 5268, -5268, 5256, -5256, 5240, -5240, 5228, -5228, 5212, -5212, 5200, -5200,
+    5184, -5184, 5168, -5168, 5156, -5156, 5144, -5144, 5128, -5128, 5116, -5116, 5100, -5100, 5088, -5088,
+    5072, -5072, 5060, -5060, 5044, -5044, 5032, -5032, 5020, -5020, 5004, -5004, 4992, -4992, 4976, -4976,
+    4964, -4964, 4952, -4952, 4936, -4936, 4924, -4924, 4912, -4912, 4896, -4896, 4884, -4884, 4872, -4872,
+    4856, -4856, 4844, -4844, 4832, -4832, 4820, -4820, 4804, -4804, 4792, -4792, 4780, -4780, 4768, -4768,
+    4752, -4752, 4740, -4740, 4728, -4728, 4716, -4716, 4704, -4704, 4688, -4688, 4676, -4676, 4664, -4664,
+    4652, -4652, 4640, -4640, 4628, -4628, 4616, -4616, 4600, -4600, 4588, -4588, 4576, -4576, 4564, -4564,
+    4552, -4552, 4540, -4540, 4528, -4528, 4516, -4516, 4504, -4504, 4492, -4492, 4480, -4480, 4468, -4468,
+    4456, -4456, 4444, -4444, 4432, -4432, 4420, -4420, 4408, -4408, 4396, -4396, 4384, -4384, 4372, -4372,
+    4360, -4360, 4348, -4348, 4336, -4336, 4324, -4324, 4312, -4312, 4300, -4300, 4288, -4288, 4276, -4276,
+    4264, -4264, 4256, -4256, 4244, -4244, 4232, -4232, 4220, -4220, 4208, -4208, 4196, -4196, 4184, -4184,
+    4176, -4176, 4164, -4164, 4152, -4152, 4140, -4140, 4128, -4128, 4120, -4120, 4108, -4108, 4096, -4096,
+    4084, -4084, 4074, -4074, 4062, -4062, 4052, -4052, 4040, -4040, 4030, -4030, 4020, -4020, 4008, -4008,
+    3998, -3998, 3986, -3986, 3976, -3976, 3966, -3966, 3954, -3954, 3944, -3944, 3932, -3932, 3922, -3922,
+    3912, -3912, 3902, -3902, 3890, -3890, 3880, -3880, 3870, -3870, 3860, -3860, 3848, -3848, 3838, -3838,
+    3828, -3828, 3818, -3818, 3808, -3808, 3796, -3796, 3786, -3786, 3776, -3776, 3766, -3766, 3756, -3756,
+    3746, -3746, 3736, -3736, 3726, -3726, 3716, -3716, 3706, -3706, 3696, -3696, 3686, -3686, 3676, -3676,
+    3666, -3666, 3656, -3656, 3646, -3646, 3636, -3636, 3626, -3626, 3616, -3616, 3606, -3606, 3596, -3596,
+    3588, -3588, 3578, -3578, 3568, -3568, 3558, -3558, 3548, -3548, 3538, -3538, 3530, -3530, 3520, -3520,
+    3510, -3510, 3500, -3500, 3492, -3492, 3482, -3482, 3472, -3472, 3464, -3464, 3454, -3454, 3444, -3444,
+    3434, -3434, 3426, -3426, 3416, -3416, 3408, -3408, 3398, -3398, 3388, -3388, 3380, -3380, 3370, -3370,
+    3362, -3362, 3352, -3352, 3344, -3344, 3334, -3334, 3326, -3326, 3316, -3316, 3308, -3308, 3298, -3298,
+    3290, -3290, 3280, -3280, 3272, -3272, 3262, -3262, 3254, -3254, 3246, -3246, 3236, -3236, 3228, -3228,
+    3218, -3218, 3210, -3210, 3202, -3202, 3192, -3192, 3184, -3184, 3176, -3176, 3168, -3168, 3158, -3158,
+    3150, -3150, 3142, -3142, 3132, -3132, 3124, -3124, 3116, -3116, 3108, -3108, 3100, -3100, 3090, -3090,
+    3082, -3082, 3074, -3074, 3066, -3066, 3058, -3058, 3050, -3050, 3040, -3040, 3032, -3032, 3024, -3024,
+    3016, -3016, 3008, -3008, 3000, -3000, 2992, -2992, 2984, -2984, 2976, -2976, 2968, -2968, 2960, -2960,
+    2952, -2952, 2944, -2944, 2936, -2936, 2928, -2928, 2920, -2920, 2912, -2912, 2904, -2904, 2896, -2896,
+    2888, -2888, 2880, -2880, 2872, -2872, 2866, -2866, 2858, -2858, 2850, -2850, 2842, -2842, 2834, -2834,
+    2826, -2826, 2818, -2818, 2812, -2812, 2804, -2804, 2796, -2796, 2788, -2788, 2782, -2782, 2774, -2774,
+    2766, -2766, 2758, -2758, 2752, -2752, 2744, -2744, 2736, -2736, 2728, -2728, 2722, -2722, 2714, -2714,
+    2706, -2706, 2700, -2700, 2692, -2692, 2684, -2684, 2678, -2678, 2670, -2670, 2664, -2664, 2656, -2656,
+    2648, -2648, 2642, -2642, 2634, -2634, 2628, -2628, 2620, -2620, 2614, -2614, 2606, -2606, 2600, -2600,
+    2592, -2592, 2584, -2584, 2578, -2578, 2572, -2572, 2564, -2564, 2558, -2558, 2550, -2550, 2544, -2544,
+    2536, -2536, 2530, -2530, 2522, -2522, 2516, -2516, 2510, -2510, 2502, -2502, 2496, -2496, 2488, -2488,
+    2482, -2482, 2476, -2476, 2468, -2468, 2462, -2462, 2456, -2456, 2448, -2448, 2442, -2442, 2436, -2436,
+    2428, -2428, 2422, -2422, 2416, -2416, 2410, -2410, 2402, -2402, 2396, -2396, 2390, -2390, 2384, -2384,
+    2376, -2376, 2370, -2370, 2364, -2364, 2358, -2358, 2352, -2352, 2344, -2344, 2338, -2338, 2332, -2332,
+    2326, -2326, 2320, -2320, 2314, -2314, 2308, -2308, 2300, -2300, 2294, -2294, 2288, -2288, 2282, -2282,
+    2276, -2276, 2270, -2270, 2264, -2264, 2258, -2258, 2252, -2252, 2246, -2246, 2240, -2240, 2234, -2234,
+    2228, -2228, 2222, -2222, 2216, -2216, 2210, -2210, 2204, -2204, 2198, -2198, 2192, -2192, 2186, -2186,
+    2180, -2180, 2174, -2174, 2168, -2168, 2162, -2162, 2156, -2156, 2150, -2150, 2144, -2144, 2138, -2138,
+    2132, -2132, 2128, -2128, 2122, -2122, 2116, -2116, 2110, -2110, 2104, -2104, 2098, -2098, 2092, -2092,
+    2088, -2088, 2082, -2082, 2076, -2076, 2070, -2070, 2064, -2064, 2060, -2060, 2054, -2054, 2048, -2048,
+    2042, -2042, 2037, -2037, 2031, -2031, 2026, -2026, 2020, -2020, 2015, -2015, 2010, -2010, 2004, -2004,
+    1999, -1999, 1993, -1993, 1988, -1988, 1983, -1983, 1977, -1977, 1972, -1972, 1966, -1966, 1961, -1961,
+    1956, -1956, 1951, -1951, 1945, -1945, 1940, -1940, 1935, -1935, 1930, -1930, 1924, -1924, 1919, -1919,
+    1914, -1914, 1909, -1909, 1904, -1904, 1898, -1898, 1893, -1893, 1888, -1888, 1883, -1883, 1878, -1878,
+    1873, -1873, 1868, -1868, 1863, -1863, 1858, -1858, 1853, -1853, 1848, -1848, 1843, -1843, 1838, -1838,
+    1833, -1833, 1828, -1828, 1823, -1823, 1818, -1818, 1813, -1813, 1808, -1808, 1803, -1803, 1798, -1798,
+    1794, -1794, 1789, -1789, 1784, -1784, 1779, -1779, 1774, -1774, 1769, -1769, 1765, -1765, 1760, -1760,
+    1755, -1755, 1750, -1750, 1746, -1746, 1741, -1741, 1736, -1736, 1732, -1732, 1727, -1727, 1722, -1722,
+    1717, -1717, 1713, -1713, 1708, -1708, 1704, -1704, 1699, -1699, 1694, -1694, 1690, -1690, 1685, -1685,
+    1681, -1681, 1676, -1676, 1672, -1672, 1667, -1667, 1663, -1663, 1658, -1658, 1654, -1654, 1649, -1649,
+    1645, -1645, 1640, -1640, 1636, -1636, 1631, -1631, 1627, -1627, 1623, -1623, 1618, -1618, 1614, -1614,
+    1609, -1609, 1605, -1605, 1601, -1601, 1596, -1596, 1592, -1592, 1588, -1588, 1584, -1584, 1579, -1579,
+    1575, -1575, 1571, -1571, 1566, -1566, 1562, -1562, 1558, -1558, 1554, -1554, 1550, -1550, 1545, -1545,
+    1541, -1541, 1537, -1537, 1533, -1533, 1529, -1529, 1525, -1525, 1520, -1520, 1516, -1516, 1512, -1512,
+    1508, -1508, 1504, -1504, 1500, -1500, 1496, -1496, 1492, -1492, 1488, -1488, 1484, -1484, 1480, -1480,
+    1476, -1476, 1472, -1472, 1468, -1468, 1464, -1464, 1460, -1460, 1456, -1456, 1452, -1452, 1448, -1448,
+    1444, -1444, 1440, -1440, 1436, -1436, 1433, -1433, 1429, -1429, 1425, -1425, 1421, -1421, 1417, -1417,
+    1413, -1413, 1409, -1409, 1406, -1406, 1402, -1402, 1398, -1398, 1394, -1394, 1391, -1391, 1387, -1387,
+    1383, -1383, 1379, -1379, 1376, -1376, 1372, -1372, 1368, -1368, 1364, -1364, 1361, -1361, 1357, -1357,
+    1353, -1353, 1350, -1350, 1346, -1346, 1342, -1342, 1339, -1339, 1335, -1335, 1332, -1332, 1328, -1328,
+    1324, -1324, 1321, -1321, 1317, -1317, 1314, -1314, 1310, -1310, 1307, -1307, 1303, -1303, 1300, -1300,
+    1296, -1296, 1292, -1292, 1289, -1289, 1286, -1286, 1282, -1282, 1279, -1279, 1275, -1275, 1272, -1272,
+    1268, -1268, 1265, -1265, 1261, -1261, 1258, -1258, 1255, -1255, 1251, -1251, 1248, -1248, 1244, -1244,
+    1241, -1241, 1238, -1238, 1234, -1234, 1231, -1231, 1228, -1228, 1224, -1224, 1221, -1221, 1218, -1218,
+    1214, -1214, 1211, -1211, 1208, -1208, 1205, -1205, 1201, -1201, 1198, -1198, 1195, -1195, 1192, -1192,
+    1188, -1188, 1185, -1185, 1182, -1182, 1179, -1179, 1176, -1176, 1172, -1172, 1169, -1169, 1166, -1166,
+    1163, -1163, 1160, -1160, 1157, -1157, 1154, -1154, 1150, -1150, 1147, -1147, 1144, -1144, 1141, -1141,
+    1138, -1138, 1135, -1135, 1132, -1132, 1129, -1129, 1126, -1126, 1123, -1123, 1120, -1120, 1117, -1117,
+    1114, -1114, 1111, -1111, 1108, -1108, 1105, -1105, 1102, -1102, 1099, -1099, 1096, -1096, 1093, -1093,
+    1090, -1090, 1087, -1087, 1084, -1084, 1081, -1081, 1078, -1078, 1075, -1075, 1072, -1072, 1069, -1069,
+    1066, -1066, 1064, -1064, 1061, -1061, 1058, -1058, 1055, -1055, 1052, -1052, 1049, -1049, 1046, -1046,
+    1044, -1044, 1041, -1041, 1038, -1038, 1035, -1035, 1032, -1032, 1030, -1030, 1027, -1027, 1024, -1024,
+    1021, -1021, 1018, -1018, 1015, -1015, 1013, -1013, 1010, -1010, 1007, -1007, 1005, -1005, 1002, -1002,
+    999, -999, 996, -996, 994, -994, 991, -991, 988, -988, 986, -986, 983, -983, 980, -980,
+    978, -978, 975, -975, 972, -972, 970, -970, 967, -967, 965, -965, 962, -962, 959, -959,
+    957, -957, 954, -954, 952, -952, 949, -949, 946, -946, 944, -944, 941, -941, 939, -939,
+    936, -936, 934, -934, 931, -931, 929, -929, 926, -926, 924, -924, 921, -921, 919, -919,
+    916, -916, 914, -914, 911, -911, 909, -909, 906, -906, 904, -904, 901, -901, 899, -899,
+    897, -897, 894, -894, 892, -892, 889, -889, 887, -887, 884, -884, 882, -882, 880, -880,
+    877, -877, 875, -875, 873, -873, 870, -870, 868, -868, 866, -866, 863, -863, 861, -861,
+    858, -858, 856, -856, 854, -854, 852, -852, 849, -849, 847, -847, 845, -845, 842, -842,
+    840, -840, 838, -838, 836, -836, 833, -833, 831, -831, 829, -829, 827, -827, 824, -824,
+    822, -822, 820, -820, 818, -818, 815, -815, 813, -813, 811, -811, 809, -809, 807, -807,
+    804, -804, 802, -802, 800, -800, 798, -798, 796, -796, 794, -794, 792, -792, 789, -789,
+    787, -787, 785, -785, 783, -783, 781, -781, 779, -779, 777, -777, 775, -775, 772, -772,
+    770, -770, 768, -768, 766, -766, 764, -764, 762, -762, 760, -760, 758, -758, 756, -756,
+    754, -754, 752, -752, 750, -750, 748, -748, 746, -746, 744, -744, 742, -742, 740, -740,
+    738, -738, 736, -736, 734, -734, 732, -732, 730, -730, 728, -728, 726, -726, 724, -724,
+    722, -722, 720, -720, 718, -718, 716, -716, 714, -714, 712, -712, 710, -710, 708, -708,
+    706, -706, 704, -704, 703, -703, 701, -701, 699, -699, 697, -697, 695, -695, 693, -693,
+    691, -691, 689, -689, 688, -688, 686, -686, 684, -684, 682, -682, 680, -680, 678, -678,
+    676, -676, 675, -675, 673, -673, 671, -671, 669, -669, 667, -667, 666, -666, 664, -664,
+    662, -662, 660, -660, 658, -658, 657, -657, 655, -655, 653, -653, 651, -651, 650, -650,
+    648, -648, 646, -646, 644, -644, 643, -643, 641, -641, 639, -639, 637, -637, 636, -636,
+    634, -634, 632, -632, 630, -630, 629, -629, 627, -627, 625, -625, 624, -624, 622, -622,
+    620, -620, 619, -619, 617, -617, 615, -615, 614, -614, 612, -612, 610, -610, 609, -609,
+    607, -607, 605, -605, 604, -604, 602, -602, 600, -600, 599, -599, 597, -597, 596, -596,
+    594, -594, 592, -592, 591, -591, 589, -589, 588, -588, 586, -586, 584, -584, 583, -583,
+    581, -581, 580, -580, 578, -578, 577, -577, 575, -575, 573, -573, 572, -572, 570, -570,
+    569, -569, 567, -567, 566, -566, 564, -564, 563, -563, 561, -561, 560, -560, 558, -558,
+    557, -557, 555, -555, 554, -554, 552, -552, 551, -551, 549, -549, 548, -548, 546, -546,
+    545, -545, 543, -543, 542, -542, 540, -540, 539, -539, 537, -537, 536, -536, 534, -534,
+    533, -533, 532, -532, 530, -530, 529, -529, 527, -527, 526, -526, 524, -524, 523, -523,
+    522, -522, 520, -520, 519, -519, 517, -517, 516, -516, 515, -515, 513, -513, 512, -512,
+    510, -510, 509, -509, 507, -507, 506, -506, 505, -505, 503, -503, 502, -502, 501, -501,
+    499, -499, 498, -498, 497, -497, 495, -495, 494, -494, 493, -493, 491, -491, 490, -490,
+    489, -489, 487, -487, 486, -486, 485, -485, 483, -483, 482, -482, 481, -481, 479, -479,
+    478, -478, 477, -477, 476, -476, 474, -474, 473, -473, 472, -472, 470, -470, 469, -469,
+    468, -468, 467, -467, 465, -465, 464, -464, 463, -463, 462, -462, 460, -460, 459, -459,
+    458, -458, 457, -457, 455, -455, 454, -454, 453, -453, 452, -452, 450, -450, 449, -449,
+    448, -448, 447, -447, 446, -446, 444, -444, 443, -443, 442, -442, 441, -441, 440, -440,
+    438, -438, 437, -437, 436, -436, 435, -435, 434, -434, 433, -433, 431, -431, 430, -430,
+    429, -429, 428, -428, 427, -427, 426, -426, 424, -424, 423, -423, 422, -422, 421, -421,
+    420, -420, 419, -419, 418, -418, 416, -416, 415, -415, 414, -414, 413, -413, 412, -412,
+    411, -411, 410, -410, 409, -409, 407, -407, 406, -406, 405, -405, 404, -404, 403, -403,
+    402, -402, 401, -401, 400, -400, 399, -399, 398, -398, 397, -397, 396, -396, 394, -394,
+    393, -393, 392, -392, 391, -391, 390, -390, 389, -389, 388, -388, 387, -387, 386, -386,
+    385, -385, 384, -384, 383, -383, 382, -382, 381, -381, 380, -380, 379, -379, 378, -378,
+    377, -377, 376, -376, 375, -375, 374, -374, 373, -373, 372, -372, 371, -371, 370, -370,
+    369, -369, 368, -368, 367, -367, 366, -366, 365, -365, 364, -364, 363, -363, 362, -362,
+    361, -361, 360, -360, 359, -359, 358, -358, 357, -357, 356, -356, 355, -355, 354, -354,
+    353, -353, 352, -352, 351, -351, 350, -350, 349, -349, 348, -348, 347, -347, 346, -346,
+    345, -345, 344, -344, 344, -344, 343, -343, 342, -342, 341, -341, 340, -340, 339, -339,
+    338, -338, 337, -337, 336, -336, 335, -335, 334, -334, 333, -333, 333, -333, 332, -332,
+    331, -331, 330, -330, 329, -329, 328, -328, 327, -327, 326, -326, 325, -325, 325, -325,
+    324, -324, 323, -323, 322, -322, 321, -321, 320, -320, 319, -319, 318, -318, 318, -318,
+    317, -317, 316, -316, 315, -315, 314, -314, 313, -313, 312, -312, 312, -312, 311, -311,
+    310, -310, 309, -309, 308, -308, 307, -307, 307, -307, 306, -306, 305, -305, 304, -304,
+    303, -303, 302, -302, 302, -302, 301, -301, 300, -300, 299, -299, 298, -298, 298, -298,
+    297, -297, 296, -296, 295, -295, 294, -294, 294, -294, 293, -293, 292, -292, 291, -291,
+    290, -290, 290, -290, 289, -289, 288, -288, 287, -287, 286, -286, 286, -286, 285, -285,
+    284, -284, 283, -283, 283, -283, 282, -282, 281, -281, 280, -280, 280, -280, 279, -279,
+    278, -278, 277, -277, 277, -277, 276, -276, 275, -275, 274, -274, 274, -274, 273, -273,
+    272, -272, 271, -271, 271, -271, 270, -270, 269, -269, 268, -268, 268, -268, 267, -267,
+    266, -266, 266, -266, 265, -265, 264, -264, 263, -263, 263, -263, 262, -262, 261, -261,
+    261, -261, 260, -260, 259, -259, 258, -258, 258, -258, 257, -257, 256, -256, 256, -256,
+    255, -255, 254, -254, 253, -253, 253, -253, 252, -252, 251, -251, 251, -251, 250, -250,
+    249, -249, 249, -249, 248, -248, 247, -247, 247, -247, 246, -246, 245, -245, 245, -245,
+    244, -244, 243, -243, 243, -243, 242, -242, 241, -241, 241, -241, 240, -240, 239, -239,
+    239, -239, 238, -238, 238, -238, 237, -237, 236, -236, 236, -236, 235, -235, 234, -234,
+    234, -234, 233, -233, 232, -232, 232, -232, 231, -231, 231, -231, 230, -230, 229, -229,
+    229, -229, 228, -228, 227, -227, 227, -227, 226, -226, 226, -226, 225, -225, 224, -224,
+    224, -224, 223, -223, 223, -223, 222, -222, 221, -221, 221, -221, 220, -220, 220, -220,
+    219, -219, 218, -218, 218, -218, 217, -217, 217, -217, 216, -216, 215, -215, 215, -215,
+    214, -214, 214, -214, 213, -213, 213, -213, 212, -212, 211, -211, 211, -211, 210, -210,
+    210, -210, 209, -209, 209, -209, 208, -208, 207, -207, 207, -207, 206, -206, 206, -206,
+    205, -205, 205, -205, 204, -204, 203, -203, 203, -203, 202, -202, 202, -202, 201, -201,
+    201, -201, 200, -200, 200, -200, 199, -199, 199, -199, 198, -198, 198, -198, 197, -197,
+    196, -196, 196, -196, 195, -195, 195, -195, 194, -194, 194, -194, 193, -193, 193, -193,
+    192, -192, 192, -192, 191, -191, 191, -191, 190, -190, 190, -190, 189, -189, 189, -189,
+    188, -188, 188, -188, 187, -187, 187, -187, 186, -186, 186, -186, 185, -185, 185, -185,
+    184, -184, 184, -184, 183, -183, 183, -183, 182, -182, 182, -182, 181, -181, 181, -181,
+    180, -180, 180, -180, 179, -179, 179, -179, 178, -178, 178, -178, 177, -177, 177, -177,
+    176, -176, 176, -176, 175, -175, 175, -175, 174, -174, 174, -174, 173, -173, 173, -173,
+    172, -172, 172, -172, 172, -172, 171, -171, 171, -171, 170, -170, 170, -170, 169, -169,
+    169, -169, 168, -168, 168, -168, 167, -167, 167, -167, 166, -166, 166, -166, 166, -166,
+    165, -165, 165, -165, 164, -164, 164, -164, 163, -163, 163, -163, 162, -162, 162, -162,
+    162, -162, 161, -161, 161, -161, 160, -160, 160, -160, 159, -159, 159, -159, 159, -159,
+    158, -158, 158, -158, 157, -157, 157, -157, 156, -156, 156, -156, 156, -156, 155, -155,
+    155, -155, 154, -154, 154, -154, 153, -153, 153, -153, 153, -153, 152, -152, 152, -152,
+    151, -151, 151, -151, 151, -151, 150, -150, 150, -150, 149, -149, 149, -149, 149, -149,
+    148, -148, 148, -148, 147, -147, 147, -147, 147, -147, 146, -146, 146, -146, 145, -145,
+    145, -145, 145, -145, 144, -144, 144, -144, 143, -143, 143, -143, 143, -143, 142, -142,
+    142, -142, 141, -141, 141, -141, 141, -141, 140, -140, 140, -140, 140, -140, 139, -139,
+    139, -139, 138, -138, 138, -138, 138, -138, 137, -137, 137, -137, 137, -137, 136, -136,
+    136, -136, 135, -135, 135, -135, 135, -135, 134, -134, 134, -134, 134, -134, 133, -133,
+    133, -133, 133, -133, 132, -132, 132, -132, 131, -131, 131, -131, 131, -131, 130, -130,
+    130, -130, 130, -130, 129, -129, 129, -129, 129, -129, 128, -128, 128, -128, 128, -128,
+    127, -127, 127, -127, 126, -126, 126, -126, 126, -126, 125, -125, 125, -125, 125, -125,
+    124, -124, 124, -124, 124, -124, 123, -123, 123, -123, 123, -123, 122, -122, 122, -122,
+    122, -122, 121, -121, 121, -121, 121, -121, 120, -120, 120, -120, 120, -120, 119, -119,
+    119, -119, 119, -119, 119, -119, 118, -118, 118, -118, 118, -118, 117, -117, 117, -117,
+    117, -117, 116, -116, 116, -116, 116, -116, 115, -115, 115, -115, 115, -115, 114, -114,
+    114, -114, 114, -114, 113, -113, 113, -113, 113, -113, 113, -113, 112, -112, 112, -112,
+    112, -112, 111, -111, 111, -111, 111, -111, 110, -110, 110, -110, 110, -110, 110, -110,
+    109, -109, 109, -109, 109, -109, 108, -108, 108, -108, 108, -108, 107, -107, 107, -107,
+    107, -107, 107, -107, 106, -106, 106, -106, 106, -106, 105, -105, 105, -105, 105, -105,
+    105, -105, 104, -104, 104, -104, 104, -104, 103, -103, 103, -103, 103, -103, 103, -103,
+    102, -102, 102, -102, 102, -102, 101, -101, 101, -101, 101, -101, 101, -101, 100, -100,
+    100, -100, 100, -100, 100, -100, 99, -99, 99, -99, 99, -99, 99, -99, 98, -98,
+    98, -98, 98, -98, 97, -97, 97, -97, 97, -97, 97, -97, 96, -96, 96, -96,
+    96, -96, 96, -96, 95, -95, 95, -95, 95, -95, 95, -95, 94, -94, 94, -94,
+    94, -94, 94, -94, 93, -93, 93, -93, 93, -93, 93, -93, 92, -92, 92, -92,
+    92, -92, 92, -92, 91, -91, 91, -91, 91, -91, 91, -91, 90, -90, 90, -90,
+    90, -90, 90, -90, 89, -89, 89, -89, 89, -89, 89, -89, 88, -88, 88, -88,
+    88, -88, 88, -88, 87, -87, 87, -87, 87, -87, 87, -87, 86, -86, 86, -86,
+    86, -86, 86, -86, 86, -86, 85, -85, 85, -85, 85, -85, 85, -85, 84, -84,
+    84, -84, 84, -84, 84, -84, 83, -83, 83, -83, 83, -83, 83, -83, 83, -83,
+    82, -82, 82, -82, 82, -82, 82, -82, 81, -81, 81, -81, 81, -81, 81, -81,
+    81, -81, 80, -80, 80, -80, 80, -80, 80, -80, 79, -79, 79, -79, 79, -79,
+    79, -79, 79, -79, 78, -78, 78, -78, 78, -78, 78, -78, 78, -78, 77, -77,
+    77, -77, 77, -77, 77, -77, 76, -76, 76, -76, 76, -76, 76, -76, 76, -76,
+    75, -75, 75, -75, 75, -75, 75, -75, 75, -75, 74, -74, 74, -74, 74, -74,
+    74, -74, 74, -74, 73, -73, 73, -73, 73, -73, 73, -73, 73, -73, 72, -72,
+    72, -72, 72, -72, 72, -72, 72, -72, 71, -71, 71, -71, 71, -71, 71, -71,
+    71, -71, 70, -70, 70, -70, 70, -70, 70, -70, 70, -70, 70, -70, 69, -69,
+    69, -69, 69, -69, 69, -69, 69, -69, 68, -68, 68, -68, 68, -68, 68, -68,
+    68, -68, 67, -67, 67, -67, 67, -67, 67, -67, 67, -67, 67, -67, 66, -66,
+    66, -66, 66, -66, 66, -66, 66, -66, 65, -65, 65, -65, 65, -65, 65, -65,
+    65, -65, 65, -65, 64, -64, 64, -64, 64, -64, 64, -64, 64, -64, 64, -64,
+    63, -63, 63, -63, 63, -63, 63, -63, 63, -63, 62, -62, 62, -62, 62, -62,
+    62, -62, 62, -62, 62, -62, 61, -61, 61, -61, 61, -61, 61, -61, 61, -61,
+    61, -61, 60, -60, 60, -60, 60, -60, 60, -60, 60, -60, 60, -60, 59, -59,
+    59, -59, 59, -59, 59, -59, 59, -59, 59, -59, 59, -59, 58, -58, 58, -58,
+    58, -58, 58, -58, 58, -58, 58, -58, 57, -57, 57, -57, 57, -57, 57, -57,
+    57, -57, 57, -57, 56, -56, 56, -56, 56, -56, 56, -56, 56, -56, 56, -56,
+    56, -56, 55, -55, 55, -55, 55, -55, 55, -55, 55, -55, 55, -55, 55, -55,
+    54, -54, 54, -54, 54, -54, 54, -54, 54, -54, 54, -54, 53, -53, 53, -53,
+    53, -53, 53, -53, 53, -53, 53, -53, 53, -53, 52, -52, 52, -52, 52, -52,
+    52, -52, 52, -52, 52, -52, 52, -52, 51, -51, 51, -51, 51, -51, 51, -51,
+    51, -51, 51, -51, 51, -51, 50, -50, 50, -50, 50, -50, 50, -50, 50, -50,
+    50, -50, 50, -50, 50, -50, 49, -49, 49, -49, 49, -49, 49, -49, 49, -49,
+    49, -49, 49, -49, 48, -48, 48, -48, 48, -48, 48, -48, 48, -48, 48, -48,
+    48, -48, 48, -48, 47, -47, 47, -47, 47, -47, 47, -47, 47, -47, 47, -47,
+    47, -47, 47, -47, 46, -46, 46, -46, 46, -46, 46, -46, 46, -46, 46, -46,
+    46, -46, 46, -46, 45, -45, 45, -45, 45, -45, 45, -45, 45, -45, 45, -45,
+    45, -45, 45, -45, 44, -44, 44, -44, 44, -44, 44, -44, 44, -44, 44, -44,
+    44, -44, 44, -44, 43, -43, 43, -43, 43, -43, 43, -43, 43, -43, 43, -43,
+    43, -43, 43, -43, 43, -43, 42, -42, 42, -42, 42, -42, 42, -42, 42, -42,
+    42, -42, 42, -42, 42, -42, 41, -41, 41, -41, 41, -41, 41, -41, 41, -41,
+    41, -41, 41, -41, 41, -41, 41, -41, 40, -40, 40, -40, 40, -40, 40, -40,
+    40, -40, 40, -40, 40, -40, 40, -40, 40, -40, 39, -39, 39, -39, 39, -39,
+    39, -39, 39, -39, 39, -39, 39, -39, 39, -39, 39, -39, 39, -39, 38, -38,
+    38, -38, 38, -38, 38, -38, 38, -38, 38, -38, 38, -38, 38, -38, 38, -38,
+    37, -37, 37, -37, 37, -37, 37, -37, 37, -37, 37, -37, 37, -37, 37, -37,
+    37, -37, 37, -37, 36, -36, 36, -36, 36, -36, 36, -36, 36, -36, 36, -36,
+    36, -36, 36, -36, 36, -36, 36, -36, 35, -35, 35, -35, 35, -35, 35, -35,
+    35, -35, 35, -35, 35, -35, 35, -35, 35, -35, 35, -35, 35, -35, 34, -34,
+    34, -34, 34, -34, 34, -34, 34, -34, 34, -34, 34, -34, 34, -34, 34, -34,
+    34, -34, 33, -33, 33, -33, 33, -33, 33, -33, 33, -33, 33, -33, 33, -33,
+    33, -33, 33, -33, 33, -33, 33, -33, 32, -32, 32, -32, 32, -32, 32, -32,
+    32, -32, 32, -32, 32, -32, 32, -32, 32, -32, 32, -32, 32, -32, 32, -32,
+    31, -31, 31, -31, 31, -31, 31, -31, 31, -31, 31, -31, 31, -31, 31, -31,
+    31, -31, 31, -31, 31, -31, 30, -30, 30, -30, 30, -30, 30, -30, 30, -30,
+    30, -30, 30, -30, 30, -30, 30, -30, 30, -30, 30, -30, 30, -30, 29, -29,
+    29, -29, 29, -29, 29, -29, 29, -29, 29, -29, 29, -29, 29, -29, 29, -29,
+    29, -29, 29, -29, 29, -29, 29, -29, 28, -28, 28, -28, 28, -28, 28, -28,
+    28, -28, 28, -28, 28, -28, 28, -28, 28, -28, 28, -28, 28, -28, 28, -28,
+    28, -28, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27,
+    27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 26, -26, 26, -26,
+    26, -26, 26, -26, 26, -26, 26, -26, 26, -26, 26, -26, 26, -26, 26, -26,
+    26, -26, 26, -26, 26, -26, 26, -26, 25, -25, 25, -25, 25, -25, 25, -25,
+    25, -25, 25, -25, 25, -25, 25, -25, 25, -25, 25, -25, 25, -25, 25, -25,
+    25, -25, 25, -25, 25, -25, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24,
+    24, -24, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24,
+    24, -24, 24, -24, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23,
+    23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23,
+    23, -23, 23, -23, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22,
+    22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22,
+    22, -22, 22, -22, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21,
+    21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21,
+    21, -21, 21, -21, 21, -21, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20,
+    20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20,
+    20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 19, -19, 19, -19, 19, -19,
+    19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19,
+    19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19,
+    18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18,
+    18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18,
+    18, -18, 18, -18, 18, -18, 18, -18, 17, -17, 17, -17, 17, -17, 17, -17,
+    17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17,
+    17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17,
+    17, -17, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16,
+    16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16,
+    16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16,
+    15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15,
+    15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15,
+    15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 14, -14,
+    14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14,
+    14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14,
+    14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14,
+    14, -14, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13,
+    13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13,
+    13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13,
+    13, -13, 13, -13, 13, -13, 13, -13, 12, -12, 12, -12, 12, -12, 12, -12,
+    12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12,
+    12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12,
+    12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12,
+    12, -12, 12, -12, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+    11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+    11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+    11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+    11, -11, 11, -11, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+    10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+    10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+    10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+    10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 9, -9, 9, -9, 9, -9,
+    9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+    9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+    9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+    9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+    9, -9, 9, -9, 9, -9, 9, -9, 8, -8, 8, -8, 8, -8, 8, -8,
+    8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+    8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+    8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+    8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+    8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+    7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+    7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+    7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+    7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+    7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+    7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+    7, -7, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+    6, -6, 6, -6, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+    5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+    3, -3, 3, -3, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1
+};
+
+/* sin waveform table in 'decibel' scale */
+static const unsigned int sin_tab[SIN_LEN] =
+{
+    4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+    1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+    1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+    906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+    704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+    552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+    430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+    334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+    254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+    188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+    134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+    92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+    58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+    32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+    14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+    4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+    4, 4, 4, 6, 6, 6, 8, 8, 8, 10, 10, 10, 12, 12, 14, 14,
+    14, 16, 16, 18, 18, 20, 20, 22, 24, 24, 26, 26, 28, 30, 30, 32,
+    34, 34, 36, 38, 40, 40, 42, 44, 46, 46, 48, 50, 52, 54, 56, 58,
+    60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 90, 92,
+    94, 96, 98, 102, 104, 106, 110, 112, 114, 118, 120, 124, 126, 128, 132, 134,
+    138, 140, 144, 148, 150, 154, 156, 160, 164, 166, 170, 174, 178, 182, 184, 188,
+    192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 250, 254,
+    258, 262, 268, 272, 276, 282, 286, 292, 296, 302, 306, 312, 318, 322, 328, 334,
+    338, 344, 350, 356, 362, 368, 374, 380, 386, 392, 398, 404, 410, 418, 424, 430,
+    438, 444, 452, 458, 466, 472, 480, 488, 496, 502, 510, 518, 526, 534, 542, 552,
+    560, 568, 578, 586, 594, 604, 614, 622, 632, 642, 652, 662, 672, 682, 694, 704,
+    716, 726, 738, 750, 760, 772, 784, 798, 810, 822, 836, 850, 864, 878, 892, 906,
+    922, 936, 952, 968, 984, 1002, 1018, 1036, 1054, 1072, 1092, 1112, 1132, 1152, 1174, 1196,
+    1218, 1242, 1266, 1292, 1318, 1344, 1374, 1402, 1434, 1464, 1498, 1534, 1570, 1608, 1650, 1692,
+    1738, 1788, 1840, 1898, 1958, 2026, 2100, 2182, 2274, 2380, 2504, 2652, 2838, 3086, 3462, 4274,
+    4275, 3463, 3087, 2839, 2653, 2505, 2381, 2275, 2183, 2101, 2027, 1959, 1899, 1841, 1789, 1739,
+    1693, 1651, 1609, 1571, 1535, 1499, 1465, 1435, 1403, 1375, 1345, 1319, 1293, 1267, 1243, 1219,
+    1197, 1175, 1153, 1133, 1113, 1093, 1073, 1055, 1037, 1019, 1003, 985, 969, 953, 937, 923,
+    907, 893, 879, 865, 851, 837, 823, 811, 799, 785, 773, 761, 751, 739, 727, 717,
+    705, 695, 683, 673, 663, 653, 643, 633, 623, 615, 605, 595, 587, 579, 569, 561,
+    553, 543, 535, 527, 519, 511, 503, 497, 489, 481, 473, 467, 459, 453, 445, 439,
+    431, 425, 419, 411, 405, 399, 393, 387, 381, 375, 369, 363, 357, 351, 345, 339,
+    335, 329, 323, 319, 313, 307, 303, 297, 293, 287, 283, 277, 273, 269, 263, 259,
+    255, 251, 245, 241, 237, 233, 229, 225, 221, 217, 213, 209, 205, 201, 197, 193,
+    189, 185, 183, 179, 175, 171, 167, 165, 161, 157, 155, 151, 149, 145, 141, 139,
+    135, 133, 129, 127, 125, 121, 119, 115, 113, 111, 107, 105, 103, 99, 97, 95,
+    93, 91, 87, 85, 83, 81, 79, 77, 75, 73, 71, 69, 67, 65, 63, 61,
+    59, 57, 55, 53, 51, 49, 47, 47, 45, 43, 41, 41, 39, 37, 35, 35,
+    33, 31, 31, 29, 27, 27, 25, 25, 23, 21, 21, 19, 19, 17, 17, 15,
+    15, 15, 13, 13, 11, 11, 11, 9, 9, 9, 7, 7, 7, 5, 5, 5,
+    5, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 5,
+    5, 5, 5, 7, 7, 7, 9, 9, 9, 11, 11, 11, 13, 13, 15, 15,
+    15, 17, 17, 19, 19, 21, 21, 23, 25, 25, 27, 27, 29, 31, 31, 33,
+    35, 35, 37, 39, 41, 41, 43, 45, 47, 47, 49, 51, 53, 55, 57, 59,
+    61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 91, 93,
+    95, 97, 99, 103, 105, 107, 111, 113, 115, 119, 121, 125, 127, 129, 133, 135,
+    139, 141, 145, 149, 151, 155, 157, 161, 165, 167, 171, 175, 179, 183, 185, 189,
+    193, 197, 201, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241, 245, 251, 255,
+    259, 263, 269, 273, 277, 283, 287, 293, 297, 303, 307, 313, 319, 323, 329, 335,
+    339, 345, 351, 357, 363, 369, 375, 381, 387, 393, 399, 405, 411, 419, 425, 431,
+    439, 445, 453, 459, 467, 473, 481, 489, 497, 503, 511, 519, 527, 535, 543, 553,
+    561, 569, 579, 587, 595, 605, 615, 623, 633, 643, 653, 663, 673, 683, 695, 705,
+    717, 727, 739, 751, 761, 773, 785, 799, 811, 823, 837, 851, 865, 879, 893, 907,
+    923, 937, 953, 969, 985, 1003, 1019, 1037, 1055, 1073, 1093, 1113, 1133, 1153, 1175, 1197,
+    1219, 1243, 1267, 1293, 1319, 1345, 1375, 1403, 1435, 1465, 1499, 1535, 1571, 1609, 1651, 1693,
+    1739, 1789, 1841, 1899, 1959, 2027, 2101, 2183, 2275, 2381, 2505, 2653, 2839, 3087, 3463, 4275
+};
+
+/* translate from D1L to volume index (16 D1L levels) */
+static const uint32_t d1l_tab[16] =
+{
+    0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 992
+};
+
+/* ----------------------------------------------------------------------------
+   Chip tables for YM2151_TABLES_CLOCK and YM2151_TABLES_RATE
+   ----------------------------------------------------------------------------*/
+
+/* 11 octaves, 768 'cents' per octave */
+static const uint32_t freq_default[11*768] =
+{
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300, 0x00007300,
+    0x00007300, 0x00007300, 0x00007300, 0x00007340, 0x00007340, 0x00007380, 0x00007380, 0x00007380,
+    0x000073c0, 0x000073c0, 0x00007400, 0x00007400, 0x00007440, 0x00007440, 0x00007440, 0x00007480,
+    0x00007480, 0x000074c0, 0x000074c0, 0x00007500, 0x00007500, 0x00007500, 0x00007540, 0x00007540,
+    0x00007580, 0x00007580, 0x00007580, 0x000075c0, 0x000075c0, 0x00007600, 0x00007600, 0x00007640,
+    0x00007640, 0x00007680, 0x00007680, 0x00007680, 0x000076c0, 0x000076c0, 0x000076c0, 0x00007700,
+    0x00007700, 0x00007740, 0x00007740, 0x00007740, 0x00007780, 0x000077c0, 0x000077c0, 0x000077c0,
+    0x00007800, 0x00007800, 0x00007840, 0x00007840, 0x00007880, 0x00007880, 0x00007880, 0x000078c0,
+    0x000078c0, 0x00007900, 0x00007900, 0x00007940, 0x00007940, 0x00007980, 0x00007980, 0x00007980,
+    0x000079c0, 0x000079c0, 0x00007a00, 0x00007a00, 0x00007a40, 0x00007a40, 0x00007a80, 0x00007a80,
+    0x00007ac0, 0x00007ac0, 0x00007ac0, 0x00007b00, 0x00007b00, 0x00007b40, 0x00007b40, 0x00007b40,
+    0x00007b80, 0x00007b80, 0x00007bc0, 0x00007bc0, 0x00007c00, 0x00007c00, 0x00007c40, 0x00007c40,
+    0x00007c80, 0x00007c80, 0x00007c80, 0x00007cc0, 0x00007cc0, 0x00007d00, 0x00007d00, 0x00007d00,
+    0x00007d40, 0x00007d80, 0x00007d80, 0x00007d80, 0x00007dc0, 0x00007dc0, 0x00007e00, 0x00007e00,
+    0x00007e40, 0x00007e40, 0x00007e80, 0x00007e80, 0x00007ec0, 0x00007ec0, 0x00007f00, 0x00007f00,
+    0x00007f40, 0x00007f40, 0x00007f40, 0x00007f80, 0x00007f80, 0x00007fc0, 0x00007fc0, 0x00007fc0,
+    0x00008000, 0x00008040, 0x00008040, 0x00008040, 0x00008080, 0x00008080, 0x000080c0, 0x000080c0,
+    0x00008100, 0x00008100, 0x00008140, 0x00008140, 0x00008180, 0x00008180, 0x000081c0, 0x000081c0,
+    0x00008200, 0x00008200, 0x00008240, 0x00008240, 0x00008240, 0x00008280, 0x00008280, 0x000082c0,
+    0x00008300, 0x00008300, 0x00008300, 0x00008340, 0x00008340, 0x00008380, 0x00008380, 0x00008380,
+    0x000083c0, 0x000083c0, 0x00008400, 0x00008400, 0x00008440, 0x00008440, 0x00008480, 0x00008480,
+    0x000084c0, 0x00008500, 0x00008500, 0x00008500, 0x00008540, 0x00008540, 0x00008580, 0x000085c0,
+    0x000085c0, 0x00008600, 0x00008600, 0x00008600, 0x00008640, 0x00008640, 0x00008680, 0x00008680,
+    0x000086c0, 0x000086c0, 0x00008700, 0x00008700, 0x00008740, 0x00008740, 0x00008780, 0x00008780,
+    0x000087c0, 0x000087c0, 0x00008800, 0x00008800, 0x00008840, 0x00008840, 0x00008880, 0x00008880,
+    0x000088c0, 0x000088c0, 0x00008900, 0x00008900, 0x00008940, 0x00008940, 0x00008980, 0x00008980,
+    0x000089c0, 0x000089c0, 0x00008a00, 0x00008a00, 0x00008a40, 0x00008a40, 0x00008a80, 0x00008a80,
+    0x00008ac0, 0x00008ac0, 0x00008ac0, 0x00008b00, 0x00008b00, 0x00008b40, 0x00008b80, 0x00008b80,
+    0x00008bc0, 0x00008bc0, 0x00008bc0, 0x00008c00, 0x00008c00, 0x00008c40, 0x00008c40, 0x00008c80,
+    0x00008cc0, 0x00008cc0, 0x00008d00, 0x00008d00, 0x00008d40, 0x00008d40, 0x00008d80, 0x00008d80,
+    0x00008dc0, 0x00008dc0, 0x00008e00, 0x00008e00, 0x00008e40, 0x00008e40, 0x00008e80, 0x00008e80,
+    0x00008ec0, 0x00008ec0, 0x00008f00, 0x00008f00, 0x00008f40, 0x00008f40, 0x00008f80, 0x00008f80,
+    0x00008fc0, 0x00008fc0, 0x00009000, 0x00009000, 0x00009040, 0x00009040, 0x00009080, 0x00009080,
+    0x00009100, 0x00009100, 0x00009100, 0x00009140, 0x00009140, 0x00009180, 0x00009180, 0x000091c0,
+    0x000091c0, 0x00009200, 0x00009200, 0x00009240, 0x00009280, 0x00009280, 0x00009280, 0x000092c0,
+    0x00009300, 0x00009300, 0x00009340, 0x00009340, 0x00009380, 0x00009380, 0x000093c0, 0x000093c0,
+    0x00009400, 0x00009400, 0x00009440, 0x00009440, 0x00009480, 0x00009480, 0x000094c0, 0x000094c0,
+    0x00009540, 0x00009540, 0x00009580, 0x00009580, 0x000095c0, 0x000095c0, 0x00009600, 0x00009600,
+    0x00009640, 0x00009640, 0x00009680, 0x00009680, 0x000096c0, 0x000096c0, 0x00009700, 0x00009700,
+    0x00009740, 0x00009740, 0x00009780, 0x00009780, 0x000097c0, 0x000097c0, 0x00009800, 0x00009840,
+    0x00009840, 0x00009880, 0x00009880, 0x000098c0, 0x000098c0, 0x00009900, 0x00009900, 0x00009940,
+    0x00009980, 0x00009980, 0x000099c0, 0x000099c0, 0x00009a00, 0x00009a00, 0x00009a40, 0x00009a40,
+    0x00009a80, 0x00009ac0, 0x00009ac0, 0x00009b00, 0x00009b00, 0x00009b40, 0x00009b40, 0x00009b80,
+    0x00009bc0, 0x00009bc0, 0x00009c00, 0x00009c00, 0x00009c40, 0x00009c40, 0x00009c80, 0x00009c80,
+    0x00009cc0, 0x00009d00, 0x00009d00, 0x00009d40, 0x00009d40, 0x00009d80, 0x00009d80, 0x00009dc0,
+    0x00009e00, 0x00009e00, 0x00009e40, 0x00009e40, 0x00009e80, 0x00009ec0, 0x00009ec0, 0x00009f00,
+    0x00009f40, 0x00009f40, 0x00009f80, 0x00009f80, 0x00009fc0, 0x00009fc0, 0x0000a000, 0x0000a000,
+    0x0000a040, 0x0000a080, 0x0000a080, 0x0000a0c0, 0x0000a0c0, 0x0000a100, 0x0000a100, 0x0000a140,
+    0x0000a180, 0x0000a180, 0x0000a1c0, 0x0000a1c0, 0x0000a200, 0x0000a240, 0x0000a240, 0x0000a280,
+    0x0000a280, 0x0000a2c0, 0x0000a2c0, 0x0000a300, 0x0000a300, 0x0000a340, 0x0000a380, 0x0000a380,
+    0x0000a3c0, 0x0000a3c0, 0x0000a400, 0x0000a400, 0x0000a440, 0x0000a480, 0x0000a480, 0x0000a4c0,
+    0x0000a500, 0x0000a500, 0x0000a540, 0x0000a540, 0x0000a580, 0x0000a5c0, 0x0000a5c0, 0x0000a600,
+    0x0000a640, 0x0000a640, 0x0000a680, 0x0000a680, 0x0000a6c0, 0x0000a6c0, 0x0000a700, 0x0000a700,
+    0x0000a740, 0x0000a780, 0x0000a7c0, 0x0000a7c0, 0x0000a800, 0x0000a800, 0x0000a840, 0x0000a840,
+    0x0000a880, 0x0000a8c0, 0x0000a8c0, 0x0000a900, 0x0000a940, 0x0000a940, 0x0000a980, 0x0000a980,
+    0x0000a9c0, 0x0000a9c0, 0x0000aa00, 0x0000aa40, 0x0000aa80, 0x0000aa80, 0x0000aac0, 0x0000aac0,
+    0x0000ab00, 0x0000ab00, 0x0000ab40, 0x0000ab80, 0x0000abc0, 0x0000abc0, 0x0000ac00, 0x0000ac00,
+    0x0000ac40, 0x0000ac40, 0x0000ac80, 0x0000acc0, 0x0000acc0, 0x0000ad00, 0x0000ad40, 0x0000ad40,
+    0x0000ad80, 0x0000ad80, 0x0000adc0, 0x0000ae00, 0x0000ae00, 0x0000ae40, 0x0000ae40, 0x0000ae80,
+    0x0000aec0, 0x0000af00, 0x0000af00, 0x0000af40, 0x0000af80, 0x0000af80, 0x0000afc0, 0x0000b000,
+    0x0000b000, 0x0000b040, 0x0000b040, 0x0000b080, 0x0000b0c0, 0x0000b0c0, 0x0000b100, 0x0000b100,
+    0x0000b140, 0x0000b180, 0x0000b180, 0x0000b1c0, 0x0000b200, 0x0000b200, 0x0000b240, 0x0000b240,
+    0x0000b280, 0x0000b2c0, 0x0000b300, 0x0000b300, 0x0000b340, 0x0000b340, 0x0000b380, 0x0000b380,
+    0x0000b3c0, 0x0000b400, 0x0000b440, 0x0000b440, 0x0000b480, 0x0000b4c0, 0x0000b4c0, 0x0000b500,
+    0x0000b540, 0x0000b540, 0x0000b580, 0x0000b5c0, 0x0000b5c0, 0x0000b600, 0x0000b640, 0x0000b640,
+    0x0000b680, 0x0000b680, 0x0000b6c0, 0x0000b700, 0x0000b740, 0x0000b740, 0x0000b780, 0x0000b780,
+    0x0000b7c0, 0x0000b800, 0x0000b800, 0x0000b840, 0x0000b880, 0x0000b8c0, 0x0000b8c0, 0x0000b900,
+    0x0000b940, 0x0000b940, 0x0000b980, 0x0000b980, 0x0000b9c0, 0x0000ba00, 0x0000ba40, 0x0000ba40,
+    0x0000ba80, 0x0000ba80, 0x0000bac0, 0x0000bb00, 0x0000bb40, 0x0000bb40, 0x0000bb80, 0x0000bb80,
+    0x0000bbc0, 0x0000bc00, 0x0000bc00, 0x0000bc40, 0x0000bc80, 0x0000bcc0, 0x0000bcc0, 0x0000bd00,
+    0x0000bd40, 0x0000bd40, 0x0000bd80, 0x0000bd80, 0x0000bdc0, 0x0000be00, 0x0000be40, 0x0000be40,
+    0x0000be80, 0x0000bec0, 0x0000bec0, 0x0000bf00, 0x0000bf40, 0x0000bf80, 0x0000bf80, 0x0000bfc0,
+    0x0000c000, 0x0000c000, 0x0000c040, 0x0000c040, 0x0000c080, 0x0000c0c0, 0x0000c100, 0x0000c100,
+    0x0000c180, 0x0000c180, 0x0000c1c0, 0x0000c1c0, 0x0000c200, 0x0000c240, 0x0000c280, 0x0000c280,
+    0x0000c2c0, 0x0000c300, 0x0000c300, 0x0000c340, 0x0000c380, 0x0000c380, 0x0000c3c0, 0x0000c400,
+    0x0000c440, 0x0000c440, 0x0000c480, 0x0000c4c0, 0x0000c4c0, 0x0000c500, 0x0000c540, 0x0000c580,
+    0x0000c580, 0x0000c5c0, 0x0000c600, 0x0000c600, 0x0000c640, 0x0000c680, 0x0000c680, 0x0000c6c0,
+    0x0000c700, 0x0000c740, 0x0000c780, 0x0000c780, 0x0000c7c0, 0x0000c800, 0x0000c800, 0x0000c840,
+    0x0000c880, 0x0000c8c0, 0x0000c8c0, 0x0000c900, 0x0000c900, 0x0000c980, 0x0000c980, 0x0000c9c0,
+    0x0000ca00, 0x0000ca00, 0x0000ca40, 0x0000ca80, 0x0000ca80, 0x0000cac0, 0x0000cb00, 0x0000cb40,
+    0x0000cb40, 0x0000cb80, 0x0000cbc0, 0x0000cbc0, 0x0000cc00, 0x0000cc40, 0x0000cc40, 0x0000cc80,
+    0x0000cd00, 0x0000cd00, 0x0000cd40, 0x0000cd80, 0x0000cd80, 0x0000cdc0, 0x0000ce00, 0x0000ce40,
+    0x0000ce40, 0x0000ce80, 0x0000cec0, 0x0000cf00, 0x0000cf00, 0x0000cf40, 0x0000cf40, 0x0000cf80,
+    0x0000cfc0, 0x0000d000, 0x0000d040, 0x0000d080, 0x0000d080, 0x0000d0c0, 0x0000d0c0, 0x0000d100,
+    0x0000d140, 0x0000d180, 0x0000d1c0, 0x0000d1c0, 0x0000d200, 0x0000d240, 0x0000d240, 0x0000d280,
+    0x0000d2c0, 0x0000d300, 0x0000d340, 0x0000d380, 0x0000d380, 0x0000d3c0, 0x0000d3c0, 0x0000d400,
+    0x0000d440, 0x0000d480, 0x0000d4c0, 0x0000d4c0, 0x0000d500, 0x0000d540, 0x0000d580, 0x0000d5c0,
+    0x0000d600, 0x0000d640, 0x0000d640, 0x0000d680, 0x0000d680, 0x0000d6c0, 0x0000d700, 0x0000d740,
+    0x0000d780, 0x0000d780, 0x0000d7c0, 0x0000d800, 0x0000d840, 0x0000d880, 0x0000d880, 0x0000d8c0,
+    0x0000d900, 0x0000d940, 0x0000d980, 0x0000d980, 0x0000d9c0, 0x0000da00, 0x0000da00, 0x0000da40,
+    0x0000da80, 0x0000dac0, 0x0000dac0, 0x0000db00, 0x0000db40, 0x0000db80, 0x0000dbc0, 0x0000dc00,
+    0x0000dc40, 0x0000dc80, 0x0000dc80, 0x0000dcc0, 0x0000dcc0, 0x0000dd40, 0x0000dd40, 0x0000dd80,
+    0x0000ddc0, 0x0000ddc0, 0x0000de00, 0x0000de40, 0x0000de80, 0x0000dec0, 0x0000dec0, 0x0000df00,
+    0x0000df80, 0x0000df80, 0x0000dfc0, 0x0000e000, 0x0000e000, 0x0000e040, 0x0000e080, 0x0000e0c0,
+    0x0000e0c0, 0x0000e100, 0x0000e140, 0x0000e180, 0x0000e1c0, 0x0000e200, 0x0000e200, 0x0000e240,
+    0x0000e2c0, 0x0000e300, 0x0000e300, 0x0000e340, 0x0000e340, 0x0000e380, 0x0000e3c0, 0x0000e400,
+    0x0000e440, 0x0000e440, 0x0000e480, 0x0000e4c0, 0x0000e500, 0x0000e540, 0x0000e540, 0x0000e580,
+    0x0000e600, 0x0000e640, 0x0000e640, 0x0000e680, 0x0000e6c0, 0x0000e700, 0x0000e700, 0x0000e740,
+    0x0000e780, 0x0000e7c0, 0x0000e800, 0x0000e800, 0x0000e880, 0x0000e8c0, 0x0000e8c0, 0x0000e900,
+    0x0000e940, 0x0000e980, 0x0000e9c0, 0x0000ea00, 0x0000ea00, 0x0000ea40, 0x0000ea80, 0x0000ea80,
+    0x0000eb00, 0x0000eb40, 0x0000eb40, 0x0000eb80, 0x0000ebc0, 0x0000ec00, 0x0000ec40, 0x0000ec80,
+    0x0000ecc0, 0x0000ed00, 0x0000ed00, 0x0000ed40, 0x0000ed80, 0x0000ed80, 0x0000edc0, 0x0000ee00,
+    0x0000ee40, 0x0000ee80, 0x0000eec0, 0x0000eec0, 0x0000ef40, 0x0000ef80, 0x0000ef80, 0x0000efc0,
+    0x0000f000, 0x0000f040, 0x0000f080, 0x0000f0c0, 0x0000f100, 0x0000f140, 0x0000f140, 0x0000f180,
+    0x0000f1c0, 0x0000f200, 0x0000f240, 0x0000f280, 0x0000f2c0, 0x0000f300, 0x0000f300, 0x0000f340,
+    0x0000f3c0, 0x0000f3c0, 0x0000f400, 0x0000f440, 0x0000f480, 0x0000f4c0, 0x0000f500, 0x0000f500,
+    0x0000f580, 0x0000f580, 0x0000f5c0, 0x0000f600, 0x0000f640, 0x0000f680, 0x0000f6c0, 0x0000f6c0,
+    0x0000f740, 0x0000f740, 0x0000f780, 0x0000f7c0, 0x0000f800, 0x0000f840, 0x0000f880, 0x0000f880,
+    0x0000f900, 0x0000f940, 0x0000f940, 0x0000f980, 0x0000f9c0, 0x0000fa00, 0x0000fa40, 0x0000fa40,
+    0x0000fac0, 0x0000fb00, 0x0000fb00, 0x0000fb40, 0x0000fb80, 0x0000fbc0, 0x0000fc00, 0x0000fc40,
+    0x0000fc80, 0x0000fcc0, 0x0000fd00, 0x0000fd40, 0x0000fd80, 0x0000fd80, 0x0000fe00, 0x0000fe00,
+    0x0000fe80, 0x0000fe80, 0x0000fec0, 0x0000ff00, 0x0000ff40, 0x0000ff80, 0x0000ffc0, 0x0000ffc0,
+    0x00010040, 0x00010080, 0x00010080, 0x000100c0, 0x00010100, 0x00010140, 0x00010180, 0x000101c0,
+    0x00010240, 0x00010240, 0x00010280, 0x000102c0, 0x00010300, 0x00010340, 0x00010380, 0x00010380,
+    0x00010400, 0x00010400, 0x00010480, 0x000104c0, 0x000104c0, 0x00010500, 0x00010540, 0x00010580,
+    0x00010600, 0x00010600, 0x00010640, 0x00010680, 0x000106c0, 0x00010700, 0x00010740, 0x00010740,
+    0x000107c0, 0x000107c0, 0x00010840, 0x00010840, 0x00010880, 0x000108c0, 0x00010900, 0x00010940,
+    0x000109c0, 0x00010a00, 0x00010a40, 0x00010a40, 0x00010ac0, 0x00010ac0, 0x00010b40, 0x00010b80,
+    0x00010bc0, 0x00010c00, 0x00010c00, 0x00010c40, 0x00010c80, 0x00010cc0, 0x00010d40, 0x00010d40,
+    0x00010dc0, 0x00010dc0, 0x00010e00, 0x00010e40, 0x00010e80, 0x00010ec0, 0x00010f00, 0x00010f40,
+    0x00010fc0, 0x00010fc0, 0x00011000, 0x00011040, 0x00011080, 0x000110c0, 0x00011100, 0x00011140,
+    0x00011180, 0x000111c0, 0x00011200, 0x00011200, 0x00011280, 0x000112c0, 0x00011300, 0x00011340,
+    0x00011380, 0x000113c0, 0x00011400, 0x00011400, 0x00011480, 0x00011480, 0x00011500, 0x00011500,
+    0x00011580, 0x000115c0, 0x000115c0, 0x00011600, 0x00011640, 0x00011680, 0x00011700, 0x00011700,
+    0x00011780, 0x00011780, 0x000117c0, 0x00011800, 0x00011840, 0x00011880, 0x000118c0, 0x00011900,
+    0x00011980, 0x000119c0, 0x00011a00, 0x00011a00, 0x00011a80, 0x00011a80, 0x00011b00, 0x00011b40,
+    0x00011b80, 0x00011bc0, 0x00011c00, 0x00011c40, 0x00011c80, 0x00011cc0, 0x00011d00, 0x00011d00,
+    0x00011d80, 0x00011dc0, 0x00011e00, 0x00011e40, 0x00011e80, 0x00011ec0, 0x00011f00, 0x00011f40,
+    0x00011f80, 0x00011fc0, 0x00012000, 0x00012040, 0x000120c0, 0x000120c0, 0x00012100, 0x00012140,
+    0x00012200, 0x00012200, 0x00012240, 0x00012280, 0x000122c0, 0x00012300, 0x00012340, 0x00012380,
+    0x000123c0, 0x00012400, 0x00012440, 0x00012480, 0x00012500, 0x00012500, 0x00012540, 0x00012580,
+    0x00012600, 0x00012640, 0x00012680, 0x000126c0, 0x00012700, 0x00012740, 0x00012780, 0x000127c0,
+    0x00012800, 0x00012840, 0x00012880, 0x000128c0, 0x00012940, 0x00012940, 0x000129c0, 0x000129c0,
+    0x00012a80, 0x00012a80, 0x00012b00, 0x00012b00, 0x00012b80, 0x00012b80, 0x00012c00, 0x00012c40,
+    0x00012c80, 0x00012cc0, 0x00012d00, 0x00012d40, 0x00012d80, 0x00012dc0, 0x00012e00, 0x00012e40,
+    0x00012ec0, 0x00012ec0, 0x00012f40, 0x00012f40, 0x00012fc0, 0x00012fc0, 0x00013040, 0x00013080,
+    0x000130c0, 0x00013100, 0x00013140, 0x00013180, 0x000131c0, 0x00013200, 0x00013240, 0x00013280,
+    0x00013300, 0x00013340, 0x00013380, 0x000133c0, 0x00013400, 0x00013440, 0x000134c0, 0x000134c0,
+    0x00013540, 0x00013580, 0x000135c0, 0x00013600, 0x00013640, 0x00013680, 0x000136c0, 0x00013740,
+    0x00013780, 0x000137c0, 0x00013800, 0x00013840, 0x00013880, 0x000138c0, 0x00013900, 0x00013940,
+    0x00013980, 0x00013a00, 0x00013a40, 0x00013a80, 0x00013ac0, 0x00013b00, 0x00013b40, 0x00013b80,
+    0x00013c00, 0x00013c40, 0x00013cc0, 0x00013cc0, 0x00013d40, 0x00013d80, 0x00013dc0, 0x00013e00,
+    0x00013e80, 0x00013e80, 0x00013f00, 0x00013f00, 0x00013f80, 0x00013fc0, 0x00014000, 0x00014040,
+    0x000140c0, 0x00014100, 0x00014140, 0x00014180, 0x000141c0, 0x00014200, 0x00014240, 0x000142c0,
+    0x00014300, 0x00014340, 0x00014380, 0x000143c0, 0x00014400, 0x00014480, 0x00014480, 0x00014500,
+    0x00014540, 0x00014580, 0x000145c0, 0x00014600, 0x00014640, 0x000146c0, 0x00014700, 0x00014740,
+    0x00014780, 0x000147c0, 0x00014840, 0x00014840, 0x000148c0, 0x00014900, 0x00014940, 0x00014980,
+    0x00014a00, 0x00014a40, 0x00014a80, 0x00014ac0, 0x00014b40, 0x00014b80, 0x00014bc0, 0x00014c00,
+    0x00014c80, 0x00014cc0, 0x00014d00, 0x00014d40, 0x00014dc0, 0x00014dc0, 0x00014e40, 0x00014e40,
+    0x00014ec0, 0x00014f00, 0x00014f80, 0x00014f80, 0x00015000, 0x00015040, 0x00015080, 0x000150c0,
+    0x00015140, 0x00015180, 0x000151c0, 0x00015200, 0x00015280, 0x00015280, 0x00015300, 0x00015340,
+    0x000153c0, 0x000153c0, 0x00015440, 0x00015480, 0x00015500, 0x00015500, 0x00015580, 0x000155c0,
+    0x00015640, 0x00015640, 0x000156c0, 0x00015700, 0x00015780, 0x00015780, 0x00015800, 0x00015840,
+    0x00015880, 0x000158c0, 0x00015940, 0x00015980, 0x000159c0, 0x00015a00, 0x00015a80, 0x00015ac0,
+    0x00015b00, 0x00015b40, 0x00015bc0, 0x00015c00, 0x00015c40, 0x00015c80, 0x00015cc0, 0x00015d40,
+    0x00015dc0, 0x00015e00, 0x00015e40, 0x00015ec0, 0x00015f00, 0x00015f40, 0x00015f80, 0x00016000,
+    0x00016040, 0x00016080, 0x000160c0, 0x00016100, 0x00016180, 0x000161c0, 0x00016200, 0x00016240,
+    0x000162c0, 0x00016300, 0x00016340, 0x00016380, 0x00016400, 0x00016440, 0x00016480, 0x000164c0,
+    0x00016540, 0x00016580, 0x00016600, 0x00016600, 0x00016680, 0x000166c0, 0x00016740, 0x00016740,
+    0x000167c0, 0x00016800, 0x00016880, 0x000168c0, 0x00016900, 0x00016980, 0x000169c0, 0x00016a00,
+    0x00016a80, 0x00016ac0, 0x00016b00, 0x00016b80, 0x00016bc0, 0x00016c00, 0x00016c80, 0x00016cc0,
+    0x00016d40, 0x00016d40, 0x00016dc0, 0x00016e00, 0x00016e80, 0x00016ec0, 0x00016f00, 0x00016f40,
+    0x00016fc0, 0x00017000, 0x00017040, 0x000170c0, 0x00017100, 0x00017180, 0x000171c0, 0x00017200,
+    0x00017280, 0x000172c0, 0x00017300, 0x00017340, 0x000173c0, 0x00017400, 0x00017480, 0x00017480,
+    0x00017540, 0x00017540, 0x000175c0, 0x00017600, 0x00017680, 0x000176c0, 0x00017700, 0x00017740,
+    0x000177c0, 0x00017800, 0x00017840, 0x000178c0, 0x00017900, 0x00017980, 0x000179c0, 0x00017a00,
+    0x00017a80, 0x00017ac0, 0x00017b40, 0x00017b40, 0x00017bc0, 0x00017c00, 0x00017c80, 0x00017cc0,
+    0x00017d40, 0x00017d80, 0x00017dc0, 0x00017e40, 0x00017e80, 0x00017f00, 0x00017f40, 0x00017f80,
+    0x00018000, 0x00018040, 0x000180c0, 0x000180c0, 0x00018140, 0x00018180, 0x00018200, 0x00018240,
+    0x00018300, 0x00018340, 0x00018380, 0x000183c0, 0x00018440, 0x00018480, 0x00018500, 0x00018500,
+    0x00018580, 0x00018600, 0x00018640, 0x00018680, 0x00018700, 0x00018740, 0x00018780, 0x00018800,
+    0x00018880, 0x000188c0, 0x00018940, 0x00018980, 0x000189c0, 0x00018a40, 0x00018a80, 0x00018b00,
+    0x00018b40, 0x00018bc0, 0x00018c00, 0x00018c40, 0x00018c80, 0x00018d00, 0x00018d40, 0x00018dc0,
+    0x00018e40, 0x00018ec0, 0x00018f00, 0x00018f40, 0x00018f80, 0x00019000, 0x00019040, 0x000190c0,
+    0x00019140, 0x00019180, 0x000191c0, 0x00019240, 0x00019240, 0x00019300, 0x00019300, 0x00019380,
+    0x00019400, 0x00019440, 0x000194c0, 0x00019500, 0x00019540, 0x000195c0, 0x00019600, 0x00019680,
+    0x000196c0, 0x00019740, 0x00019780, 0x000197c0, 0x00019800, 0x00019880, 0x000198c0, 0x00019940,
+    0x00019a00, 0x00019a40, 0x00019ac0, 0x00019b00, 0x00019b40, 0x00019bc0, 0x00019c00, 0x00019c80,
+    0x00019cc0, 0x00019d40, 0x00019d80, 0x00019e00, 0x00019e00, 0x00019e80, 0x00019ec0, 0x00019f40,
+    0x00019fc0, 0x0001a040, 0x0001a080, 0x0001a100, 0x0001a100, 0x0001a180, 0x0001a1c0, 0x0001a240,
+    0x0001a2c0, 0x0001a300, 0x0001a380, 0x0001a3c0, 0x0001a400, 0x0001a480, 0x0001a480, 0x0001a540,
+    0x0001a5c0, 0x0001a640, 0x0001a680, 0x0001a700, 0x0001a700, 0x0001a7c0, 0x0001a7c0, 0x0001a840,
+    0x0001a8c0, 0x0001a900, 0x0001a980, 0x0001a9c0, 0x0001aa40, 0x0001aac0, 0x0001ab00, 0x0001ab80,
+    0x0001ac00, 0x0001ac80, 0x0001acc0, 0x0001ad00, 0x0001ad40, 0x0001adc0, 0x0001ae00, 0x0001ae80,
+    0x0001af00, 0x0001af40, 0x0001af80, 0x0001b000, 0x0001b080, 0x0001b100, 0x0001b140, 0x0001b1c0,
+    0x0001b240, 0x0001b280, 0x0001b300, 0x0001b340, 0x0001b380, 0x0001b400, 0x0001b440, 0x0001b4c0,
+    0x0001b500, 0x0001b580, 0x0001b5c0, 0x0001b640, 0x0001b6c0, 0x0001b740, 0x0001b780, 0x0001b800,
+    0x0001b8c0, 0x0001b900, 0x0001b940, 0x0001b9c0, 0x0001b9c0, 0x0001ba80, 0x0001ba80, 0x0001bb00,
+    0x0001bb80, 0x0001bbc0, 0x0001bc40, 0x0001bc80, 0x0001bd00, 0x0001bd80, 0x0001bdc0, 0x0001be40,
+    0x0001bf00, 0x0001bf40, 0x0001bfc0, 0x0001c000, 0x0001c040, 0x0001c0c0, 0x0001c100, 0x0001c180,
+    0x0001c1c0, 0x0001c240, 0x0001c280, 0x0001c300, 0x0001c380, 0x0001c400, 0x0001c440, 0x0001c4c0,
+    0x0001c580, 0x0001c600, 0x0001c640, 0x0001c6c0, 0x0001c6c0, 0x0001c740, 0x0001c780, 0x0001c800,
+    0x0001c880, 0x0001c8c0, 0x0001c900, 0x0001c980, 0x0001ca00, 0x0001ca80, 0x0001cac0, 0x0001cb40,
+    0x0001cc00, 0x0001cc80, 0x0001ccc0, 0x0001cd40, 0x0001cd80, 0x0001ce00, 0x0001ce40, 0x0001ce80,
+    0x0001cf40, 0x0001cfc0, 0x0001d000, 0x0001d040, 0x0001d100, 0x0001d180, 0x0001d1c0, 0x0001d240,
+    0x0001d2c0, 0x0001d340, 0x0001d380, 0x0001d400, 0x0001d440, 0x0001d4c0, 0x0001d500, 0x0001d540,
+    0x0001d600, 0x0001d680, 0x0001d6c0, 0x0001d700, 0x0001d7c0, 0x0001d840, 0x0001d880, 0x0001d900,
+    0x0001d980, 0x0001da00, 0x0001da40, 0x0001dac0, 0x0001db00, 0x0001db40, 0x0001dbc0, 0x0001dc00,
+    0x0001dcc0, 0x0001dd40, 0x0001dd80, 0x0001ddc0, 0x0001de80, 0x0001df00, 0x0001df40, 0x0001df80,
+    0x0001e040, 0x0001e0c0, 0x0001e100, 0x0001e180, 0x0001e200, 0x0001e280, 0x0001e2c0, 0x0001e340,
+    0x0001e3c0, 0x0001e440, 0x0001e480, 0x0001e500, 0x0001e5c0, 0x0001e600, 0x0001e640, 0x0001e6c0,
+    0x0001e780, 0x0001e7c0, 0x0001e800, 0x0001e880, 0x0001e940, 0x0001e980, 0x0001ea00, 0x0001ea40,
+    0x0001eb00, 0x0001eb40, 0x0001ebc0, 0x0001ec00, 0x0001ecc0, 0x0001ed00, 0x0001ed80, 0x0001edc0,
+    0x0001ee80, 0x0001eec0, 0x0001ef40, 0x0001ef80, 0x0001f040, 0x0001f080, 0x0001f100, 0x0001f140,
+    0x0001f200, 0x0001f280, 0x0001f2c0, 0x0001f300, 0x0001f3c0, 0x0001f440, 0x0001f480, 0x0001f4c0,
+    0x0001f580, 0x0001f600, 0x0001f640, 0x0001f6c0, 0x0001f740, 0x0001f7c0, 0x0001f800, 0x0001f880,
+    0x0001f900, 0x0001f980, 0x0001fa40, 0x0001fa80, 0x0001fb00, 0x0001fb40, 0x0001fc00, 0x0001fc40,
+    0x0001fd00, 0x0001fd40, 0x0001fdc0, 0x0001fe00, 0x0001fec0, 0x0001ff40, 0x0001ff80, 0x0001ffc0,
+    0x00020080, 0x00020100, 0x00020140, 0x00020180, 0x00020240, 0x000202c0, 0x00020300, 0x00020380,
+    0x00020480, 0x000204c0, 0x00020540, 0x00020580, 0x00020640, 0x00020680, 0x00020700, 0x00020740,
+    0x00020800, 0x00020840, 0x00020900, 0x00020980, 0x000209c0, 0x00020a40, 0x00020ac0, 0x00020b40,
+    0x00020c00, 0x00020c40, 0x00020c80, 0x00020d00, 0x00020dc0, 0x00020e00, 0x00020e80, 0x00020ec0,
+    0x00020f80, 0x00020fc0, 0x00021080, 0x000210c0, 0x00021140, 0x00021180, 0x00021240, 0x000212c0,
+    0x000213c0, 0x00021400, 0x00021480, 0x000214c0, 0x00021580, 0x000215c0, 0x00021680, 0x00021700,
+    0x00021780, 0x00021800, 0x00021840, 0x000218c0, 0x00021940, 0x000219c0, 0x00021a80, 0x00021ac0,
+    0x00021b80, 0x00021bc0, 0x00021c40, 0x00021c80, 0x00021d40, 0x00021d80, 0x00021e40, 0x00021ec0,
+    0x00021f80, 0x00021fc0, 0x00022000, 0x00022080, 0x00022140, 0x00022180, 0x00022240, 0x00022280,
+    0x00022340, 0x000223c0, 0x00022400, 0x00022440, 0x00022500, 0x00022580, 0x00022600, 0x00022680,
+    0x00022740, 0x00022780, 0x00022800, 0x00022840, 0x00022900, 0x00022940, 0x00022a00, 0x00022a40,
+    0x00022b00, 0x00022b80, 0x00022bc0, 0x00022c40, 0x00022cc0, 0x00022d40, 0x00022e00, 0x00022e40,
+    0x00022f00, 0x00022f40, 0x00022fc0, 0x00023000, 0x000230c0, 0x00023100, 0x000231c0, 0x00023240,
+    0x00023340, 0x00023380, 0x00023400, 0x00023440, 0x00023500, 0x00023540, 0x00023600, 0x00023680,
+    0x00023700, 0x00023780, 0x00023840, 0x00023880, 0x00023940, 0x00023980, 0x00023a00, 0x00023a40,
+    0x00023b40, 0x00023bc0, 0x00023c00, 0x00023c80, 0x00023d40, 0x00023d80, 0x00023e40, 0x00023e80,
+    0x00023f40, 0x00023fc0, 0x00024040, 0x000240c0, 0x00024180, 0x000241c0, 0x00024200, 0x00024280,
+    0x00024400, 0x00024440, 0x00024480, 0x00024500, 0x000245c0, 0x00024600, 0x000246c0, 0x00024700,
+    0x000247c0, 0x00024840, 0x000248c0, 0x00024940, 0x00024a00, 0x00024a40, 0x00024a80, 0x00024b00,
+    0x00024c00, 0x00024c80, 0x00024d00, 0x00024d80, 0x00024e40, 0x00024e80, 0x00024f40, 0x00024f80,
+    0x00025040, 0x000250c0, 0x00025140, 0x000251c0, 0x00025280, 0x000252c0, 0x00025380, 0x000253c0,
+    0x00025500, 0x00025540, 0x00025600, 0x00025640, 0x00025700, 0x00025740, 0x00025800, 0x00025880,
+    0x00025940, 0x00025980, 0x00025a40, 0x00025a80, 0x00025b40, 0x00025b80, 0x00025c40, 0x00025cc0,
+    0x00025d80, 0x00025dc0, 0x00025e80, 0x00025ec0, 0x00025f80, 0x00025fc0, 0x00026080, 0x00026100,
+    0x000261c0, 0x00026200, 0x000262c0, 0x00026300, 0x000263c0, 0x00026400, 0x000264c0, 0x00026540,
+    0x00026640, 0x00026680, 0x00026740, 0x000267c0, 0x00026840, 0x000268c0, 0x00026980, 0x000269c0,
+    0x00026a80, 0x00026b40, 0x00026b80, 0x00026c40, 0x00026c80, 0x00026d40, 0x00026dc0, 0x00026e80,
+    0x00026f00, 0x00026f80, 0x00027040, 0x00027080, 0x00027140, 0x00027180, 0x00027240, 0x000272c0,
+    0x00027340, 0x00027400, 0x00027480, 0x00027540, 0x00027580, 0x00027640, 0x00027680, 0x00027740,
+    0x00027840, 0x000278c0, 0x00027980, 0x000279c0, 0x00027a80, 0x00027b40, 0x00027b80, 0x00027c40,
+    0x00027d00, 0x00027d40, 0x00027e00, 0x00027e40, 0x00027f00, 0x00027fc0, 0x00028000, 0x000280c0,
+    0x00028180, 0x00028200, 0x00028280, 0x00028300, 0x000283c0, 0x00028440, 0x000284c0, 0x00028580,
+    0x00028640, 0x00028680, 0x00028740, 0x00028780, 0x00028840, 0x00028900, 0x00028940, 0x00028a00,
+    0x00028ac0, 0x00028b00, 0x00028bc0, 0x00028c40, 0x00028cc0, 0x00028d80, 0x00028e00, 0x00028ec0,
+    0x00028f40, 0x00028fc0, 0x00029080, 0x000290c0, 0x00029180, 0x00029240, 0x00029280, 0x00029340,
+    0x00029440, 0x000294c0, 0x00029540, 0x000295c0, 0x00029680, 0x00029740, 0x00029780, 0x00029840,
+    0x00029900, 0x00029980, 0x00029a00, 0x00029ac0, 0x00029b80, 0x00029bc0, 0x00029c80, 0x00029cc0,
+    0x00029dc0, 0x00029e40, 0x00029f00, 0x00029f40, 0x0002a000, 0x0002a0c0, 0x0002a100, 0x0002a1c0,
+    0x0002a280, 0x0002a340, 0x0002a380, 0x0002a440, 0x0002a500, 0x0002a540, 0x0002a600, 0x0002a680,
+    0x0002a780, 0x0002a7c0, 0x0002a880, 0x0002a940, 0x0002aa00, 0x0002aa40, 0x0002ab00, 0x0002abc0,
+    0x0002ac80, 0x0002acc0, 0x0002ad80, 0x0002ae40, 0x0002af00, 0x0002af40, 0x0002b000, 0x0002b0c0,
+    0x0002b140, 0x0002b1c0, 0x0002b280, 0x0002b340, 0x0002b3c0, 0x0002b440, 0x0002b500, 0x0002b580,
+    0x0002b640, 0x0002b6c0, 0x0002b780, 0x0002b800, 0x0002b8c0, 0x0002b940, 0x0002b9c0, 0x0002ba80,
+    0x0002bbc0, 0x0002bc00, 0x0002bcc0, 0x0002bd80, 0x0002be00, 0x0002be80, 0x0002bf40, 0x0002c000,
+    0x0002c080, 0x0002c100, 0x0002c1c0, 0x0002c240, 0x0002c300, 0x0002c380, 0x0002c440, 0x0002c4c0,
+    0x0002c580, 0x0002c600, 0x0002c680, 0x0002c740, 0x0002c800, 0x0002c880, 0x0002c900, 0x0002c9c0,
+    0x0002ca80, 0x0002cb40, 0x0002cc00, 0x0002cc40, 0x0002cd00, 0x0002cdc0, 0x0002ce80, 0x0002cec0,
+    0x0002cfc0, 0x0002d040, 0x0002d100, 0x0002d180, 0x0002d240, 0x0002d300, 0x0002d3c0, 0x0002d400,
+    0x0002d540, 0x0002d580, 0x0002d640, 0x0002d700, 0x0002d780, 0x0002d840, 0x0002d900, 0x0002d980,
+    0x0002da80, 0x0002dac0, 0x0002db80, 0x0002dc40, 0x0002dd00, 0x0002ddc0, 0x0002de40, 0x0002dec0,
+    0x0002dfc0, 0x0002e040, 0x0002e0c0, 0x0002e180, 0x0002e240, 0x0002e300, 0x0002e3c0, 0x0002e400,
+    0x0002e500, 0x0002e580, 0x0002e640, 0x0002e6c0, 0x0002e780, 0x0002e840, 0x0002e900, 0x0002e940,
+    0x0002ea80, 0x0002eac0, 0x0002eb80, 0x0002ec40, 0x0002ed00, 0x0002ed80, 0x0002ee40, 0x0002eec0,
+    0x0002efc0, 0x0002f000, 0x0002f0c0, 0x0002f180, 0x0002f240, 0x0002f300, 0x0002f380, 0x0002f400,
+    0x0002f500, 0x0002f5c0, 0x0002f680, 0x0002f6c0, 0x0002f7c0, 0x0002f840, 0x0002f900, 0x0002f9c0,
+    0x0002fac0, 0x0002fb00, 0x0002fbc0, 0x0002fc80, 0x0002fd40, 0x0002fe00, 0x0002fe80, 0x0002ff00,
+    0x00030000, 0x000300c0, 0x00030180, 0x000301c0, 0x000302c0, 0x00030340, 0x00030400, 0x00030480,
+    0x00030600, 0x00030680, 0x00030700, 0x000307c0, 0x00030880, 0x00030940, 0x00030a00, 0x00030a40,
+    0x00030b40, 0x00030c00, 0x00030cc0, 0x00030d40, 0x00030e40, 0x00030e80, 0x00030f40, 0x00031000,
+    0x00031100, 0x000311c0, 0x00031280, 0x00031340, 0x00031380, 0x00031480, 0x00031500, 0x00031600,
+    0x000316c0, 0x00031780, 0x00031800, 0x000318c0, 0x00031940, 0x00031a40, 0x00031a80, 0x00031bc0,
+    0x00031cc0, 0x00031d80, 0x00031e40, 0x00031ec0, 0x00031f40, 0x00032040, 0x00032080, 0x000321c0,
+    0x00032280, 0x00032300, 0x000323c0, 0x00032480, 0x000324c0, 0x00032600, 0x00032640, 0x00032740,
+    0x00032800, 0x000328c0, 0x00032980, 0x00032a40, 0x00032a80, 0x00032b80, 0x00032c00, 0x00032d00,
+    0x00032dc0, 0x00032e80, 0x00032f40, 0x00032fc0, 0x00033040, 0x00033140, 0x00033180, 0x000332c0,
+    0x00033400, 0x000334c0, 0x00033580, 0x00033640, 0x00033680, 0x000337c0, 0x00033800, 0x00033900,
+    0x000339c0, 0x00033a80, 0x00033b40, 0x00033c00, 0x00033c40, 0x00033d40, 0x00033dc0, 0x00033ec0,
+    0x00033fc0, 0x00034080, 0x00034140, 0x00034200, 0x00034240, 0x00034340, 0x000343c0, 0x000344c0,
+    0x00034580, 0x00034640, 0x00034700, 0x00034780, 0x00034800, 0x00034900, 0x00034940, 0x00034a80,
+    0x00034bc0, 0x00034c80, 0x00034d40, 0x00034e00, 0x00034e40, 0x00034f80, 0x00034fc0, 0x000350c0,
+    0x00035180, 0x00035240, 0x00035300, 0x000353c0, 0x000354c0, 0x000355c0, 0x00035600, 0x00035740,
+    0x00035840, 0x00035900, 0x000359c0, 0x00035a40, 0x00035ac0, 0x00035bc0, 0x00035c40, 0x00035d40,
+    0x00035e00, 0x00035e80, 0x00035f40, 0x00036000, 0x00036100, 0x00036240, 0x00036280, 0x00036380,
+    0x000364c0, 0x00036540, 0x00036600, 0x000366c0, 0x00036700, 0x00036840, 0x00036880, 0x00036980,
+    0x00036a40, 0x00036b00, 0x00036bc0, 0x00036c80, 0x00036d80, 0x00036e80, 0x00036f00, 0x00037000,
+    0x00037180, 0x00037200, 0x000372c0, 0x00037380, 0x000373c0, 0x00037500, 0x00037540, 0x00037640,
+    0x00037700, 0x000377c0, 0x00037880, 0x00037940, 0x00037a40, 0x00037b40, 0x00037bc0, 0x00037cc0,
+    0x00037e40, 0x00037ec0, 0x00037f80, 0x00038040, 0x000380c0, 0x000381c0, 0x00038200, 0x00038300,
+    0x000383c0, 0x00038480, 0x00038540, 0x00038600, 0x00038700, 0x00038800, 0x00038880, 0x00038980,
+    0x00038b40, 0x00038c00, 0x00038cc0, 0x00038d80, 0x00038dc0, 0x00038ec0, 0x00038f40, 0x00039040,
+    0x00039100, 0x000391c0, 0x00039240, 0x00039300, 0x00039400, 0x00039540, 0x00039580, 0x00039680,
+    0x00039800, 0x00039900, 0x00039980, 0x00039a80, 0x00039b00, 0x00039c00, 0x00039c80, 0x00039d00,
+    0x00039e80, 0x00039f80, 0x0003a000, 0x0003a080, 0x0003a200, 0x0003a300, 0x0003a380, 0x0003a480,
+    0x0003a580, 0x0003a680, 0x0003a700, 0x0003a800, 0x0003a880, 0x0003a980, 0x0003aa00, 0x0003aa80,
+    0x0003ac00, 0x0003ad00, 0x0003ad80, 0x0003ae00, 0x0003af80, 0x0003b080, 0x0003b100, 0x0003b200,
+    0x0003b300, 0x0003b400, 0x0003b480, 0x0003b580, 0x0003b600, 0x0003b680, 0x0003b780, 0x0003b800,
+    0x0003b980, 0x0003ba80, 0x0003bb00, 0x0003bb80, 0x0003bd00, 0x0003be00, 0x0003be80, 0x0003bf00,
+    0x0003c080, 0x0003c180, 0x0003c200, 0x0003c300, 0x0003c400, 0x0003c500, 0x0003c580, 0x0003c680,
+    0x0003c780, 0x0003c880, 0x0003c900, 0x0003ca00, 0x0003cb80, 0x0003cc00, 0x0003cc80, 0x0003cd80,
+    0x0003cf00, 0x0003cf80, 0x0003d000, 0x0003d100, 0x0003d280, 0x0003d300, 0x0003d400, 0x0003d480,
+    0x0003d600, 0x0003d680, 0x0003d780, 0x0003d800, 0x0003d980, 0x0003da00, 0x0003db00, 0x0003db80,
+    0x0003dd00, 0x0003dd80, 0x0003de80, 0x0003df00, 0x0003e080, 0x0003e100, 0x0003e200, 0x0003e280,
+    0x0003e400, 0x0003e500, 0x0003e580, 0x0003e600, 0x0003e780, 0x0003e880, 0x0003e900, 0x0003e980,
+    0x0003eb00, 0x0003ec00, 0x0003ec80, 0x0003ed80, 0x0003ee80, 0x0003ef80, 0x0003f000, 0x0003f100,
+    0x0003f200, 0x0003f300, 0x0003f480, 0x0003f500, 0x0003f600, 0x0003f680, 0x0003f800, 0x0003f880,
+    0x0003fa00, 0x0003fa80, 0x0003fb80, 0x0003fc00, 0x0003fd80, 0x0003fe80, 0x0003ff00, 0x0003ff80,
+    0x00040100, 0x00040200, 0x00040280, 0x00040300, 0x00040480, 0x00040580, 0x00040600, 0x00040700,
+    0x00040900, 0x00040980, 0x00040a80, 0x00040b00, 0x00040c80, 0x00040d00, 0x00040e00, 0x00040e80,
+    0x00041000, 0x00041080, 0x00041200, 0x00041300, 0x00041380, 0x00041480, 0x00041580, 0x00041680,
+    0x00041800, 0x00041880, 0x00041900, 0x00041a00, 0x00041b80, 0x00041c00, 0x00041d00, 0x00041d80,
+    0x00041f00, 0x00041f80, 0x00042100, 0x00042180, 0x00042280, 0x00042300, 0x00042480, 0x00042580,
+    0x00042780, 0x00042800, 0x00042900, 0x00042980, 0x00042b00, 0x00042b80, 0x00042d00, 0x00042e00,
+    0x00042f00, 0x00043000, 0x00043080, 0x00043180, 0x00043280, 0x00043380, 0x00043500, 0x00043580,
+    0x00043700, 0x00043780, 0x00043880, 0x00043900, 0x00043a80, 0x00043b00, 0x00043c80, 0x00043d80,
+    0x00043f00, 0x00043f80, 0x00044000, 0x00044100, 0x00044280, 0x00044300, 0x00044480, 0x00044500,
+    0x00044680, 0x00044780, 0x00044800, 0x00044880, 0x00044a00, 0x00044b00, 0x00044c00, 0x00044d00,
+    0x00044e80, 0x00044f00, 0x00045000, 0x00045080, 0x00045200, 0x00045280, 0x00045400, 0x00045480,
+    0x00045600, 0x00045700, 0x00045780, 0x00045880, 0x00045980, 0x00045a80, 0x00045c00, 0x00045c80,
+    0x00045e00, 0x00045e80, 0x00045f80, 0x00046000, 0x00046180, 0x00046200, 0x00046380, 0x00046480,
+    0x00046680, 0x00046700, 0x00046800, 0x00046880, 0x00046a00, 0x00046a80, 0x00046c00, 0x00046d00,
+    0x00046e00, 0x00046f00, 0x00047080, 0x00047100, 0x00047280, 0x00047300, 0x00047400, 0x00047480,
+    0x00047680, 0x00047780, 0x00047800, 0x00047900, 0x00047a80, 0x00047b00, 0x00047c80, 0x00047d00,
+    0x00047e80, 0x00047f80, 0x00048080, 0x00048180, 0x00048300, 0x00048380, 0x00048400, 0x00048500,
+    0x00048800, 0x00048880, 0x00048900, 0x00048a00, 0x00048b80, 0x00048c00, 0x00048d80, 0x00048e00,
+    0x00048f80, 0x00049080, 0x00049180, 0x00049280, 0x00049400, 0x00049480, 0x00049500, 0x00049600,
+    0x00049800, 0x00049900, 0x00049a00, 0x00049b00, 0x00049c80, 0x00049d00, 0x00049e80, 0x00049f00,
+    0x0004a080, 0x0004a180, 0x0004a280, 0x0004a380, 0x0004a500, 0x0004a580, 0x0004a700, 0x0004a780,
+    0x0004aa00, 0x0004aa80, 0x0004ac00, 0x0004ac80, 0x0004ae00, 0x0004ae80, 0x0004b000, 0x0004b100,
+    0x0004b280, 0x0004b300, 0x0004b480, 0x0004b500, 0x0004b680, 0x0004b700, 0x0004b880, 0x0004b980,
+    0x0004bb00, 0x0004bb80, 0x0004bd00, 0x0004bd80, 0x0004bf00, 0x0004bf80, 0x0004c100, 0x0004c200,
+    0x0004c380, 0x0004c400, 0x0004c580, 0x0004c600, 0x0004c780, 0x0004c800, 0x0004c980, 0x0004ca80,
+    0x0004cc80, 0x0004cd00, 0x0004ce80, 0x0004cf80, 0x0004d080, 0x0004d180, 0x0004d300, 0x0004d380,
+    0x0004d500, 0x0004d680, 0x0004d700, 0x0004d880, 0x0004d900, 0x0004da80, 0x0004db80, 0x0004dd00,
+    0x0004de00, 0x0004df00, 0x0004e080, 0x0004e100, 0x0004e280, 0x0004e300, 0x0004e480, 0x0004e580,
+    0x0004e680, 0x0004e800, 0x0004e900, 0x0004ea80, 0x0004eb00, 0x0004ec80, 0x0004ed00, 0x0004ee80,
+    0x0004f080, 0x0004f180, 0x0004f300, 0x0004f380, 0x0004f500, 0x0004f680, 0x0004f700, 0x0004f880,
+    0x0004fa00, 0x0004fa80, 0x0004fc00, 0x0004fc80, 0x0004fe00, 0x0004ff80, 0x00050000, 0x00050180,
+    0x00050300, 0x00050400, 0x00050500, 0x00050600, 0x00050780, 0x00050880, 0x00050980, 0x00050b00,
+    0x00050c80, 0x00050d00, 0x00050e80, 0x00050f00, 0x00051080, 0x00051200, 0x00051280, 0x00051400,
+    0x00051580, 0x00051600, 0x00051780, 0x00051880, 0x00051980, 0x00051b00, 0x00051c00, 0x00051d80,
+    0x00051e80, 0x00051f80, 0x00052100, 0x00052180, 0x00052300, 0x00052480, 0x00052500, 0x00052680,
+    0x00052880, 0x00052980, 0x00052a80, 0x00052b80, 0x00052d00, 0x00052e80, 0x00052f00, 0x00053080,
+    0x00053200, 0x00053300, 0x00053400, 0x00053580, 0x00053700, 0x00053780, 0x00053900, 0x00053980,
+    0x00053b80, 0x00053c80, 0x00053e00, 0x00053e80, 0x00054000, 0x00054180, 0x00054200, 0x00054380,
+    0x00054500, 0x00054680, 0x00054700, 0x00054880, 0x00054a00, 0x00054a80, 0x00054c00, 0x00054d00,
+    0x00054f00, 0x00054f80, 0x00055100, 0x00055280, 0x00055400, 0x00055480, 0x00055600, 0x00055780,
+    0x00055900, 0x00055980, 0x00055b00, 0x00055c80, 0x00055e00, 0x00055e80, 0x00056000, 0x00056180,
+    0x00056280, 0x00056380, 0x00056500, 0x00056680, 0x00056780, 0x00056880, 0x00056a00, 0x00056b00,
+    0x00056c80, 0x00056d80, 0x00056f00, 0x00057000, 0x00057180, 0x00057280, 0x00057380, 0x00057500,
+    0x00057780, 0x00057800, 0x00057980, 0x00057b00, 0x00057c00, 0x00057d00, 0x00057e80, 0x00058000,
+    0x00058100, 0x00058200, 0x00058380, 0x00058480, 0x00058600, 0x00058700, 0x00058880, 0x00058980,
+    0x00058b00, 0x00058c00, 0x00058d00, 0x00058e80, 0x00059000, 0x00059100, 0x00059200, 0x00059380,
+    0x00059500, 0x00059680, 0x00059800, 0x00059880, 0x00059a00, 0x00059b80, 0x00059d00, 0x00059d80,
+    0x00059f80, 0x0005a080, 0x0005a200, 0x0005a300, 0x0005a480, 0x0005a600, 0x0005a780, 0x0005a800,
+    0x0005aa80, 0x0005ab00, 0x0005ac80, 0x0005ae00, 0x0005af00, 0x0005b080, 0x0005b200, 0x0005b300,
+    0x0005b500, 0x0005b580, 0x0005b700, 0x0005b880, 0x0005ba00, 0x0005bb80, 0x0005bc80, 0x0005bd80,
+    0x0005bf80, 0x0005c080, 0x0005c180, 0x0005c300, 0x0005c480, 0x0005c600, 0x0005c780, 0x0005c800,
+    0x0005ca00, 0x0005cb00, 0x0005cc80, 0x0005cd80, 0x0005cf00, 0x0005d080, 0x0005d200, 0x0005d280,
+    0x0005d500, 0x0005d580, 0x0005d700, 0x0005d880, 0x0005da00, 0x0005db00, 0x0005dc80, 0x0005dd80,
+    0x0005df80, 0x0005e000, 0x0005e180, 0x0005e300, 0x0005e480, 0x0005e600, 0x0005e700, 0x0005e800,
+    0x0005ea00, 0x0005eb80, 0x0005ed00, 0x0005ed80, 0x0005ef80, 0x0005f080, 0x0005f200, 0x0005f380,
+    0x0005f580, 0x0005f600, 0x0005f780, 0x0005f900, 0x0005fa80, 0x0005fc00, 0x0005fd00, 0x0005fe00,
+    0x00060000, 0x00060180, 0x00060300, 0x00060380, 0x00060580, 0x00060680, 0x00060800, 0x00060900,
+    0x00060c00, 0x00060d00, 0x00060e00, 0x00060f80, 0x00061100, 0x00061280, 0x00061400, 0x00061480,
+    0x00061680, 0x00061800, 0x00061980, 0x00061a80, 0x00061c80, 0x00061d00, 0x00061e80, 0x00062000,
+    0x00062200, 0x00062380, 0x00062500, 0x00062680, 0x00062700, 0x00062900, 0x00062a00, 0x00062c00,
+    0x00062d80, 0x00062f00, 0x00063000, 0x00063180, 0x00063280, 0x00063480, 0x00063500, 0x00063780,
+    0x00063980, 0x00063b00, 0x00063c80, 0x00063d80, 0x00063e80, 0x00064080, 0x00064100, 0x00064380,
+    0x00064500, 0x00064600, 0x00064780, 0x00064900, 0x00064980, 0x00064c00, 0x00064c80, 0x00064e80,
+    0x00065000, 0x00065180, 0x00065300, 0x00065480, 0x00065500, 0x00065700, 0x00065800, 0x00065a00,
+    0x00065b80, 0x00065d00, 0x00065e80, 0x00065f80, 0x00066080, 0x00066280, 0x00066300, 0x00066580,
+    0x00066800, 0x00066980, 0x00066b00, 0x00066c80, 0x00066d00, 0x00066f80, 0x00067000, 0x00067200,
+    0x00067380, 0x00067500, 0x00067680, 0x00067800, 0x00067880, 0x00067a80, 0x00067b80, 0x00067d80,
+    0x00067f80, 0x00068100, 0x00068280, 0x00068400, 0x00068480, 0x00068680, 0x00068780, 0x00068980,
+    0x00068b00, 0x00068c80, 0x00068e00, 0x00068f00, 0x00069000, 0x00069200, 0x00069280, 0x00069500,
+    0x00069780, 0x00069900, 0x00069a80, 0x00069c00, 0x00069c80, 0x00069f00, 0x00069f80, 0x0006a180,
+    0x0006a300, 0x0006a480, 0x0006a600, 0x0006a780, 0x0006a980, 0x0006ab80, 0x0006ac00, 0x0006ae80,
+    0x0006b080, 0x0006b200, 0x0006b380, 0x0006b480, 0x0006b580, 0x0006b780, 0x0006b880, 0x0006ba80,
+    0x0006bc00, 0x0006bd00, 0x0006be80, 0x0006c000, 0x0006c200, 0x0006c480, 0x0006c500, 0x0006c700,
+    0x0006c980, 0x0006ca80, 0x0006cc00, 0x0006cd80, 0x0006ce00, 0x0006d080, 0x0006d100, 0x0006d300,
+    0x0006d480, 0x0006d600, 0x0006d780, 0x0006d900, 0x0006db00, 0x0006dd00, 0x0006de00, 0x0006e000,
+    0x0006e300, 0x0006e400, 0x0006e580, 0x0006e700, 0x0006e780, 0x0006ea00, 0x0006ea80, 0x0006ec80,
+    0x0006ee00, 0x0006ef80, 0x0006f100, 0x0006f280, 0x0006f480, 0x0006f680, 0x0006f780, 0x0006f980,
+    0x0006fc80, 0x0006fd80, 0x0006ff00, 0x00070080, 0x00070180, 0x00070380, 0x00070400, 0x00070600,
+    0x00070780, 0x00070900, 0x00070a80, 0x00070c00, 0x00070e00, 0x00071000, 0x00071100, 0x00071300,
+    0x00071680, 0x00071800, 0x00071980, 0x00071b00, 0x00071b80, 0x00071d80, 0x00071e80, 0x00072080,
+    0x00072200, 0x00072380, 0x00072480, 0x00072600, 0x00072800, 0x00072a80, 0x00072b00, 0x00072d00,
+    0x00073000, 0x00073200, 0x00073300, 0x00073500, 0x00073600, 0x00073800, 0x00073900, 0x00073a00,
+    0x00073d00, 0x00073f00, 0x00074000, 0x00074100, 0x00074400, 0x00074600, 0x00074700, 0x00074900,
+    0x00074b00, 0x00074d00, 0x00074e00, 0x00075000, 0x00075100, 0x00075300, 0x00075400, 0x00075500,
+    0x00075800, 0x00075a00, 0x00075b00, 0x00075c00, 0x00075f00, 0x00076100, 0x00076200, 0x00076400,
+    0x00076600, 0x00076800, 0x00076900, 0x00076b00, 0x00076c00, 0x00076d00, 0x00076f00, 0x00077000,
+    0x00077300, 0x00077500, 0x00077600, 0x00077700, 0x00077a00, 0x00077c00, 0x00077d00, 0x00077e00,
+    0x00078100, 0x00078300, 0x00078400, 0x00078600, 0x00078800, 0x00078a00, 0x00078b00, 0x00078d00,
+    0x00078f00, 0x00079100, 0x00079200, 0x00079400, 0x00079700, 0x00079800, 0x00079900, 0x00079b00,
+    0x00079e00, 0x00079f00, 0x0007a000, 0x0007a200, 0x0007a500, 0x0007a600, 0x0007a800, 0x0007a900,
+    0x0007ac00, 0x0007ad00, 0x0007af00, 0x0007b000, 0x0007b300, 0x0007b400, 0x0007b600, 0x0007b700,
+    0x0007ba00, 0x0007bb00, 0x0007bd00, 0x0007be00, 0x0007c100, 0x0007c200, 0x0007c400, 0x0007c500,
+    0x0007c800, 0x0007ca00, 0x0007cb00, 0x0007cc00, 0x0007cf00, 0x0007d100, 0x0007d200, 0x0007d300,
+    0x0007d600, 0x0007d800, 0x0007d900, 0x0007db00, 0x0007dd00, 0x0007df00, 0x0007e000, 0x0007e200,
+    0x0007e400, 0x0007e600, 0x0007e900, 0x0007ea00, 0x0007ec00, 0x0007ed00, 0x0007f000, 0x0007f100,
+    0x0007f400, 0x0007f500, 0x0007f700, 0x0007f800, 0x0007fb00, 0x0007fd00, 0x0007fe00, 0x0007ff00,
+    0x00080200, 0x00080400, 0x00080500, 0x00080600, 0x00080900, 0x00080b00, 0x00080c00, 0x00080e00,
+    0x00081200, 0x00081300, 0x00081500, 0x00081600, 0x00081900, 0x00081a00, 0x00081c00, 0x00081d00,
+    0x00082000, 0x00082100, 0x00082400, 0x00082600, 0x00082700, 0x00082900, 0x00082b00, 0x00082d00,
+    0x00083000, 0x00083100, 0x00083200, 0x00083400, 0x00083700, 0x00083800, 0x00083a00, 0x00083b00,
+    0x00083e00, 0x00083f00, 0x00084200, 0x00084300, 0x00084500, 0x00084600, 0x00084900, 0x00084b00,
+    0x00084f00, 0x00085000, 0x00085200, 0x00085300, 0x00085600, 0x00085700, 0x00085a00, 0x00085c00,
+    0x00085e00, 0x00086000, 0x00086100, 0x00086300, 0x00086500, 0x00086700, 0x00086a00, 0x00086b00,
+    0x00086e00, 0x00086f00, 0x00087100, 0x00087200, 0x00087500, 0x00087600, 0x00087900, 0x00087b00,
+    0x00087e00, 0x00087f00, 0x00088000, 0x00088200, 0x00088500, 0x00088600, 0x00088900, 0x00088a00,
+    0x00088d00, 0x00088f00, 0x00089000, 0x00089100, 0x00089400, 0x00089600, 0x00089800, 0x00089a00,
+    0x00089d00, 0x00089e00, 0x0008a000, 0x0008a100, 0x0008a400, 0x0008a500, 0x0008a800, 0x0008a900,
+    0x0008ac00, 0x0008ae00, 0x0008af00, 0x0008b100, 0x0008b300, 0x0008b500, 0x0008b800, 0x0008b900,
+    0x0008bc00, 0x0008bd00, 0x0008bf00, 0x0008c000, 0x0008c300, 0x0008c400, 0x0008c700, 0x0008c900,
+    0x0008cd00, 0x0008ce00, 0x0008d000, 0x0008d100, 0x0008d400, 0x0008d500, 0x0008d800, 0x0008da00,
+    0x0008dc00, 0x0008de00, 0x0008e100, 0x0008e200, 0x0008e500, 0x0008e600, 0x0008e800, 0x0008e900,
+    0x0008ed00, 0x0008ef00, 0x0008f000, 0x0008f200, 0x0008f500, 0x0008f600, 0x0008f900, 0x0008fa00,
+    0x0008fd00, 0x0008ff00, 0x00090100, 0x00090300, 0x00090600, 0x00090700, 0x00090800, 0x00090a00,
+    0x00091000, 0x00091100, 0x00091200, 0x00091400, 0x00091700, 0x00091800, 0x00091b00, 0x00091c00,
+    0x00091f00, 0x00092100, 0x00092300, 0x00092500, 0x00092800, 0x00092900, 0x00092a00, 0x00092c00,
+    0x00093000, 0x00093200, 0x00093400, 0x00093600, 0x00093900, 0x00093a00, 0x00093d00, 0x00093e00,
+    0x00094100, 0x00094300, 0x00094500, 0x00094700, 0x00094a00, 0x00094b00, 0x00094e00, 0x00094f00,
+    0x00095400, 0x00095500, 0x00095800, 0x00095900, 0x00095c00, 0x00095d00, 0x00096000, 0x00096200,
+    0x00096500, 0x00096600, 0x00096900, 0x00096a00, 0x00096d00, 0x00096e00, 0x00097100, 0x00097300,
+    0x00097600, 0x00097700, 0x00097a00, 0x00097b00, 0x00097e00, 0x00097f00, 0x00098200, 0x00098400,
+    0x00098700, 0x00098800, 0x00098b00, 0x00098c00, 0x00098f00, 0x00099000, 0x00099300, 0x00099500,
+    0x00099900, 0x00099a00, 0x00099d00, 0x00099f00, 0x0009a100, 0x0009a300, 0x0009a600, 0x0009a700,
+    0x0009aa00, 0x0009ad00, 0x0009ae00, 0x0009b100, 0x0009b200, 0x0009b500, 0x0009b700, 0x0009ba00,
+    0x0009bc00, 0x0009be00, 0x0009c100, 0x0009c200, 0x0009c500, 0x0009c600, 0x0009c900, 0x0009cb00,
+    0x0009cd00, 0x0009d000, 0x0009d200, 0x0009d500, 0x0009d600, 0x0009d900, 0x0009da00, 0x0009dd00,
+    0x0009e100, 0x0009e300, 0x0009e600, 0x0009e700, 0x0009ea00, 0x0009ed00, 0x0009ee00, 0x0009f100,
+    0x0009f400, 0x0009f500, 0x0009f800, 0x0009f900, 0x0009fc00, 0x0009ff00, 0x000a0000, 0x000a0300,
+    0x000a0600, 0x000a0800, 0x000a0a00, 0x000a0c00, 0x000a0f00, 0x000a1100, 0x000a1300, 0x000a1600,
+    0x000a1900, 0x000a1a00, 0x000a1d00, 0x000a1e00, 0x000a2100, 0x000a2400, 0x000a2500, 0x000a2800,
+    0x000a2b00, 0x000a2c00, 0x000a2f00, 0x000a3100, 0x000a3300, 0x000a3600, 0x000a3800, 0x000a3b00,
+    0x000a3d00, 0x000a3f00, 0x000a4200, 0x000a4300, 0x000a4600, 0x000a4900, 0x000a4a00, 0x000a4d00,
+    0x000a5100, 0x000a5300, 0x000a5500, 0x000a5700, 0x000a5a00, 0x000a5d00, 0x000a5e00, 0x000a6100,
+    0x000a6400, 0x000a6600, 0x000a6800, 0x000a6b00, 0x000a6e00, 0x000a6f00, 0x000a7200, 0x000a7300,
+    0x000a7700, 0x000a7900, 0x000a7c00, 0x000a7d00, 0x000a8000, 0x000a8300, 0x000a8400, 0x000a8700,
+    0x000a8a00, 0x000a8d00, 0x000a8e00, 0x000a9100, 0x000a9400, 0x000a9500, 0x000a9800, 0x000a9a00,
+    0x000a9e00, 0x000a9f00, 0x000aa200, 0x000aa500, 0x000aa800, 0x000aa900, 0x000aac00, 0x000aaf00,
+    0x000ab200, 0x000ab300, 0x000ab600, 0x000ab900, 0x000abc00, 0x000abd00, 0x000ac000, 0x000ac300,
+    0x000ac500, 0x000ac700, 0x000aca00, 0x000acd00, 0x000acf00, 0x000ad100, 0x000ad400, 0x000ad600,
+    0x000ad900, 0x000adb00, 0x000ade00, 0x000ae000, 0x000ae300, 0x000ae500, 0x000ae700, 0x000aea00,
+    0x000aef00, 0x000af000, 0x000af300, 0x000af600, 0x000af800, 0x000afa00, 0x000afd00, 0x000b0000,
+    0x000b0200, 0x000b0400, 0x000b0700, 0x000b0900, 0x000b0c00, 0x000b0e00, 0x000b1100, 0x000b1300,
+    0x000b1600, 0x000b1800, 0x000b1a00, 0x000b1d00, 0x000b2000, 0x000b2200, 0x000b2400, 0x000b2700,
+    0x000b2a00, 0x000b2d00, 0x000b3000, 0x000b3100, 0x000b3400, 0x000b3700, 0x000b3a00, 0x000b3b00,
+    0x000b3f00, 0x000b4100, 0x000b4400, 0x000b4600, 0x000b4900, 0x000b4c00, 0x000b4f00, 0x000b5000,
+    0x000b5500, 0x000b5600, 0x000b5900, 0x000b5c00, 0x000b5e00, 0x000b6100, 0x000b6400, 0x000b6600,
+    0x000b6a00, 0x000b6b00, 0x000b6e00, 0x000b7100, 0x000b7400, 0x000b7700, 0x000b7900, 0x000b7b00,
+    0x000b7f00, 0x000b8100, 0x000b8300, 0x000b8600, 0x000b8900, 0x000b8c00, 0x000b8f00, 0x000b9000,
+    0x000b9400, 0x000b9600, 0x000b9900, 0x000b9b00, 0x000b9e00, 0x000ba100, 0x000ba400, 0x000ba500,
+    0x000baa00, 0x000bab00, 0x000bae00, 0x000bb100, 0x000bb400, 0x000bb600, 0x000bb900, 0x000bbb00,
+    0x000bbf00, 0x000bc000, 0x000bc300, 0x000bc600, 0x000bc900, 0x000bcc00, 0x000bce00, 0x000bd000,
+    0x000bd400, 0x000bd700, 0x000bda00, 0x000bdb00, 0x000bdf00, 0x000be100, 0x000be400, 0x000be700,
+    0x000beb00, 0x000bec00, 0x000bef00, 0x000bf200, 0x000bf500, 0x000bf800, 0x000bfa00, 0x000bfc00,
+    0x000c0000, 0x000c0300, 0x000c0600, 0x000c0700, 0x000c0b00, 0x000c0d00, 0x000c1000, 0x000c1200,
+    0x000c1800, 0x000c1a00, 0x000c1c00, 0x000c1f00, 0x000c2200, 0x000c2500, 0x000c2800, 0x000c2900,
+    0x000c2d00, 0x000c3000, 0x000c3300, 0x000c3500, 0x000c3900, 0x000c3a00, 0x000c3d00, 0x000c4000,
+    0x000c4400, 0x000c4700, 0x000c4a00, 0x000c4d00, 0x000c4e00, 0x000c5200, 0x000c5400, 0x000c5800,
+    0x000c5b00, 0x000c5e00, 0x000c6000, 0x000c6300, 0x000c6500, 0x000c6900, 0x000c6a00, 0x000c6f00,
+    0x000c7300, 0x000c7600, 0x000c7900, 0x000c7b00, 0x000c7d00, 0x000c8100, 0x000c8200, 0x000c8700,
+    0x000c8a00, 0x000c8c00, 0x000c8f00, 0x000c9200, 0x000c9300, 0x000c9800, 0x000c9900, 0x000c9d00,
+    0x000ca000, 0x000ca300, 0x000ca600, 0x000ca900, 0x000caa00, 0x000cae00, 0x000cb000, 0x000cb400,
+    0x000cb700, 0x000cba00, 0x000cbd00, 0x000cbf00, 0x000cc100, 0x000cc500, 0x000cc600, 0x000ccb00,
+    0x000cd000, 0x000cd300, 0x000cd600, 0x000cd900, 0x000cda00, 0x000cdf00, 0x000ce000, 0x000ce400,
+    0x000ce700, 0x000cea00, 0x000ced00, 0x000cf000, 0x000cf100, 0x000cf500, 0x000cf700, 0x000cfb00,
+    0x000cff00, 0x000d0200, 0x000d0500, 0x000d0800, 0x000d0900, 0x000d0d00, 0x000d0f00, 0x000d1300,
+    0x000d1600, 0x000d1900, 0x000d1c00, 0x000d1e00, 0x000d2000, 0x000d2400, 0x000d2500, 0x000d2a00,
+    0x000d2f00, 0x000d3200, 0x000d3500, 0x000d3800, 0x000d3900, 0x000d3e00, 0x000d3f00, 0x000d4300,
+    0x000d4600, 0x000d4900, 0x000d4c00, 0x000d4f00, 0x000d5300, 0x000d5700, 0x000d5800, 0x000d5d00,
+    0x000d6100, 0x000d6400, 0x000d6700, 0x000d6900, 0x000d6b00, 0x000d6f00, 0x000d7100, 0x000d7500,
+    0x000d7800, 0x000d7a00, 0x000d7d00, 0x000d8000, 0x000d8400, 0x000d8900, 0x000d8a00, 0x000d8e00,
+    0x000d9300, 0x000d9500, 0x000d9800, 0x000d9b00, 0x000d9c00, 0x000da100, 0x000da200, 0x000da600,
+    0x000da900, 0x000dac00, 0x000daf00, 0x000db200, 0x000db600, 0x000dba00, 0x000dbc00, 0x000dc000,
+    0x000dc600, 0x000dc800, 0x000dcb00, 0x000dce00, 0x000dcf00, 0x000dd400, 0x000dd500, 0x000dd900,
+    0x000ddc00, 0x000ddf00, 0x000de200, 0x000de500, 0x000de900, 0x000ded00, 0x000def00, 0x000df300,
+    0x000df900, 0x000dfb00, 0x000dfe00, 0x000e0100, 0x000e0300, 0x000e0700, 0x000e0800, 0x000e0c00,
+    0x000e0f00, 0x000e1200, 0x000e1500, 0x000e1800, 0x000e1c00, 0x000e2000, 0x000e2200, 0x000e2600,
+    0x000e2d00, 0x000e3000, 0x000e3300, 0x000e3600, 0x000e3700, 0x000e3b00, 0x000e3d00, 0x000e4100,
+    0x000e4400, 0x000e4700, 0x000e4900, 0x000e4c00, 0x000e5000, 0x000e5500, 0x000e5600, 0x000e5a00,
+    0x000e6000, 0x000e6400, 0x000e6600, 0x000e6a00, 0x000e6c00, 0x000e7000, 0x000e7200, 0x000e7400,
+    0x000e7a00, 0x000e7e00, 0x000e8000, 0x000e8200, 0x000e8800, 0x000e8c00, 0x000e8e00, 0x000e9200,
+    0x000e9600, 0x000e9a00, 0x000e9c00, 0x000ea000, 0x000ea200, 0x000ea600, 0x000ea800, 0x000eaa00,
+    0x000eb000, 0x000eb400, 0x000eb600, 0x000eb800, 0x000ebe00, 0x000ec200, 0x000ec400, 0x000ec800,
+    0x000ecc00, 0x000ed000, 0x000ed200, 0x000ed600, 0x000ed800, 0x000eda00, 0x000ede00, 0x000ee000,
+    0x000ee600, 0x000eea00, 0x000eec00, 0x000eee00, 0x000ef400, 0x000ef800, 0x000efa00, 0x000efc00,
+    0x000f0200, 0x000f0600, 0x000f0800, 0x000f0c00, 0x000f1000, 0x000f1400, 0x000f1600, 0x000f1a00,
+    0x000f1e00, 0x000f2200, 0x000f2400, 0x000f2800, 0x000f2e00, 0x000f3000, 0x000f3200, 0x000f3600,
+    0x000f3c00, 0x000f3e00, 0x000f4000, 0x000f4400, 0x000f4a00, 0x000f4c00, 0x000f5000, 0x000f5200,
+    0x000f5800, 0x000f5a00, 0x000f5e00, 0x000f6000, 0x000f6600, 0x000f6800, 0x000f6c00, 0x000f6e00,
+    0x000f7400, 0x000f7600, 0x000f7a00, 0x000f7c00, 0x000f8200, 0x000f8400, 0x000f8800, 0x000f8a00,
+    0x000f9000, 0x000f9400, 0x000f9600, 0x000f9800, 0x000f9e00, 0x000fa200, 0x000fa400, 0x000fa600,
+    0x000fac00, 0x000fb000, 0x000fb200, 0x000fb600, 0x000fba00, 0x000fbe00, 0x000fc000, 0x000fc400,
+    0x000fc800, 0x000fcc00, 0x000fd200, 0x000fd400, 0x000fd800, 0x000fda00, 0x000fe000, 0x000fe200,
+    0x000fe800, 0x000fea00, 0x000fee00, 0x000ff000, 0x000ff600, 0x000ffa00, 0x000ffc00, 0x000ffe00,
+    0x00100400, 0x00100800, 0x00100a00, 0x00100c00, 0x00101200, 0x00101600, 0x00101800, 0x00101c00,
+    0x00102400, 0x00102600, 0x00102a00, 0x00102c00, 0x00103200, 0x00103400, 0x00103800, 0x00103a00,
+    0x00104000, 0x00104200, 0x00104800, 0x00104c00, 0x00104e00, 0x00105200, 0x00105600, 0x00105a00,
+    0x00106000, 0x00106200, 0x00106400, 0x00106800, 0x00106e00, 0x00107000, 0x00107400, 0x00107600,
+    0x00107c00, 0x00107e00, 0x00108400, 0x00108600, 0x00108a00, 0x00108c00, 0x00109200, 0x00109600,
+    0x00109e00, 0x0010a000, 0x0010a400, 0x0010a600, 0x0010ac00, 0x0010ae00, 0x0010b400, 0x0010b800,
+    0x0010bc00, 0x0010c000, 0x0010c200, 0x0010c600, 0x0010ca00, 0x0010ce00, 0x0010d400, 0x0010d600,
+    0x0010dc00, 0x0010de00, 0x0010e200, 0x0010e400, 0x0010ea00, 0x0010ec00, 0x0010f200, 0x0010f600,
+    0x0010fc00, 0x0010fe00, 0x00110000, 0x00110400, 0x00110a00, 0x00110c00, 0x00111200, 0x00111400,
+    0x00111a00, 0x00111e00, 0x00112000, 0x00112200, 0x00112800, 0x00112c00, 0x00113000, 0x00113400,
+    0x00113a00, 0x00113c00, 0x00114000, 0x00114200, 0x00114800, 0x00114a00, 0x00115000, 0x00115200,
+    0x00115800, 0x00115c00, 0x00115e00, 0x00116200, 0x00116600, 0x00116a00, 0x00117000, 0x00117200,
+    0x00117800, 0x00117a00, 0x00117e00, 0x00118000, 0x00118600, 0x00118800, 0x00118e00, 0x00119200,
+    0x00119a00, 0x00119c00, 0x0011a000, 0x0011a200, 0x0011a800, 0x0011aa00, 0x0011b000, 0x0011b400,
+    0x0011b800, 0x0011bc00, 0x0011c200, 0x0011c400, 0x0011ca00, 0x0011cc00, 0x0011d000, 0x0011d200,
+    0x0011da00, 0x0011de00, 0x0011e000, 0x0011e400, 0x0011ea00, 0x0011ec00, 0x0011f200, 0x0011f400,
+    0x0011fa00, 0x0011fe00, 0x00120200, 0x00120600, 0x00120c00, 0x00120e00, 0x00121000, 0x00121400,
+    0x00122000, 0x00122200, 0x00122400, 0x00122800, 0x00122e00, 0x00123000, 0x00123600, 0x00123800,
+    0x00123e00, 0x00124200, 0x00124600, 0x00124a00, 0x00125000, 0x00125200, 0x00125400, 0x00125800,
+    0x00126000, 0x00126400, 0x00126800, 0x00126c00, 0x00127200, 0x00127400, 0x00127a00, 0x00127c00,
+    0x00128200, 0x00128600, 0x00128a00, 0x00128e00, 0x00129400, 0x00129600, 0x00129c00, 0x00129e00,
+    0x0012a800, 0x0012aa00, 0x0012b000, 0x0012b200, 0x0012b800, 0x0012ba00, 0x0012c000, 0x0012c400,
+    0x0012ca00, 0x0012cc00, 0x0012d200, 0x0012d400, 0x0012da00, 0x0012dc00, 0x0012e200, 0x0012e600,
+    0x0012ec00, 0x0012ee00, 0x0012f400, 0x0012f600, 0x0012fc00, 0x0012fe00, 0x00130400, 0x00130800,
+    0x00130e00, 0x00131000, 0x00131600, 0x00131800, 0x00131e00, 0x00132000, 0x00132600, 0x00132a00,
+    0x00133200, 0x00133400, 0x00133a00, 0x00133e00, 0x00134200, 0x00134600, 0x00134c00, 0x00134e00,
+    0x00135400, 0x00135a00, 0x00135c00, 0x00136200, 0x00136400, 0x00136a00, 0x00136e00, 0x00137400,
+    0x00137800, 0x00137c00, 0x00138200, 0x00138400, 0x00138a00, 0x00138c00, 0x00139200, 0x00139600,
+    0x00139a00, 0x0013a000, 0x0013a400, 0x0013aa00, 0x0013ac00, 0x0013b200, 0x0013b400, 0x0013ba00,
+    0x0013c200, 0x0013c600, 0x0013cc00, 0x0013ce00, 0x0013d400, 0x0013da00, 0x0013dc00, 0x0013e200,
+    0x0013e800, 0x0013ea00, 0x0013f000, 0x0013f200, 0x0013f800, 0x0013fe00, 0x00140000, 0x00140600,
+    0x00140c00, 0x00141000, 0x00141400, 0x00141800, 0x00141e00, 0x00142200, 0x00142600, 0x00142c00,
+    0x00143200, 0x00143400, 0x00143a00, 0x00143c00, 0x00144200, 0x00144800, 0x00144a00, 0x00145000,
+    0x00145600, 0x00145800, 0x00145e00, 0x00146200, 0x00146600, 0x00146c00, 0x00147000, 0x00147600,
+    0x00147a00, 0x00147e00, 0x00148400, 0x00148600, 0x00148c00, 0x00149200, 0x00149400, 0x00149a00,
+    0x0014a200, 0x0014a600, 0x0014aa00, 0x0014ae00, 0x0014b400, 0x0014ba00, 0x0014bc00, 0x0014c200,
+    0x0014c800, 0x0014cc00, 0x0014d000, 0x0014d600, 0x0014dc00, 0x0014de00, 0x0014e400, 0x0014e600,
+    0x0014ee00, 0x0014f200, 0x0014f800, 0x0014fa00, 0x00150000, 0x00150600, 0x00150800, 0x00150e00,
+    0x00151400, 0x00151a00, 0x00151c00, 0x00152200, 0x00152800, 0x00152a00, 0x00153000, 0x00153400,
+    0x00153c00, 0x00153e00, 0x00154400, 0x00154a00, 0x00155000, 0x00155200, 0x00155800, 0x00155e00,
+    0x00156400, 0x00156600, 0x00156c00, 0x00157200, 0x00157800, 0x00157a00, 0x00158000, 0x00158600,
+    0x00158a00, 0x00158e00, 0x00159400, 0x00159a00, 0x00159e00, 0x0015a200, 0x0015a800, 0x0015ac00,
+    0x0015b200, 0x0015b600, 0x0015bc00, 0x0015c000, 0x0015c600, 0x0015ca00, 0x0015ce00, 0x0015d400,
+    0x0015de00, 0x0015e000, 0x0015e600, 0x0015ec00, 0x0015f000, 0x0015f400, 0x0015fa00, 0x00160000,
+    0x00160400, 0x00160800, 0x00160e00, 0x00161200, 0x00161800, 0x00161c00, 0x00162200, 0x00162600,
+    0x00162c00, 0x00163000, 0x00163400, 0x00163a00, 0x00164000, 0x00164400, 0x00164800, 0x00164e00,
+    0x00165400, 0x00165a00, 0x00166000, 0x00166200, 0x00166800, 0x00166e00, 0x00167400, 0x00167600,
+    0x00167e00, 0x00168200, 0x00168800, 0x00168c00, 0x00169200, 0x00169800, 0x00169e00, 0x0016a000,
+    0x0016aa00, 0x0016ac00, 0x0016b200, 0x0016b800, 0x0016bc00, 0x0016c200, 0x0016c800, 0x0016cc00,
+    0x0016d400, 0x0016d600, 0x0016dc00, 0x0016e200, 0x0016e800, 0x0016ee00, 0x0016f200, 0x0016f600,
+    0x0016fe00, 0x00170200, 0x00170600, 0x00170c00, 0x00171200, 0x00171800, 0x00171e00, 0x00172000,
+    0x00172800, 0x00172c00, 0x00173200, 0x00173600, 0x00173c00, 0x00174200, 0x00174800, 0x00174a00,
+    0x00175400, 0x00175600, 0x00175c00, 0x00176200, 0x00176800, 0x00176c00, 0x00177200, 0x00177600,
+    0x00177e00, 0x00178000, 0x00178600, 0x00178c00, 0x00179200, 0x00179800, 0x00179c00, 0x0017a000,
+    0x0017a800, 0x0017ae00, 0x0017b400, 0x0017b600, 0x0017be00, 0x0017c200, 0x0017c800, 0x0017ce00,
+    0x0017d600, 0x0017d800, 0x0017de00, 0x0017e400, 0x0017ea00, 0x0017f000, 0x0017f400, 0x0017f800,
+    0x00180000, 0x00180600, 0x00180c00, 0x00180e00, 0x00181600, 0x00181a00, 0x00182000, 0x00182400,
+    0x00183000, 0x00183400, 0x00183800, 0x00183e00, 0x00184400, 0x00184a00, 0x00185000, 0x00185200,
+    0x00185a00, 0x00186000, 0x00186600, 0x00186a00, 0x00187200, 0x00187400, 0x00187a00, 0x00188000,
+    0x00188800, 0x00188e00, 0x00189400, 0x00189a00, 0x00189c00, 0x0018a400, 0x0018a800, 0x0018b000,
+    0x0018b600, 0x0018bc00, 0x0018c000, 0x0018c600, 0x0018ca00, 0x0018d200, 0x0018d400, 0x0018de00,
+    0x0018e600, 0x0018ec00, 0x0018f200, 0x0018f600, 0x0018fa00, 0x00190200, 0x00190400, 0x00190e00,
+    0x00191400, 0x00191800, 0x00191e00, 0x00192400, 0x00192600, 0x00193000, 0x00193200, 0x00193a00,
+    0x00194000, 0x00194600, 0x00194c00, 0x00195200, 0x00195400, 0x00195c00, 0x00196000, 0x00196800,
+    0x00196e00, 0x00197400, 0x00197a00, 0x00197e00, 0x00198200, 0x00198a00, 0x00198c00, 0x00199600,
+    0x0019a000, 0x0019a600, 0x0019ac00, 0x0019b200, 0x0019b400, 0x0019be00, 0x0019c000, 0x0019c800,
+    0x0019ce00, 0x0019d400, 0x0019da00, 0x0019e000, 0x0019e200, 0x0019ea00, 0x0019ee00, 0x0019f600,
+    0x0019fe00, 0x001a0400, 0x001a0a00, 0x001a1000, 0x001a1200, 0x001a1a00, 0x001a1e00, 0x001a2600,
+    0x001a2c00, 0x001a3200, 0x001a3800, 0x001a3c00, 0x001a4000, 0x001a4800, 0x001a4a00, 0x001a5400,
+    0x001a5e00, 0x001a6400, 0x001a6a00, 0x001a7000, 0x001a7200, 0x001a7c00, 0x001a7e00, 0x001a8600,
+    0x001a8c00, 0x001a9200, 0x001a9800, 0x001a9e00, 0x001aa600, 0x001aae00, 0x001ab000, 0x001aba00,
+    0x001ac200, 0x001ac800, 0x001ace00, 0x001ad200, 0x001ad600, 0x001ade00, 0x001ae200, 0x001aea00,
+    0x001af000, 0x001af400, 0x001afa00, 0x001b0000, 0x001b0800, 0x001b1200, 0x001b1400, 0x001b1c00,
+    0x001b2600, 0x001b2a00, 0x001b3000, 0x001b3600, 0x001b3800, 0x001b4200, 0x001b4400, 0x001b4c00,
+    0x001b5200, 0x001b5800, 0x001b5e00, 0x001b6400, 0x001b6c00, 0x001b7400, 0x001b7800, 0x001b8000,
+    0x001b8c00, 0x001b9000, 0x001b9600, 0x001b9c00, 0x001b9e00, 0x001ba800, 0x001baa00, 0x001bb200,
+    0x001bb800, 0x001bbe00, 0x001bc400, 0x001bca00, 0x001bd200, 0x001bda00, 0x001bde00, 0x001be600,
+    0x001bf200, 0x001bf600, 0x001bfc00, 0x001c0200, 0x001c0600, 0x001c0e00, 0x001c1000, 0x001c1800,
+    0x001c1e00, 0x001c2400, 0x001c2a00, 0x001c3000, 0x001c3800, 0x001c4000, 0x001c4400, 0x001c4c00,
+    0x001c5a00, 0x001c6000, 0x001c6600, 0x001c6c00, 0x001c6e00, 0x001c7600, 0x001c7a00, 0x001c8200,
+    0x001c8800, 0x001c8e00, 0x001c9200, 0x001c9800, 0x001ca000, 0x001caa00, 0x001cac00, 0x001cb400,
+    0x001cc000, 0x001cc800, 0x001ccc00, 0x001cd400, 0x001cd800, 0x001ce000, 0x001ce400, 0x001ce800,
+    0x001cf400, 0x001cfc00, 0x001d0000, 0x001d0400, 0x001d1000, 0x001d1800, 0x001d1c00, 0x001d2400,
+    0x001d2c00, 0x001d3400, 0x001d3800, 0x001d4000, 0x001d4400, 0x001d4c00, 0x001d5000, 0x001d5400,
+    0x001d6000, 0x001d6800, 0x001d6c00, 0x001d7000, 0x001d7c00, 0x001d8400, 0x001d8800, 0x001d9000,
+    0x001d9800, 0x001da000, 0x001da400, 0x001dac00, 0x001db000, 0x001db400, 0x001dbc00, 0x001dc000,
+    0x001dcc00, 0x001dd400, 0x001dd800, 0x001ddc00, 0x001de800, 0x001df000, 0x001df400, 0x001df800,
+    0x001e0400, 0x001e0c00, 0x001e1000, 0x001e1800, 0x001e2000, 0x001e2800, 0x001e2c00, 0x001e3400,
+    0x001e3c00, 0x001e4400, 0x001e4800, 0x001e5000, 0x001e5c00, 0x001e6000, 0x001e6400, 0x001e6c00,
+    0x001e7800, 0x001e7c00, 0x001e8000, 0x001e8800, 0x001e9400, 0x001e9800, 0x001ea000, 0x001ea400,
+    0x001eb000, 0x001eb400, 0x001ebc00, 0x001ec000, 0x001ecc00, 0x001ed000, 0x001ed800, 0x001edc00,
+    0x001ee800, 0x001eec00, 0x001ef400, 0x001ef800, 0x001f0400, 0x001f0800, 0x001f1000, 0x001f1400,
+    0x001f2000, 0x001f2800, 0x001f2c00, 0x001f3000, 0x001f3c00, 0x001f4400, 0x001f4800, 0x001f4c00,
+    0x001f5800, 0x001f6000, 0x001f6400, 0x001f6c00, 0x001f7400, 0x001f7c00, 0x001f8000, 0x001f8800,
+    0x001f9000, 0x001f9800, 0x001fa400, 0x001fa800, 0x001fb000, 0x001fb400, 0x001fc000, 0x001fc400,
+    0x001fd000, 0x001fd400, 0x001fdc00, 0x001fe000, 0x001fec00, 0x001ff400, 0x001ff800, 0x001ffc00,
+    0x00200800, 0x00201000, 0x00201400, 0x00201800, 0x00202400, 0x00202c00, 0x00203000, 0x00203800,
+    0x00204800, 0x00204c00, 0x00205400, 0x00205800, 0x00206400, 0x00206800, 0x00207000, 0x00207400,
+    0x00208000, 0x00208400, 0x00209000, 0x00209800, 0x00209c00, 0x0020a400, 0x0020ac00, 0x0020b400,
+    0x0020c000, 0x0020c400, 0x0020c800, 0x0020d000, 0x0020dc00, 0x0020e000, 0x0020e800, 0x0020ec00,
+    0x0020f800, 0x0020fc00, 0x00210800, 0x00210c00, 0x00211400, 0x00211800, 0x00212400, 0x00212c00,
+    0x00213c00, 0x00214000, 0x00214800, 0x00214c00, 0x00215800, 0x00215c00, 0x00216800, 0x00217000,
+    0x00217800, 0x00218000, 0x00218400, 0x00218c00, 0x00219400, 0x00219c00, 0x0021a800, 0x0021ac00,
+    0x0021b800, 0x0021bc00, 0x0021c400, 0x0021c800, 0x0021d400, 0x0021d800, 0x0021e400, 0x0021ec00,
+    0x0021f800, 0x0021fc00, 0x00220000, 0x00220800, 0x00221400, 0x00221800, 0x00222400, 0x00222800,
+    0x00223400, 0x00223c00, 0x00224000, 0x00224400, 0x00225000, 0x00225800, 0x00226000, 0x00226800,
+    0x00227400, 0x00227800, 0x00228000, 0x00228400, 0x00229000, 0x00229400, 0x0022a000, 0x0022a400,
+    0x0022b000, 0x0022b800, 0x0022bc00, 0x0022c400, 0x0022cc00, 0x0022d400, 0x0022e000, 0x0022e400,
+    0x0022f000, 0x0022f400, 0x0022fc00, 0x00230000, 0x00230c00, 0x00231000, 0x00231c00, 0x00232400,
+    0x00233400, 0x00233800, 0x00234000, 0x00234400, 0x00235000, 0x00235400, 0x00236000, 0x00236800,
+    0x00237000, 0x00237800, 0x00238400, 0x00238800, 0x00239400, 0x00239800, 0x0023a000, 0x0023a400,
+    0x0023b400, 0x0023bc00, 0x0023c000, 0x0023c800, 0x0023d400, 0x0023d800, 0x0023e400, 0x0023e800,
+    0x0023f400, 0x0023fc00, 0x00240400, 0x00240c00, 0x00241800, 0x00241c00, 0x00242000, 0x00242800,
+    0x00244000, 0x00244400, 0x00244800, 0x00245000, 0x00245c00, 0x00246000, 0x00246c00, 0x00247000,
+    0x00247c00, 0x00248400, 0x00248c00, 0x00249400, 0x0024a000, 0x0024a400, 0x0024a800, 0x0024b000,
+    0x0024c000, 0x0024c800, 0x0024d000, 0x0024d800, 0x0024e400, 0x0024e800, 0x0024f400, 0x0024f800,
+    0x00250400, 0x00250c00, 0x00251400, 0x00251c00, 0x00252800, 0x00252c00, 0x00253800, 0x00253c00,
+    0x00255000, 0x00255400, 0x00256000, 0x00256400, 0x00257000, 0x00257400, 0x00258000, 0x00258800,
+    0x00259400, 0x00259800, 0x0025a400, 0x0025a800, 0x0025b400, 0x0025b800, 0x0025c400, 0x0025cc00,
+    0x0025d800, 0x0025dc00, 0x0025e800, 0x0025ec00, 0x0025f800, 0x0025fc00, 0x00260800, 0x00261000,
+    0x00261c00, 0x00262000, 0x00262c00, 0x00263000, 0x00263c00, 0x00264000, 0x00264c00, 0x00265400,
+    0x00266400, 0x00266800, 0x00267400, 0x00267c00, 0x00268400, 0x00268c00, 0x00269800, 0x00269c00,
+    0x0026a800, 0x0026b400, 0x0026b800, 0x0026c400, 0x0026c800, 0x0026d400, 0x0026dc00, 0x0026e800,
+    0x0026f000, 0x0026f800, 0x00270400, 0x00270800, 0x00271400, 0x00271800, 0x00272400, 0x00272c00,
+    0x00273400, 0x00274000, 0x00274800, 0x00275400, 0x00275800, 0x00276400, 0x00276800, 0x00277400,
+    0x00278400, 0x00278c00, 0x00279800, 0x00279c00, 0x0027a800, 0x0027b400, 0x0027b800, 0x0027c400,
+    0x0027d000, 0x0027d400, 0x0027e000, 0x0027e400, 0x0027f000, 0x0027fc00, 0x00280000, 0x00280c00,
+    0x00281800, 0x00282000, 0x00282800, 0x00283000, 0x00283c00, 0x00284400, 0x00284c00, 0x00285800,
+    0x00286400, 0x00286800, 0x00287400, 0x00287800, 0x00288400, 0x00289000, 0x00289400, 0x0028a000,
+    0x0028ac00, 0x0028b000, 0x0028bc00, 0x0028c400, 0x0028cc00, 0x0028d800, 0x0028e000, 0x0028ec00,
+    0x0028f400, 0x0028fc00, 0x00290800, 0x00290c00, 0x00291800, 0x00292400, 0x00292800, 0x00293400,
+    0x00294400, 0x00294c00, 0x00295400, 0x00295c00, 0x00296800, 0x00297400, 0x00297800, 0x00298400,
+    0x00299000, 0x00299800, 0x0029a000, 0x0029ac00, 0x0029b800, 0x0029bc00, 0x0029c800, 0x0029cc00,
+    0x0029dc00, 0x0029e400, 0x0029f000, 0x0029f400, 0x002a0000, 0x002a0c00, 0x002a1000, 0x002a1c00,
+    0x002a2800, 0x002a3400, 0x002a3800, 0x002a4400, 0x002a5000, 0x002a5400, 0x002a6000, 0x002a6800,
+    0x002a7800, 0x002a7c00, 0x002a8800, 0x002a9400, 0x002aa000, 0x002aa400, 0x002ab000, 0x002abc00,
+    0x002ac800, 0x002acc00, 0x002ad800, 0x002ae400, 0x002af000, 0x002af400, 0x002b0000, 0x002b0c00,
+    0x002b1400, 0x002b1c00, 0x002b2800, 0x002b3400, 0x002b3c00, 0x002b4400, 0x002b5000, 0x002b5800,
+    0x002b6400, 0x002b6c00, 0x002b7800, 0x002b8000, 0x002b8c00, 0x002b9400, 0x002b9c00, 0x002ba800,
+    0x002bbc00, 0x002bc000, 0x002bcc00, 0x002bd800, 0x002be000, 0x002be800, 0x002bf400, 0x002c0000,
+    0x002c0800, 0x002c1000, 0x002c1c00, 0x002c2400, 0x002c3000, 0x002c3800, 0x002c4400, 0x002c4c00,
+    0x002c5800, 0x002c6000, 0x002c6800, 0x002c7400, 0x002c8000, 0x002c8800, 0x002c9000, 0x002c9c00,
+    0x002ca800, 0x002cb400, 0x002cc000, 0x002cc400, 0x002cd000, 0x002cdc00, 0x002ce800, 0x002cec00,
+    0x002cfc00, 0x002d0400, 0x002d1000, 0x002d1800, 0x002d2400, 0x002d3000, 0x002d3c00, 0x002d4000,
+    0x002d5400, 0x002d5800, 0x002d6400, 0x002d7000, 0x002d7800, 0x002d8400, 0x002d9000, 0x002d9800,
+    0x002da800, 0x002dac00, 0x002db800, 0x002dc400, 0x002dd000, 0x002ddc00, 0x002de400, 0x002dec00,
+    0x002dfc00, 0x002e0400, 0x002e0c00, 0x002e1800, 0x002e2400, 0x002e3000, 0x002e3c00, 0x002e4000,
+    0x002e5000, 0x002e5800, 0x002e6400, 0x002e6c00, 0x002e7800, 0x002e8400, 0x002e9000, 0x002e9400,
+    0x002ea800, 0x002eac00, 0x002eb800, 0x002ec400, 0x002ed000, 0x002ed800, 0x002ee400, 0x002eec00,
+    0x002efc00, 0x002f0000, 0x002f0c00, 0x002f1800, 0x002f2400, 0x002f3000, 0x002f3800, 0x002f4000,
+    0x002f5000, 0x002f5c00, 0x002f6800, 0x002f6c00, 0x002f7c00, 0x002f8400, 0x002f9000, 0x002f9c00,
+    0x002fac00, 0x002fb000, 0x002fbc00, 0x002fc800, 0x002fd400, 0x002fe000, 0x002fe800, 0x002ff000,
+    0x00300000, 0x00300c00, 0x00301800, 0x00301c00, 0x00302c00, 0x00303400, 0x00304000, 0x00304800,
+    0x00306000, 0x00306800, 0x00307000, 0x00307c00, 0x00308800, 0x00309400, 0x0030a000, 0x0030a400,
+    0x0030b400, 0x0030c000, 0x0030cc00, 0x0030d400, 0x0030e400, 0x0030e800, 0x0030f400, 0x00310000,
+    0x00311000, 0x00311c00, 0x00312800, 0x00313400, 0x00313800, 0x00314800, 0x00315000, 0x00316000,
+    0x00316c00, 0x00317800, 0x00318000, 0x00318c00, 0x00319400, 0x0031a400, 0x0031a800, 0x0031bc00,
+    0x0031cc00, 0x0031d800, 0x0031e400, 0x0031ec00, 0x0031f400, 0x00320400, 0x00320800, 0x00321c00,
+    0x00322800, 0x00323000, 0x00323c00, 0x00324800, 0x00324c00, 0x00326000, 0x00326400, 0x00327400,
+    0x00328000, 0x00328c00, 0x00329800, 0x0032a400, 0x0032a800, 0x0032b800, 0x0032c000, 0x0032d000,
+    0x0032dc00, 0x0032e800, 0x0032f400, 0x0032fc00, 0x00330400, 0x00331400, 0x00331800, 0x00332c00,
+    0x00334000, 0x00334c00, 0x00335800, 0x00336400, 0x00336800, 0x00337c00, 0x00338000, 0x00339000,
+    0x00339c00, 0x0033a800, 0x0033b400, 0x0033c000, 0x0033c400, 0x0033d400, 0x0033dc00, 0x0033ec00,
+    0x0033fc00, 0x00340800, 0x00341400, 0x00342000, 0x00342400, 0x00343400, 0x00343c00, 0x00344c00,
+    0x00345800, 0x00346400, 0x00347000, 0x00347800, 0x00348000, 0x00349000, 0x00349400, 0x0034a800,
+    0x0034bc00, 0x0034c800, 0x0034d400, 0x0034e000, 0x0034e400, 0x0034f800, 0x0034fc00, 0x00350c00,
+    0x00351800, 0x00352400, 0x00353000, 0x00353c00, 0x00354c00, 0x00355c00, 0x00356000, 0x00357400,
+    0x00358400, 0x00359000, 0x00359c00, 0x0035a400, 0x0035ac00, 0x0035bc00, 0x0035c400, 0x0035d400,
+    0x0035e000, 0x0035e800, 0x0035f400, 0x00360000, 0x00361000, 0x00362400, 0x00362800, 0x00363800,
+    0x00364c00, 0x00365400, 0x00366000, 0x00366c00, 0x00367000, 0x00368400, 0x00368800, 0x00369800,
+    0x0036a400, 0x0036b000, 0x0036bc00, 0x0036c800, 0x0036d800, 0x0036e800, 0x0036f000, 0x00370000,
+    0x00371800, 0x00372000, 0x00372c00, 0x00373800, 0x00373c00, 0x00375000, 0x00375400, 0x00376400,
+    0x00377000, 0x00377c00, 0x00378800, 0x00379400, 0x0037a400, 0x0037b400, 0x0037bc00, 0x0037cc00,
+    0x0037e400, 0x0037ec00, 0x0037f800, 0x00380400, 0x00380c00, 0x00381c00, 0x00382000, 0x00383000,
+    0x00383c00, 0x00384800, 0x00385400, 0x00386000, 0x00387000, 0x00388000, 0x00388800, 0x00389800,
+    0x0038b400, 0x0038c000, 0x0038cc00, 0x0038d800, 0x0038dc00, 0x0038ec00, 0x0038f400, 0x00390400,
+    0x00391000, 0x00391c00, 0x00392400, 0x00393000, 0x00394000, 0x00395400, 0x00395800, 0x00396800,
+    0x00398000, 0x00399000, 0x00399800, 0x0039a800, 0x0039b000, 0x0039c000, 0x0039c800, 0x0039d000,
+    0x0039e800, 0x0039f800, 0x003a0000, 0x003a0800, 0x003a2000, 0x003a3000, 0x003a3800, 0x003a4800,
+    0x003a5800, 0x003a6800, 0x003a7000, 0x003a8000, 0x003a8800, 0x003a9800, 0x003aa000, 0x003aa800,
+    0x003ac000, 0x003ad000, 0x003ad800, 0x003ae000, 0x003af800, 0x003b0800, 0x003b1000, 0x003b2000,
+    0x003b3000, 0x003b4000, 0x003b4800, 0x003b5800, 0x003b6000, 0x003b6800, 0x003b7800, 0x003b8000,
+    0x003b9800, 0x003ba800, 0x003bb000, 0x003bb800, 0x003bd000, 0x003be000, 0x003be800, 0x003bf000,
+    0x003c0800, 0x003c1800, 0x003c2000, 0x003c3000, 0x003c4000, 0x003c5000, 0x003c5800, 0x003c6800,
+    0x003c7800, 0x003c8800, 0x003c9000, 0x003ca000, 0x003cb800, 0x003cc000, 0x003cc800, 0x003cd800,
+    0x003cf000, 0x003cf800, 0x003d0000, 0x003d1000, 0x003d2800, 0x003d3000, 0x003d4000, 0x003d4800,
+    0x003d6000, 0x003d6800, 0x003d7800, 0x003d8000, 0x003d9800, 0x003da000, 0x003db000, 0x003db800,
+    0x003dd000, 0x003dd800, 0x003de800, 0x003df000, 0x003e0800, 0x003e1000, 0x003e2000, 0x003e2800,
+    0x003e4000, 0x003e5000, 0x003e5800, 0x003e6000, 0x003e7800, 0x003e8800, 0x003e9000, 0x003e9800,
+    0x003eb000, 0x003ec000, 0x003ec800, 0x003ed800, 0x003ee800, 0x003ef800, 0x003f0000, 0x003f1000,
+    0x003f2000, 0x003f3000, 0x003f4800, 0x003f5000, 0x003f6000, 0x003f6800, 0x003f8000, 0x003f8800,
+    0x003fa000, 0x003fa800, 0x003fb800, 0x003fc000, 0x003fd800, 0x003fe800, 0x003ff000, 0x003ff800,
+    0x00401000, 0x00402000, 0x00402800, 0x00403000, 0x00404800, 0x00405800, 0x00406000, 0x00407000,
+    0x00409000, 0x00409800, 0x0040a800, 0x0040b000, 0x0040c800, 0x0040d000, 0x0040e000, 0x0040e800,
+    0x00410000, 0x00410800, 0x00412000, 0x00413000, 0x00413800, 0x00414800, 0x00415800, 0x00416800,
+    0x00418000, 0x00418800, 0x00419000, 0x0041a000, 0x0041b800, 0x0041c000, 0x0041d000, 0x0041d800,
+    0x0041f000, 0x0041f800, 0x00421000, 0x00421800, 0x00422800, 0x00423000, 0x00424800, 0x00425800,
+    0x00427800, 0x00428000, 0x00429000, 0x00429800, 0x0042b000, 0x0042b800, 0x0042d000, 0x0042e000,
+    0x0042f000, 0x00430000, 0x00430800, 0x00431800, 0x00432800, 0x00433800, 0x00435000, 0x00435800,
+    0x00437000, 0x00437800, 0x00438800, 0x00439000, 0x0043a800, 0x0043b000, 0x0043c800, 0x0043d800,
+    0x0043f000, 0x0043f800, 0x00440000, 0x00441000, 0x00442800, 0x00443000, 0x00444800, 0x00445000,
+    0x00446800, 0x00447800, 0x00448000, 0x00448800, 0x0044a000, 0x0044b000, 0x0044c000, 0x0044d000,
+    0x0044e800, 0x0044f000, 0x00450000, 0x00450800, 0x00452000, 0x00452800, 0x00454000, 0x00454800,
+    0x00456000, 0x00457000, 0x00457800, 0x00458800, 0x00459800, 0x0045a800, 0x0045c000, 0x0045c800,
+    0x0045e000, 0x0045e800, 0x0045f800, 0x00460000, 0x00461800, 0x00462000, 0x00463800, 0x00464800,
+    0x00466800, 0x00467000, 0x00468000, 0x00468800, 0x0046a000, 0x0046a800, 0x0046c000, 0x0046d000,
+    0x0046e000, 0x0046f000, 0x00470800, 0x00471000, 0x00472800, 0x00473000, 0x00474000, 0x00474800,
+    0x00476800, 0x00477800, 0x00478000, 0x00479000, 0x0047a800, 0x0047b000, 0x0047c800, 0x0047d000,
+    0x0047e800, 0x0047f800, 0x00480800, 0x00481800, 0x00483000, 0x00483800, 0x00484000, 0x00485000,
+    0x00488000, 0x00488800, 0x00489000, 0x0048a000, 0x0048b800, 0x0048c000, 0x0048d800, 0x0048e000,
+    0x0048f800, 0x00490800, 0x00491800, 0x00492800, 0x00494000, 0x00494800, 0x00495000, 0x00496000,
+    0x00498000, 0x00499000, 0x0049a000, 0x0049b000, 0x0049c800, 0x0049d000, 0x0049e800, 0x0049f000,
+    0x004a0800, 0x004a1800, 0x004a2800, 0x004a3800, 0x004a5000, 0x004a5800, 0x004a7000, 0x004a7800,
+    0x004aa000, 0x004aa800, 0x004ac000, 0x004ac800, 0x004ae000, 0x004ae800, 0x004b0000, 0x004b1000,
+    0x004b2800, 0x004b3000, 0x004b4800, 0x004b5000, 0x004b6800, 0x004b7000, 0x004b8800, 0x004b9800,
+    0x004bb000, 0x004bb800, 0x004bd000, 0x004bd800, 0x004bf000, 0x004bf800, 0x004c1000, 0x004c2000,
+    0x004c3800, 0x004c4000, 0x004c5800, 0x004c6000, 0x004c7800, 0x004c8000, 0x004c9800, 0x004ca800,
+    0x004cc800, 0x004cd000, 0x004ce800, 0x004cf800, 0x004d0800, 0x004d1800, 0x004d3000, 0x004d3800,
+    0x004d5000, 0x004d6800, 0x004d7000, 0x004d8800, 0x004d9000, 0x004da800, 0x004db800, 0x004dd000,
+    0x004de000, 0x004df000, 0x004e0800, 0x004e1000, 0x004e2800, 0x004e3000, 0x004e4800, 0x004e5800,
+    0x004e6800, 0x004e8000, 0x004e9000, 0x004ea800, 0x004eb000, 0x004ec800, 0x004ed000, 0x004ee800,
+    0x004f0800, 0x004f1800, 0x004f3000, 0x004f3800, 0x004f5000, 0x004f6800, 0x004f7000, 0x004f8800,
+    0x004fa000, 0x004fa800, 0x004fc000, 0x004fc800, 0x004fe000, 0x004ff800, 0x00500000, 0x00501800,
+    0x00503000, 0x00504000, 0x00505000, 0x00506000, 0x00507800, 0x00508800, 0x00509800, 0x0050b000,
+    0x0050c800, 0x0050d000, 0x0050e800, 0x0050f000, 0x00510800, 0x00512000, 0x00512800, 0x00514000,
+    0x00515800, 0x00516000, 0x00517800, 0x00518800, 0x00519800, 0x0051b000, 0x0051c000, 0x0051d800,
+    0x0051e800, 0x0051f800, 0x00521000, 0x00521800, 0x00523000, 0x00524800, 0x00525000, 0x00526800,
+    0x00528800, 0x00529800, 0x0052a800, 0x0052b800, 0x0052d000, 0x0052e800, 0x0052f000, 0x00530800,
+    0x00532000, 0x00533000, 0x00534000, 0x00535800, 0x00537000, 0x00537800, 0x00539000, 0x00539800,
+    0x0053b800, 0x0053c800, 0x0053e000, 0x0053e800, 0x00540000, 0x00541800, 0x00542000, 0x00543800,
+    0x00545000, 0x00546800, 0x00547000, 0x00548800, 0x0054a000, 0x0054a800, 0x0054c000, 0x0054d000,
+    0x0054f000, 0x0054f800, 0x00551000, 0x00552800, 0x00554000, 0x00554800, 0x00556000, 0x00557800,
+    0x00559000, 0x00559800, 0x0055b000, 0x0055c800, 0x0055e000, 0x0055e800, 0x00560000, 0x00561800,
+    0x00562800, 0x00563800, 0x00565000, 0x00566800, 0x00567800, 0x00568800, 0x0056a000, 0x0056b000,
+    0x0056c800, 0x0056d800, 0x0056f000, 0x00570000, 0x00571800, 0x00572800, 0x00573800, 0x00575000,
+    0x00577800, 0x00578000, 0x00579800, 0x0057b000, 0x0057c000, 0x0057d000, 0x0057e800, 0x00580000,
+    0x00581000, 0x00582000, 0x00583800, 0x00584800, 0x00586000, 0x00587000, 0x00588800, 0x00589800,
+    0x0058b000, 0x0058c000, 0x0058d000, 0x0058e800, 0x00590000, 0x00591000, 0x00592000, 0x00593800,
+    0x00595000, 0x00596800, 0x00598000, 0x00598800, 0x0059a000, 0x0059b800, 0x0059d000, 0x0059d800,
+    0x0059f800, 0x005a0800, 0x005a2000, 0x005a3000, 0x005a4800, 0x005a6000, 0x005a7800, 0x005a8000,
+    0x005aa800, 0x005ab000, 0x005ac800, 0x005ae000, 0x005af000, 0x005b0800, 0x005b2000, 0x005b3000,
+    0x005b5000, 0x005b5800, 0x005b7000, 0x005b8800, 0x005ba000, 0x005bb800, 0x005bc800, 0x005bd800,
+    0x005bf800, 0x005c0800, 0x005c1800, 0x005c3000, 0x005c4800, 0x005c6000, 0x005c7800, 0x005c8000,
+    0x005ca000, 0x005cb000, 0x005cc800, 0x005cd800, 0x005cf000, 0x005d0800, 0x005d2000, 0x005d2800,
+    0x005d5000, 0x005d5800, 0x005d7000, 0x005d8800, 0x005da000, 0x005db000, 0x005dc800, 0x005dd800,
+    0x005df800, 0x005e0000, 0x005e1800, 0x005e3000, 0x005e4800, 0x005e6000, 0x005e7000, 0x005e8000,
+    0x005ea000, 0x005eb800, 0x005ed000, 0x005ed800, 0x005ef800, 0x005f0800, 0x005f2000, 0x005f3800,
+    0x005f5800, 0x005f6000, 0x005f7800, 0x005f9000, 0x005fa800, 0x005fc000, 0x005fd000, 0x005fe000,
+    0x00600000, 0x00601800, 0x00603000, 0x00603800, 0x00605800, 0x00606800, 0x00608000, 0x00609000,
+    0x0060c000, 0x0060d000, 0x0060e000, 0x0060f800, 0x00611000, 0x00612800, 0x00614000, 0x00614800,
+    0x00616800, 0x00618000, 0x00619800, 0x0061a800, 0x0061c800, 0x0061d000, 0x0061e800, 0x00620000,
+    0x00622000, 0x00623800, 0x00625000, 0x00626800, 0x00627000, 0x00629000, 0x0062a000, 0x0062c000,
+    0x0062d800, 0x0062f000, 0x00630000, 0x00631800, 0x00632800, 0x00634800, 0x00635000, 0x00637800,
+    0x00639800, 0x0063b000, 0x0063c800, 0x0063d800, 0x0063e800, 0x00640800, 0x00641000, 0x00643800,
+    0x00645000, 0x00646000, 0x00647800, 0x00649000, 0x00649800, 0x0064c000, 0x0064c800, 0x0064e800,
+    0x00650000, 0x00651800, 0x00653000, 0x00654800, 0x00655000, 0x00657000, 0x00658000, 0x0065a000,
+    0x0065b800, 0x0065d000, 0x0065e800, 0x0065f800, 0x00660800, 0x00662800, 0x00663000, 0x00665800,
+    0x00668000, 0x00669800, 0x0066b000, 0x0066c800, 0x0066d000, 0x0066f800, 0x00670000, 0x00672000,
+    0x00673800, 0x00675000, 0x00676800, 0x00678000, 0x00678800, 0x0067a800, 0x0067b800, 0x0067d800,
+    0x0067f800, 0x00681000, 0x00682800, 0x00684000, 0x00684800, 0x00686800, 0x00687800, 0x00689800,
+    0x0068b000, 0x0068c800, 0x0068e000, 0x0068f000, 0x00690000, 0x00692000, 0x00692800, 0x00695000,
+    0x00697800, 0x00699000, 0x0069a800, 0x0069c000, 0x0069c800, 0x0069f000, 0x0069f800, 0x006a1800,
+    0x006a3000, 0x006a4800, 0x006a6000, 0x006a7800, 0x006a9800, 0x006ab800, 0x006ac000, 0x006ae800,
+    0x006b0800, 0x006b2000, 0x006b3800, 0x006b4800, 0x006b5800, 0x006b7800, 0x006b8800, 0x006ba800,
+    0x006bc000, 0x006bd000, 0x006be800, 0x006c0000, 0x006c2000, 0x006c4800, 0x006c5000, 0x006c7000,
+    0x006c9800, 0x006ca800, 0x006cc000, 0x006cd800, 0x006ce000, 0x006d0800, 0x006d1000, 0x006d3000,
+    0x006d4800, 0x006d6000, 0x006d7800, 0x006d9000, 0x006db000, 0x006dd000, 0x006de000, 0x006e0000,
+    0x006e3000, 0x006e4000, 0x006e5800, 0x006e7000, 0x006e7800, 0x006ea000, 0x006ea800, 0x006ec800,
+    0x006ee000, 0x006ef800, 0x006f1000, 0x006f2800, 0x006f4800, 0x006f6800, 0x006f7800, 0x006f9800,
+    0x006fc800, 0x006fd800, 0x006ff000, 0x00700800, 0x00701800, 0x00703800, 0x00704000, 0x00706000,
+    0x00707800, 0x00709000, 0x0070a800, 0x0070c000, 0x0070e000, 0x00710000, 0x00711000, 0x00713000,
+    0x00716800, 0x00718000, 0x00719800, 0x0071b000, 0x0071b800, 0x0071d800, 0x0071e800, 0x00720800,
+    0x00722000, 0x00723800, 0x00724800, 0x00726000, 0x00728000, 0x0072a800, 0x0072b000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000,
+    0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000, 0x0072d000
+};
+
+/* 8 DT1 levels, 32 KC values */
+static const int32_t dt1_freq_default[8*32] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 90, 90, 90, 90, 90, 90, 90, 90, 181, 181, 181, 181,
+    181, 272, 272, 272, 362, 362, 362, 453, 453, 544, 544, 634, 725, 725, 725, 725,
+    90, 90, 90, 90, 181, 181, 181, 181, 181, 272, 272, 272, 362, 362, 362, 453,
+    453, 544, 544, 634, 725, 725, 816, 907, 997, 1088, 1179, 1269, 1451, 1451, 1451, 1451,
+    181, 181, 181, 181, 181, 272, 272, 272, 362, 362, 362, 453, 453, 544, 544, 634,
+    725, 725, 816, 907, 997, 1088, 1179, 1269, 1451, 1541, 1723, 1814, 1995, 1995, 1995, 1995,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -90, -90, -90, -90, -90, -90, -90, -90, -181, -181, -181, -181,
+    -181, -272, -272, -272, -362, -362, -362, -453, -453, -544, -544, -634, -725, -725, -725, -725,
+    -90, -90, -90, -90, -181, -181, -181, -181, -181, -272, -272, -272, -362, -362, -362, -453,
+    -453, -544, -544, -634, -725, -725, -816, -907, -997, -1088, -1179, -1269, -1451, -1451, -1451, -1451,
+    -181, -181, -181, -181, -181, -272, -272, -272, -362, -362, -362, -453, -453, -544, -544, -634,
+    -725, -725, -816, -907, -997, -1088, -1179, -1269, -1451, -1541, -1723, -1814, -1995, -1995, -1995, -1995
+};
+
+/* 17bit Noise Generator periods */
+static const uint32_t noise_tab_default[32] =
+{
+    0x000016ac, 0x00001762, 0x00001817, 0x000018cd, 0x000019dd, 0x00001a92, 0x00001ba2, 0x00001cb2,
+    0x00001e1d, 0x00001f88, 0x000020f3, 0x0000225e, 0x00002423, 0x000025e9, 0x00002809, 0x00002a84,
+    0x00002d59, 0x0000302f, 0x000033ba, 0x000037a0, 0x00003c3b, 0x000041e6, 0x00004847, 0x0000506d,
+    0x00005ab3, 0x00006775, 0x000078d1, 0x000090e9, 0x0000b567, 0x0000f1a3, 0x00016acf, 0x00016acf
+};
+
+/* Timer A and B deltas (16.16 fixed point samples) */
+static const uint32_t tim_A_tab_default[1024] =
+{
+    0x02d288ce, 0x02d1d42c, 0x02d11f8a, 0x02d06ae7, 0x02cfb645, 0x02cf01a3, 0x02ce4d01, 0x02cd985f,
+    0x02cce3bc, 0x02cc2f1a, 0x02cb7a78, 0x02cac5d6, 0x02ca1134, 0x02c95c91, 0x02c8a7ef, 0x02c7f34d,
+    0x02c73eab, 0x02c68a09, 0x02c5d566, 0x02c520c4, 0x02c46c22, 0x02c3b780, 0x02c302de, 0x02c24e3b,
+    0x02c19999, 0x02c0e4f7, 0x02c03055, 0x02bf7bb2, 0x02bec710, 0x02be126e, 0x02bd5dcc, 0x02bca92a,
+    0x02bbf487, 0x02bb3fe5, 0x02ba8b43, 0x02b9d6a1, 0x02b921ff, 0x02b86d5c, 0x02b7b8ba, 0x02b70418,
+    0x02b64f76, 0x02b59ad4, 0x02b4e631, 0x02b4318f, 0x02b37ced, 0x02b2c84b, 0x02b213a9, 0x02b15f06,
+    0x02b0aa64, 0x02aff5c2, 0x02af4120, 0x02ae8c7e, 0x02add7db, 0x02ad2339, 0x02ac6e97, 0x02abb9f5,
+    0x02ab0553, 0x02aa50b0, 0x02a99c0e, 0x02a8e76c, 0x02a832ca, 0x02a77e28, 0x02a6c985, 0x02a614e3,
+    0x02a56041, 0x02a4ab9f, 0x02a3f6fd, 0x02a3425a, 0x02a28db8, 0x02a1d916, 0x02a12474, 0x02a06fd2,
+    0x029fbb2f, 0x029f068d, 0x029e51eb, 0x029d9d49, 0x029ce8a7, 0x029c3404, 0x029b7f62, 0x029acac0,
+    0x029a161e, 0x0299617c, 0x0298acd9, 0x0297f837, 0x02974395, 0x02968ef3, 0x0295da51, 0x029525ae,
+    0x0294710c, 0x0293bc6a, 0x029307c8, 0x02925326, 0x02919e83, 0x0290e9e1, 0x0290353f, 0x028f809d,
+    0x028ecbfb, 0x028e1758, 0x028d62b6, 0x028cae14, 0x028bf972, 0x028b44d0, 0x028a902d, 0x0289db8b,
+    0x028926e9, 0x02887247, 0x0287bda5, 0x02870902, 0x02865460, 0x02859fbe, 0x0284eb1c, 0x0284367a,
+    0x028381d7, 0x0282cd35, 0x02821893, 0x028163f1, 0x0280af4f, 0x027ffaac, 0x027f460a, 0x027e9168,
+    0x027ddcc6, 0x027d2824, 0x027c7381, 0x027bbedf, 0x027b0a3d, 0x027a559b, 0x0279a0f9, 0x0278ec56,
+    0x027837b4, 0x02778312, 0x0276ce70, 0x027619ce, 0x0275652b, 0x0274b089, 0x0273fbe7, 0x02734745,
+    0x027292a3, 0x0271de00, 0x0271295e, 0x027074bc, 0x026fc01a, 0x026f0b78, 0x026e56d5, 0x026da233,
+    0x026ced91, 0x026c38ef, 0x026b844d, 0x026acfaa, 0x026a1b08, 0x02696666, 0x0268b1c4, 0x0267fd21,
+    0x0267487f, 0x026693dd, 0x0265df3b, 0x02652a99, 0x026475f6, 0x0263c154, 0x02630cb2, 0x02625810,
+    0x0261a36e, 0x0260eecb, 0x02603a29, 0x025f8587, 0x025ed0e5, 0x025e1c43, 0x025d67a0, 0x025cb2fe,
+    0x025bfe5c, 0x025b49ba, 0x025a9518, 0x0259e075, 0x02592bd3, 0x02587731, 0x0257c28f, 0x02570ded,
+    0x0256594a, 0x0255a4a8, 0x0254f006, 0x02543b64, 0x025386c2, 0x0252d21f, 0x02521d7d, 0x025168db,
+    0x0250b439, 0x024fff97, 0x024f4af4, 0x024e9652, 0x024de1b0, 0x024d2d0e, 0x024c786c, 0x024bc3c9,
+    0x024b0f27, 0x024a5a85, 0x0249a5e3, 0x0248f141, 0x02483c9e, 0x024787fc, 0x0246d35a, 0x02461eb8,
+    0x02456a16, 0x0244b573, 0x024400d1, 0x02434c2f, 0x0242978d, 0x0241e2eb, 0x02412e48, 0x024079a6,
+    0x023fc504, 0x023f1062, 0x023e5bc0, 0x023da71d, 0x023cf27b, 0x023c3dd9, 0x023b8937, 0x023ad495,
+    0x023a1ff2, 0x02396b50, 0x0238b6ae, 0x0238020c, 0x02374d6a, 0x023698c7, 0x0235e425, 0x02352f83,
+    0x02347ae1, 0x0233c63f, 0x0233119c, 0x02325cfa, 0x0231a858, 0x0230f3b6, 0x02303f14, 0x022f8a71,
+    0x022ed5cf, 0x022e212d, 0x022d6c8b, 0x022cb7e9, 0x022c0346, 0x022b4ea4, 0x022a9a02, 0x0229e560,
+    0x022930be, 0x02287c1b, 0x0227c779, 0x022712d7, 0x02265e35, 0x0225a993, 0x0224f4f0, 0x0224404e,
+    0x02238bac, 0x0222d70a, 0x02222268, 0x02216dc5, 0x0220b923, 0x02200481, 0x021f4fdf, 0x021e9b3d,
+    0x021de69a, 0x021d31f8, 0x021c7d56, 0x021bc8b4, 0x021b1412, 0x021a5f6f, 0x0219aacd, 0x0218f62b,
+    0x02184189, 0x02178ce7, 0x0216d844, 0x021623a2, 0x02156f00, 0x0214ba5e, 0x021405bc, 0x02135119,
+    0x02129c77, 0x0211e7d5, 0x02113333, 0x02107e90, 0x020fc9ee, 0x020f154c, 0x020e60aa, 0x020dac08,
+    0x020cf765, 0x020c42c3, 0x020b8e21, 0x020ad97f, 0x020a24dd, 0x0209703a, 0x0208bb98, 0x020806f6,
+    0x02075254, 0x02069db2, 0x0205e90f, 0x0205346d, 0x02047fcb, 0x0203cb29, 0x02031687, 0x020261e4,
+    0x0201ad42, 0x0200f8a0, 0x020043fe, 0x01ff8f5c, 0x01fedab9, 0x01fe2617, 0x01fd7175, 0x01fcbcd3,
+    0x01fc0831, 0x01fb538e, 0x01fa9eec, 0x01f9ea4a, 0x01f935a8, 0x01f88106, 0x01f7cc63, 0x01f717c1,
+    0x01f6631f, 0x01f5ae7d, 0x01f4f9db, 0x01f44538, 0x01f39096, 0x01f2dbf4, 0x01f22752, 0x01f172b0,
+    0x01f0be0d, 0x01f0096b, 0x01ef54c9, 0x01eea027, 0x01edeb85, 0x01ed36e2, 0x01ec8240, 0x01ebcd9e,
+    0x01eb18fc, 0x01ea645a, 0x01e9afb7, 0x01e8fb15, 0x01e84673, 0x01e791d1, 0x01e6dd2f, 0x01e6288c,
+    0x01e573ea, 0x01e4bf48, 0x01e40aa6, 0x01e35604, 0x01e2a161, 0x01e1ecbf, 0x01e1381d, 0x01e0837b,
+    0x01dfced9, 0x01df1a36, 0x01de6594, 0x01ddb0f2, 0x01dcfc50, 0x01dc47ae, 0x01db930b, 0x01dade69,
+    0x01da29c7, 0x01d97525, 0x01d8c083, 0x01d80be0, 0x01d7573e, 0x01d6a29c, 0x01d5edfa, 0x01d53958,
+    0x01d484b5, 0x01d3d013, 0x01d31b71, 0x01d266cf, 0x01d1b22d, 0x01d0fd8a, 0x01d048e8, 0x01cf9446,
+    0x01cedfa4, 0x01ce2b02, 0x01cd765f, 0x01ccc1bd, 0x01cc0d1b, 0x01cb5879, 0x01caa3d7, 0x01c9ef34,
+    0x01c93a92, 0x01c885f0, 0x01c7d14e, 0x01c71cac, 0x01c66809, 0x01c5b367, 0x01c4fec5, 0x01c44a23,
+    0x01c39581, 0x01c2e0de, 0x01c22c3c, 0x01c1779a, 0x01c0c2f8, 0x01c00e56, 0x01bf59b3, 0x01bea511,
+    0x01bdf06f, 0x01bd3bcd, 0x01bc872b, 0x01bbd288, 0x01bb1de6, 0x01ba6944, 0x01b9b4a2, 0x01b90000,
+    0x01b84b5d, 0x01b796bb, 0x01b6e219, 0x01b62d77, 0x01b578d4, 0x01b4c432, 0x01b40f90, 0x01b35aee,
+    0x01b2a64c, 0x01b1f1a9, 0x01b13d07, 0x01b08865, 0x01afd3c3, 0x01af1f21, 0x01ae6a7e, 0x01adb5dc,
+    0x01ad013a, 0x01ac4c98, 0x01ab97f6, 0x01aae353, 0x01aa2eb1, 0x01a97a0f, 0x01a8c56d, 0x01a810cb,
+    0x01a75c28, 0x01a6a786, 0x01a5f2e4, 0x01a53e42, 0x01a489a0, 0x01a3d4fd, 0x01a3205b, 0x01a26bb9,
+    0x01a1b717, 0x01a10275, 0x01a04dd2, 0x019f9930, 0x019ee48e, 0x019e2fec, 0x019d7b4a, 0x019cc6a7,
+    0x019c1205, 0x019b5d63, 0x019aa8c1, 0x0199f41f, 0x01993f7c, 0x01988ada, 0x0197d638, 0x01972196,
+    0x01966cf4, 0x0195b851, 0x019503af, 0x01944f0d, 0x01939a6b, 0x0192e5c9, 0x01923126, 0x01917c84,
+    0x0190c7e2, 0x01901340, 0x018f5e9e, 0x018ea9fb, 0x018df559, 0x018d40b7, 0x018c8c15, 0x018bd773,
+    0x018b22d0, 0x018a6e2e, 0x0189b98c, 0x018904ea, 0x01885048, 0x01879ba5, 0x0186e703, 0x01863261,
+    0x01857dbf, 0x0184c91d, 0x0184147a, 0x01835fd8, 0x0182ab36, 0x0181f694, 0x018141f2, 0x01808d4f,
+    0x017fd8ad, 0x017f240b, 0x017e6f69, 0x017dbac7, 0x017d0624, 0x017c5182, 0x017b9ce0, 0x017ae83e,
+    0x017a339c, 0x01797ef9, 0x0178ca57, 0x017815b5, 0x01776113, 0x0176ac71, 0x0175f7ce, 0x0175432c,
+    0x01748e8a, 0x0173d9e8, 0x01732546, 0x017270a3, 0x0171bc01, 0x0171075f, 0x017052bd, 0x016f9e1b,
+    0x016ee978, 0x016e34d6, 0x016d8034, 0x016ccb92, 0x016c16f0, 0x016b624d, 0x016aadab, 0x0169f909,
+    0x01694467, 0x01688fc5, 0x0167db22, 0x01672680, 0x016671de, 0x0165bd3c, 0x0165089a, 0x016453f7,
+    0x01639f55, 0x0162eab3, 0x01623611, 0x0161816f, 0x0160cccc, 0x0160182a, 0x015f6388, 0x015eaee6,
+    0x015dfa43, 0x015d45a1, 0x015c90ff, 0x015bdc5d, 0x015b27bb, 0x015a7318, 0x0159be76, 0x015909d4,
+    0x01585532, 0x0157a090, 0x0156ebed, 0x0156374b, 0x015582a9, 0x0154ce07, 0x01541965, 0x015364c2,
+    0x0152b020, 0x0151fb7e, 0x015146dc, 0x0150923a, 0x014fdd97, 0x014f28f5, 0x014e7453, 0x014dbfb1,
+    0x014d0b0f, 0x014c566c, 0x014ba1ca, 0x014aed28, 0x014a3886, 0x014983e4, 0x0148cf41, 0x01481a9f,
+    0x014765fd, 0x0146b15b, 0x0145fcb9, 0x01454816, 0x01449374, 0x0143ded2, 0x01432a30, 0x0142758e,
+    0x0141c0eb, 0x01410c49, 0x014057a7, 0x013fa305, 0x013eee63, 0x013e39c0, 0x013d851e, 0x013cd07c,
+    0x013c1bda, 0x013b6738, 0x013ab295, 0x0139fdf3, 0x01394951, 0x013894af, 0x0137e00d, 0x01372b6a,
+    0x013676c8, 0x0135c226, 0x01350d84, 0x013458e2, 0x0133a43f, 0x0132ef9d, 0x01323afb, 0x01318659,
+    0x0130d1b7, 0x01301d14, 0x012f6872, 0x012eb3d0, 0x012dff2e, 0x012d4a8c, 0x012c95e9, 0x012be147,
+    0x012b2ca5, 0x012a7803, 0x0129c361, 0x01290ebe, 0x01285a1c, 0x0127a57a, 0x0126f0d8, 0x01263c36,
+    0x01258793, 0x0124d2f1, 0x01241e4f, 0x012369ad, 0x0122b50b, 0x01220068, 0x01214bc6, 0x01209724,
+    0x011fe282, 0x011f2de0, 0x011e793d, 0x011dc49b, 0x011d0ff9, 0x011c5b57, 0x011ba6b5, 0x011af212,
+    0x011a3d70, 0x011988ce, 0x0118d42c, 0x01181f8a, 0x01176ae7, 0x0116b645, 0x011601a3, 0x01154d01,
+    0x0114985f, 0x0113e3bc, 0x01132f1a, 0x01127a78, 0x0111c5d6, 0x01111134, 0x01105c91, 0x010fa7ef,
+    0x010ef34d, 0x010e3eab, 0x010d8a09, 0x010cd566, 0x010c20c4, 0x010b6c22, 0x010ab780, 0x010a02de,
+    0x01094e3b, 0x01089999, 0x0107e4f7, 0x01073055, 0x01067bb2, 0x0105c710, 0x0105126e, 0x01045dcc,
+    0x0103a92a, 0x0102f487, 0x01023fe5, 0x01018b43, 0x0100d6a1, 0x010021ff, 0x00ff6d5c, 0x00feb8ba,
+    0x00fe0418, 0x00fd4f76, 0x00fc9ad4, 0x00fbe631, 0x00fb318f, 0x00fa7ced, 0x00f9c84b, 0x00f913a9,
+    0x00f85f06, 0x00f7aa64, 0x00f6f5c2, 0x00f64120, 0x00f58c7e, 0x00f4d7db, 0x00f42339, 0x00f36e97,
+    0x00f2b9f5, 0x00f20553, 0x00f150b0, 0x00f09c0e, 0x00efe76c, 0x00ef32ca, 0x00ee7e28, 0x00edc985,
+    0x00ed14e3, 0x00ec6041, 0x00ebab9f, 0x00eaf6fd, 0x00ea425a, 0x00e98db8, 0x00e8d916, 0x00e82474,
+    0x00e76fd2, 0x00e6bb2f, 0x00e6068d, 0x00e551eb, 0x00e49d49, 0x00e3e8a7, 0x00e33404, 0x00e27f62,
+    0x00e1cac0, 0x00e1161e, 0x00e0617c, 0x00dfacd9, 0x00def837, 0x00de4395, 0x00dd8ef3, 0x00dcda51,
+    0x00dc25ae, 0x00db710c, 0x00dabc6a, 0x00da07c8, 0x00d95326, 0x00d89e83, 0x00d7e9e1, 0x00d7353f,
+    0x00d6809d, 0x00d5cbfb, 0x00d51758, 0x00d462b6, 0x00d3ae14, 0x00d2f972, 0x00d244d0, 0x00d1902d,
+    0x00d0db8b, 0x00d026e9, 0x00cf7247, 0x00cebda5, 0x00ce0902, 0x00cd5460, 0x00cc9fbe, 0x00cbeb1c,
+    0x00cb367a, 0x00ca81d7, 0x00c9cd35, 0x00c91893, 0x00c863f1, 0x00c7af4f, 0x00c6faac, 0x00c6460a,
+    0x00c59168, 0x00c4dcc6, 0x00c42824, 0x00c37381, 0x00c2bedf, 0x00c20a3d, 0x00c1559b, 0x00c0a0f9,
+    0x00bfec56, 0x00bf37b4, 0x00be8312, 0x00bdce70, 0x00bd19ce, 0x00bc652b, 0x00bbb089, 0x00bafbe7,
+    0x00ba4745, 0x00b992a3, 0x00b8de00, 0x00b8295e, 0x00b774bc, 0x00b6c01a, 0x00b60b78, 0x00b556d5,
+    0x00b4a233, 0x00b3ed91, 0x00b338ef, 0x00b2844d, 0x00b1cfaa, 0x00b11b08, 0x00b06666, 0x00afb1c4,
+    0x00aefd21, 0x00ae487f, 0x00ad93dd, 0x00acdf3b, 0x00ac2a99, 0x00ab75f6, 0x00aac154, 0x00aa0cb2,
+    0x00a95810, 0x00a8a36e, 0x00a7eecb, 0x00a73a29, 0x00a68587, 0x00a5d0e5, 0x00a51c43, 0x00a467a0,
+    0x00a3b2fe, 0x00a2fe5c, 0x00a249ba, 0x00a19518, 0x00a0e075, 0x00a02bd3, 0x009f7731, 0x009ec28f,
+    0x009e0ded, 0x009d594a, 0x009ca4a8, 0x009bf006, 0x009b3b64, 0x009a86c2, 0x0099d21f, 0x00991d7d,
+    0x009868db, 0x0097b439, 0x0096ff97, 0x00964af4, 0x00959652, 0x0094e1b0, 0x00942d0e, 0x0093786c,
+    0x0092c3c9, 0x00920f27, 0x00915a85, 0x0090a5e3, 0x008ff141, 0x008f3c9e, 0x008e87fc, 0x008dd35a,
+    0x008d1eb8, 0x008c6a16, 0x008bb573, 0x008b00d1, 0x008a4c2f, 0x0089978d, 0x0088e2eb, 0x00882e48,
+    0x008779a6, 0x0086c504, 0x00861062, 0x00855bc0, 0x0084a71d, 0x0083f27b, 0x00833dd9, 0x00828937,
+    0x0081d495, 0x00811ff2, 0x00806b50, 0x007fb6ae, 0x007f020c, 0x007e4d6a, 0x007d98c7, 0x007ce425,
+    0x007c2f83, 0x007b7ae1, 0x007ac63f, 0x007a119c, 0x00795cfa, 0x0078a858, 0x0077f3b6, 0x00773f14,
+    0x00768a71, 0x0075d5cf, 0x0075212d, 0x00746c8b, 0x0073b7e9, 0x00730346, 0x00724ea4, 0x00719a02,
+    0x0070e560, 0x007030be, 0x006f7c1b, 0x006ec779, 0x006e12d7, 0x006d5e35, 0x006ca993, 0x006bf4f0,
+    0x006b404e, 0x006a8bac, 0x0069d70a, 0x00692268, 0x00686dc5, 0x0067b923, 0x00670481, 0x00664fdf,
+    0x00659b3d, 0x0064e69a, 0x006431f8, 0x00637d56, 0x0062c8b4, 0x00621412, 0x00615f6f, 0x0060aacd,
+    0x005ff62b, 0x005f4189, 0x005e8ce7, 0x005dd844, 0x005d23a2, 0x005c6f00, 0x005bba5e, 0x005b05bc,
+    0x005a5119, 0x00599c77, 0x0058e7d5, 0x00583333, 0x00577e90, 0x0056c9ee, 0x0056154c, 0x005560aa,
+    0x0054ac08, 0x0053f765, 0x005342c3, 0x00528e21, 0x0051d97f, 0x005124dd, 0x0050703a, 0x004fbb98,
+    0x004f06f6, 0x004e5254, 0x004d9db2, 0x004ce90f, 0x004c346d, 0x004b7fcb, 0x004acb29, 0x004a1687,
+    0x004961e4, 0x0048ad42, 0x0047f8a0, 0x004743fe, 0x00468f5c, 0x0045dab9, 0x00452617, 0x00447175,
+    0x0043bcd3, 0x00430831, 0x0042538e, 0x00419eec, 0x0040ea4a, 0x004035a8, 0x003f8106, 0x003ecc63,
+    0x003e17c1, 0x003d631f, 0x003cae7d, 0x003bf9db, 0x003b4538, 0x003a9096, 0x0039dbf4, 0x00392752,
+    0x003872b0, 0x0037be0d, 0x0037096b, 0x003654c9, 0x0035a027, 0x0034eb85, 0x003436e2, 0x00338240,
+    0x0032cd9e, 0x003218fc, 0x0031645a, 0x0030afb7, 0x002ffb15, 0x002f4673, 0x002e91d1, 0x002ddd2f,
+    0x002d288c, 0x002c73ea, 0x002bbf48, 0x002b0aa6, 0x002a5604, 0x0029a161, 0x0028ecbf, 0x0028381d,
+    0x0027837b, 0x0026ced9, 0x00261a36, 0x00256594, 0x0024b0f2, 0x0023fc50, 0x002347ae, 0x0022930b,
+    0x0021de69, 0x002129c7, 0x00207525, 0x001fc083, 0x001f0be0, 0x001e573e, 0x001da29c, 0x001cedfa,
+    0x001c3958, 0x001b84b5, 0x001ad013, 0x001a1b71, 0x001966cf, 0x0018b22d, 0x0017fd8a, 0x001748e8,
+    0x00169446, 0x0015dfa4, 0x00152b02, 0x0014765f, 0x0013c1bd, 0x00130d1b, 0x00125879, 0x0011a3d7,
+    0x0010ef34, 0x00103a92, 0x000f85f0, 0x000ed14e, 0x000e1cac, 0x000d6809, 0x000cb367, 0x000bfec5,
+    0x000b4a23, 0x000a9581, 0x0009e0de, 0x00092c3c, 0x0008779a, 0x0007c2f8, 0x00070e56, 0x000659b3,
+    0x0005a511, 0x0004f06f, 0x00043bcd, 0x0003872b, 0x0002d288, 0x00021de6, 0x00016944, 0x0000b4a2
+};
+
+static const uint32_t tim_B_tab_default[256] =
+{
+    0x0b4a2339, 0x0b3ed916, 0x0b338ef3, 0x0b2844d0, 0x0b1cfaac, 0x0b11b089, 0x0b066666, 0x0afb1c43,
+    0x0aefd21f, 0x0ae487fc, 0x0ad93dd9, 0x0acdf3b6, 0x0ac2a993, 0x0ab75f6f, 0x0aac154c, 0x0aa0cb29,
+    0x0a958106, 0x0a8a36e2, 0x0a7eecbf, 0x0a73a29c, 0x0a685879, 0x0a5d0e56, 0x0a51c432, 0x0a467a0f,
+    0x0a3b2fec, 0x0a2fe5c9, 0x0a249ba5, 0x0a195182, 0x0a0e075f, 0x0a02bd3c, 0x09f77318, 0x09ec28f5,
+    0x09e0ded2, 0x09d594af, 0x09ca4a8c, 0x09bf0068, 0x09b3b645, 0x09a86c22, 0x099d21ff, 0x0991d7db,
+    0x09868db8, 0x097b4395, 0x096ff972, 0x0964af4f, 0x0959652b, 0x094e1b08, 0x0942d0e5, 0x093786c2,
+    0x092c3c9e, 0x0920f27b, 0x0915a858, 0x090a5e35, 0x08ff1412, 0x08f3c9ee, 0x08e87fcb, 0x08dd35a8,
+    0x08d1eb85, 0x08c6a161, 0x08bb573e, 0x08b00d1b, 0x08a4c2f8, 0x089978d4, 0x088e2eb1, 0x0882e48e,
+    0x08779a6b, 0x086c5048, 0x08610624, 0x0855bc01, 0x084a71de, 0x083f27bb, 0x0833dd97, 0x08289374,
+    0x081d4951, 0x0811ff2e, 0x0806b50b, 0x07fb6ae7, 0x07f020c4, 0x07e4d6a1, 0x07d98c7e, 0x07ce425a,
+    0x07c2f837, 0x07b7ae14, 0x07ac63f1, 0x07a119ce, 0x0795cfaa, 0x078a8587, 0x077f3b64, 0x0773f141,
+    0x0768a71d, 0x075d5cfa, 0x075212d7, 0x0746c8b4, 0x073b7e90, 0x0730346d, 0x0724ea4a, 0x0719a027,
+    0x070e5604, 0x07030be0, 0x06f7c1bd, 0x06ec779a, 0x06e12d77, 0x06d5e353, 0x06ca9930, 0x06bf4f0d,
+    0x06b404ea, 0x06a8bac7, 0x069d70a3, 0x06922680, 0x0686dc5d, 0x067b923a, 0x06704816, 0x0664fdf3,
+    0x0659b3d0, 0x064e69ad, 0x06431f8a, 0x0637d566, 0x062c8b43, 0x06214120, 0x0615f6fd, 0x060aacd9,
+    0x05ff62b6, 0x05f41893, 0x05e8ce70, 0x05dd844d, 0x05d23a29, 0x05c6f006, 0x05bba5e3, 0x05b05bc0,
+    0x05a5119c, 0x0599c779, 0x058e7d56, 0x05833333, 0x0577e90f, 0x056c9eec, 0x056154c9, 0x05560aa6,
+    0x054ac083, 0x053f765f, 0x05342c3c, 0x0528e219, 0x051d97f6, 0x05124dd2, 0x050703af, 0x04fbb98c,
+    0x04f06f69, 0x04e52546, 0x04d9db22, 0x04ce90ff, 0x04c346dc, 0x04b7fcb9, 0x04acb295, 0x04a16872,
+    0x04961e4f, 0x048ad42c, 0x047f8a09, 0x04743fe5, 0x0468f5c2, 0x045dab9f, 0x0452617c, 0x04471758,
+    0x043bcd35, 0x04308312, 0x042538ef, 0x0419eecb, 0x040ea4a8, 0x04035a85, 0x03f81062, 0x03ecc63f,
+    0x03e17c1b, 0x03d631f8, 0x03cae7d5, 0x03bf9db2, 0x03b4538e, 0x03a9096b, 0x039dbf48, 0x03927525,
+    0x03872b02, 0x037be0de, 0x037096bb, 0x03654c98, 0x035a0275, 0x034eb851, 0x03436e2e, 0x0338240b,
+    0x032cd9e8, 0x03218fc5, 0x031645a1, 0x030afb7e, 0x02ffb15b, 0x02f46738, 0x02e91d14, 0x02ddd2f1,
+    0x02d288ce, 0x02c73eab, 0x02bbf487, 0x02b0aa64, 0x02a56041, 0x029a161e, 0x028ecbfb, 0x028381d7,
+    0x027837b4, 0x026ced91, 0x0261a36e, 0x0256594a, 0x024b0f27, 0x023fc504, 0x02347ae1, 0x022930be,
+    0x021de69a, 0x02129c77, 0x02075254, 0x01fc0831, 0x01f0be0d, 0x01e573ea, 0x01da29c7, 0x01cedfa4,
+    0x01c39581, 0x01b84b5d, 0x01ad013a, 0x01a1b717, 0x01966cf4, 0x018b22d0, 0x017fd8ad, 0x01748e8a,
+    0x01694467, 0x015dfa43, 0x0152b020, 0x014765fd, 0x013c1bda, 0x0130d1b7, 0x01258793, 0x011a3d70,
+    0x010ef34d, 0x0103a92a, 0x00f85f06, 0x00ed14e3, 0x00e1cac0, 0x00d6809d, 0x00cb367a, 0x00bfec56,
+    0x00b4a233, 0x00a95810, 0x009e0ded, 0x0092c3c9, 0x008779a6, 0x007c2f83, 0x0070e560, 0x00659b3d,
+    0x005a5119, 0x004f06f6, 0x0043bcd3, 0x003872b0, 0x002d288c, 0x0021de69, 0x00169446, 0x000b4a23
+};
@@ -2,6 +2,8 @@
 #include "hwvideo/hwroad.hpp"
 #include "globals.hpp"
 #include "frontend/config.hpp"
+#include "enginesnapshot.hpp"
+#include "utils.hpp"
 
 /***************************************************************************
     Video Emulation: OutRun Road Rendering Hardware.
@@ -110,6 +112,10 @@ HWRoad hwroad;
 
 HWRoad::HWRoad()
 {
+    memset(coverage, 0, sizeof(coverage));
+    memset(last_ramBuff, 0, sizeof(last_ramBuff));
+    memset(last_color_offset, 0, sizeof(last_color_offset));
+    last_road_control = 0;
 }
 
 HWRoad::~HWRoad()
@@ -117,7 +123,7 @@ HWRoad::~HWRoad()
 }
 
 // Convert road to a more useable format
-void HWRoad::init(const uint8_t* src_road, const bool hires)
+void HWRoad::init(const uint8_t* src_road)
 {
     road_control = 0;
     color_offset1 = 0x400;
@@ -128,15 +134,28 @@ void HWRoad::init(const uint8_t* src_road, const bool hires)
     if (src_road)
         decode_road(src_road);
     
-    if (hires)
+    // Pick the renderers compiled for this screen layout. The layout only changes on init.
+    switch (config.s16_width)
     {
-        render_background = &HWRoad::render_background_hires;
-        render_foreground = &HWRoad::render_foreground_hires;
-    }
-    else
-    {
-        render_background = &HWRoad::render_background_lores;
-        render_foreground = &HWRoad::render_foreground_lores;   
+        case S16_WIDTH_WIDE:
+            render_background = &HWRoad::render_background_lores<S16_WIDTH_WIDE>;
+            render_foreground = &HWRoad::render_foreground_lores<S16_WIDTH_WIDE>;
+            break;
+
+        case S16_WIDTH << 1:
+            render_background = &HWRoad::render_background_hires<S16_WIDTH << 1>;
+            render_foreground = &HWRoad::render_foreground_hires<S16_WIDTH << 1>;
+            break;
+
+        case S16_WIDTH_WIDE << 1:
+            render_background = &HWRoad::render_background_hires<S16_WIDTH_WIDE << 1>;
+            render_foreground = &HWRoad::render_foreground_hires<S16_WIDTH_WIDE << 1>;
+            break;
+
+        default:
+            render_background = &HWRoad::render_background_lores<S16_WIDTH>;
+            render_foreground = &HWRoad::render_foreground_lores<S16_WIDTH>;
+            break;
     }
 }
 
@@ -188,6 +207,18 @@ void HWRoad::decode_road(const uint8_t* src_road)
     }
 }
 
+// Decoded road graphics, for the graphics cache
+const uint8_t* HWRoad::get_decoded()
+{
+    return roads;
+}
+
+// Restore previously decoded road graphics, instead of decoding them in init()
+void HWRoad::set_decoded(const uint8_t* src)
+{
+    memcpy(roads, src, DECODED_SIZE);
+}
+
 // Writes go to RAM, but we read from the RAM Buffer.
 void HWRoad::write16(uint32_t adr, const uint16_t data)
 {
@@ -230,11 +261,65 @@ void HWRoad::write_road_control(const uint8_t road_control)
     this->road_control = road_control;
 }
 
+// Register road RAM with an engine snapshot.
+// Coverage is worked out again from the RAM before each frame is drawn.
+void HWRoad::register_state(EngineSnapshot& snapshot)
+{
+    snapshot.add(ram,            sizeof(ram));
+    snapshot.add(ramBuff,        sizeof(ramBuff));
+    snapshot.add(&road_control,  sizeof(road_control));
+    snapshot.add(&color_offset1, sizeof(color_offset1));
+    snapshot.add(&color_offset2, sizeof(color_offset2));
+    snapshot.add(&color_offset3, sizeof(color_offset3));
+}
+
+// Only the buffered half of road RAM is drawn
+bool HWRoad::changed()
+{
+    const uint16_t color_offset[3] = { color_offset1, color_offset2, color_offset3 };
+
+    bool changed = Utils::update_copy(last_ramBuff, ramBuff, sizeof(ramBuff));
+    changed |= Utils::update_copy(&last_road_control, &road_control, sizeof(road_control));
+    changed |= Utils::update_copy(last_color_offset, color_offset, sizeof(color_offset));
+    return changed;
+}
+
+// Work out which scanlines the foreground will fill completely, using the same tests as the 
+// renderers. The road background and tile layers can skip these lines.
+void HWRoad::update_coverage()
+{
+    const uint16_t* roadram = ramBuff;
+    const uint8_t control   = road_control & 3;
+
+    coverage[S16_HEIGHT] = 0;
+
+    for (int y = S16_HEIGHT - 1; y >= 0; y--)
+    {
+        const bool low0 = (roadram[0x000 + y] & 0x800) != 0;
+        const bool low1 = (roadram[0x100 + y] & 0x800) != 0;
+
+        bool covered;
+        if (low0 && low1)
+            covered = false;
+        else if (control == 0)
+            covered = !low0;
+        else if (control == 3)
+            covered = !low1;
+        else
+            covered = true;
+
+        coverage[y] = covered ? coverage[y + 1] + 1 : 0;
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Road Rendering: Lores Version
+//
+// Renderers are compiled for each output WIDTH, so the row strides are constant.
 // ------------------------------------------------------------------------------------------------
 
 // Background: Look for solid fill scanlines
+template <int WIDTH>
 void HWRoad::render_background_lores(uint16_t* pixels)
 {
     int x, y;
@@ -242,6 +327,10 @@ void HWRoad::render_background_lores(uint16_t* pixels)
 
     for (y = 0; y < S16_HEIGHT; y++) 
     {
+        // Hidden by the foreground
+        if (coverage[y])
+            continue;
+
         int data0 = roadram[0x000 + y];
         int data1 = roadram[0x100 + y];
 
@@ -278,18 +367,22 @@ void HWRoad::render_background_lores(uint16_t* pixels)
         // fill the scanline with color
         if (color != -1) 
         {
-            uint16_t* pPixel = pixels + (y * config.s16_width);
+            uint16_t* pPixel = pixels + (y * WIDTH);
             color |= color_offset3;
             
-            for (x = 0; x < config.s16_width; x++)
+            for (x = 0; x < WIDTH; x++)
                 *(pPixel)++ = color;
         }
     }
 }
 
 // Foreground: Render From ROM
+template <int WIDTH>
 void HWRoad::render_foreground_lores(uint16_t* pixels)
 {
+    // Widescreen offset, in original System 16 pixels
+    const uint16_t X_OFF = ((WIDTH - S16_WIDTH) >> 1);
+
     int x, y;
     uint16_t* roadram = ramBuff;
     
@@ -310,7 +403,7 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
         if (((data0 & 0x800) != 0) && ((data1 & 0x800) != 0))
             continue;
 
-        uint16_t* pPixel = pixels + (y * config.s16_width);
+        uint16_t* pPixel = pixels + (y * WIDTH);
         int32_t hpos0, hpos1, color0, color1;
         int32_t control = road_control & 3;
 
@@ -344,7 +437,7 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
         color_table[0x17] = color_offset1 ^ 0x0e ^ ((color1 >> 7) & 1);
 
         // Shift road dependent on whether we are in widescreen mode or not
-        uint16_t s16_x = 0x5f8 + config.s16_x_off;
+        uint16_t s16_x = 0x5f8 + X_OFF;
 
         // draw the road
         switch (control) 
@@ -353,7 +446,7 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
                 if (data0 & 0x800)
                     continue;
                 hpos0 = (hpos0 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix0 = (hpos0 < 0x200) ? src0[hpos0] : 3;
                     pPixel[x] = color_table[0x00 + pix0];
@@ -364,7 +457,7 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
             case 1:
                 hpos0 = (hpos0 - (s16_x + x_offset)) & 0xfff;
                 hpos1 = (hpos1 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix0 = (hpos0 < 0x200) ? src0[hpos0] : 3;
                     int pix1 = (hpos1 < 0x200) ? src1[hpos1] : 3;
@@ -381,7 +474,7 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
             case 2:
                 hpos0 = (hpos0 - (s16_x + x_offset)) & 0xfff;
                 hpos1 = (hpos1 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix0 = (hpos0 < 0x200) ? src0[hpos0] : 3;
                     int pix1 = (hpos1 < 0x200) ? src1[hpos1] : 3;
@@ -399,7 +492,7 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
                 if (data1 & 0x800)
                     continue;
                 hpos1 = (hpos1 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix1 = (hpos1 < 0x200) ? src1[hpos1] : 3;
                     pPixel[x] = color_table[0x10 + pix1];
@@ -413,13 +506,18 @@ void HWRoad::render_foreground_lores(uint16_t* pixels)
 // ------------------------------------------------------------------------------------------------
 // High Resolution (Double Resolution) Road Rendering
 // ------------------------------------------------------------------------------------------------
+template <int WIDTH>
 void HWRoad::render_background_hires(uint16_t* pixels)
 {
     int x, y;
     uint16_t* roadram = ramBuff;
 
-    for (y = 0; y < config.s16_height; y += 2) 
+    for (y = 0; y < (S16_HEIGHT << 1); y += 2) 
     {
+        // Hidden by the foreground
+        if (coverage[y >> 1])
+            continue;
+
         int data0 = roadram[0x000 + (y >> 1)];
         int data1 = roadram[0x100 + (y >> 1)];
 
@@ -456,15 +554,15 @@ void HWRoad::render_background_hires(uint16_t* pixels)
         // fill the scanline with color
         if (color != -1) 
         {
-            uint16_t* pPixel = pixels + (y * config.s16_width);
+            uint16_t* pPixel = pixels + (y * WIDTH);
             color |= color_offset3;
             
-            for (x = 0; x < config.s16_width; x++)
+            for (x = 0; x < WIDTH; x++)
                 *(pPixel)++ = color;
         }
 
         // Hi-Res Mode: Copy extra line of background
-        memcpy(pixels + ((y+1) * config.s16_width), pixels + (y * config.s16_width), sizeof(uint16_t) * config.s16_width);
+        memcpy(pixels + ((y+1) * WIDTH), pixels + (y * WIDTH), sizeof(uint16_t) * WIDTH);
     }
 }
 
@@ -472,8 +570,12 @@ void HWRoad::render_background_hires(uint16_t* pixels)
 // Render Road Foreground - High Resolution Version
 // Interpolates previous scanline with next.
 // ------------------------------------------------------------------------------------------------
+template <int WIDTH>
 void HWRoad::render_foreground_hires(uint16_t* pixels)
 {
+    // Widescreen offset, in original System 16 pixels
+    const uint16_t X_OFF = (((WIDTH >> 1) - S16_WIDTH) >> 1);
+
     int x, y, yy;
     uint16_t* roadram = ramBuff;
     
@@ -481,7 +583,7 @@ void HWRoad::render_foreground_hires(uint16_t* pixels)
     int32_t color0, color1;
     int32_t bgcolor; // 8 bits
 
-    for (y = 0; y < config.s16_height; y++) 
+    for (y = 0; y < (S16_HEIGHT << 1); y++) 
     {
         yy = y >> 1;
        
@@ -570,8 +672,8 @@ void HWRoad::render_foreground_hires(uint16_t* pixels)
             src1 = ((data1 & 0x800) != 0) ? roads + 256 * 2 * 512 : (roads + (0x100 + ((data1 >> 1) & 0xff)) * 512);
 
         // Shift road dependent on whether we are in widescreen mode or not
-        uint16_t s16_x = 0x5f8 + config.s16_x_off;
-        uint16_t* const pPixel = pixels + (y * config.s16_width);
+        uint16_t s16_x = 0x5f8 + X_OFF;
+        uint16_t* const pPixel = pixels + (y * WIDTH);
 
         // draw the road
         switch (road_control & 3)
@@ -580,7 +682,7 @@ void HWRoad::render_foreground_hires(uint16_t* pixels)
                 if (data0 & 0x800)
                     continue;
                 hpos0 = (hpos0 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix0 = (hpos0 < 0x200) ? src0[hpos0] : 3;
                     pPixel[x] = color_table[0x00 + pix0];
@@ -592,7 +694,7 @@ void HWRoad::render_foreground_hires(uint16_t* pixels)
             case 1:
                 hpos0 = (hpos0 - (s16_x + x_offset)) & 0xfff;
                 hpos1 = (hpos1 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix0 = (hpos0 < 0x200) ? src0[hpos0] : 3;
                     int pix1 = (hpos1 < 0x200) ? src1[hpos1] : 3;
@@ -612,7 +714,7 @@ void HWRoad::render_foreground_hires(uint16_t* pixels)
             case 2:
                 hpos0 = (hpos0 - (s16_x + x_offset)) & 0xfff;
                 hpos1 = (hpos1 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix0 = (hpos0 < 0x200) ? src0[hpos0] : 3;
                     int pix1 = (hpos1 < 0x200) ? src1[hpos1] : 3;
@@ -633,7 +735,7 @@ void HWRoad::render_foreground_hires(uint16_t* pixels)
                 if (data1 & 0x800)
                     continue;
                 hpos1 = (hpos1 - (s16_x + x_offset)) & 0xfff;
-                for (x = 0; x < config.s16_width; x++) 
+                for (x = 0; x < WIDTH; x++) 
                 {
                     int pix1 = (hpos1 < 0x200) ? src1[hpos1] : 3;
                     pPixel[x] = color_table[0x10 + pix1];                   
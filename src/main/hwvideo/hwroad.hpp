@@ -1,6 +1,9 @@
 #pragma once
 
 #include "stdint.hpp"
+#include "globals.hpp"
+
+class EngineSnapshot;
 
 class HWRoad
 {
@@ -8,7 +11,12 @@ public:
     HWRoad();
     ~HWRoad();
 
-    void init(const uint8_t*, const bool hires);
+    // Size of decoded road graphics in bytes
+    static const uint32_t DECODED_SIZE = 0x40200;
+
+    void init(const uint8_t*);
+    const uint8_t* get_decoded();
+    void set_decoded(const uint8_t* src);
     void write16(uint32_t adr, const uint16_t data);
     void write16(uint32_t* adr, const uint16_t data);
     void write32(uint32_t* adr, const uint32_t data);
@@ -16,6 +24,16 @@ public:
     void write_road_control(const uint8_t);
     void (HWRoad::*render_background)(uint16_t*);
     void (HWRoad::*render_foreground)(uint16_t*);
+
+    // Scanlines where the road foreground overwrites every pixel, so nothing drawn beforehand is visible.
+    // Stored as the number of consecutive covered scanlines starting at each line (0 = not covered).
+    // In original System 16 lines, also in hi-res mode. Set by update_coverage().
+    uint8_t coverage[S16_HEIGHT + 1];
+    void update_coverage();
+    void register_state(EngineSnapshot&);
+
+    // True if the road RAM or registers have changed since the last call
+    bool changed();
   
 private:
     uint8_t road_control;
@@ -28,17 +46,22 @@ private:
     static const uint16_t rom_size = 0x8000;
 
     // Decoded road graphics
-    uint8_t roads[0x40200];
+    uint8_t roads[DECODED_SIZE];
 
     // Two halves of RAM
     uint16_t ram[ROAD_RAM_SIZE / 2];
     uint16_t ramBuff[ROAD_RAM_SIZE / 2];
 
+    // Road state when changed() was last called
+    uint16_t last_ramBuff[ROAD_RAM_SIZE / 2];
+    uint8_t  last_road_control;
+    uint16_t last_color_offset[3];
+
     void decode_road(const uint8_t*);
-    void render_background_lores(uint16_t*);
-    void render_foreground_lores(uint16_t*);
-    void render_background_hires(uint16_t*);
-    void render_foreground_hires(uint16_t*);
+    template <int WIDTH> void render_background_lores(uint16_t*);
+    template <int WIDTH> void render_foreground_lores(uint16_t*);
+    template <int WIDTH> void render_background_hires(uint16_t*);
+    template <int WIDTH> void render_foreground_hires(uint16_t*);
 };
 
 extern HWRoad hwroad;
\ No newline at end of file
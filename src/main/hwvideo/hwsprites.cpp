@@ -1,7 +1,10 @@
+#include <cstring> // memcpy
 #include "video.hpp"
 #include "hwvideo/hwsprites.hpp"
 #include "globals.hpp"
 #include "frontend/config.hpp"
+#include "enginesnapshot.hpp"
+#include "utils.hpp"
 
 /***************************************************************************
     Video Emulation: OutRun Sprite Rendering Hardware.
@@ -50,6 +53,8 @@
 
 hwsprites::hwsprites()
 {
+    memset(last_ramBuff, 0, sizeof(last_ramBuff));
+    last_x1 = last_x2 = 0;
 }
 
 hwsprites::~hwsprites()
@@ -77,6 +82,18 @@ void hwsprites::init(const uint8_t* src_sprites)
     }
 }
 
+// Converted sprites, for the graphics cache
+const uint8_t* hwsprites::get_decoded()
+{
+    return (const uint8_t*) sprites;
+}
+
+// Restore previously converted sprites, instead of converting them in init()
+void hwsprites::set_decoded(const uint8_t* src)
+{
+    memcpy(sprites, src, DECODED_SIZE);
+}
+
 void hwsprites::reset()
 {
     // Clear Sprite RAM buffers
@@ -124,6 +141,24 @@ void hwsprites::write(const uint16_t adr, const uint16_t data)
     ram[adr >> 1] = data;
 }
 
+// Register sprite RAM and the clip window with an engine snapshot
+void hwsprites::register_state(EngineSnapshot& snapshot)
+{
+    snapshot.add(ram,     sizeof(ram));
+    snapshot.add(ramBuff, sizeof(ramBuff));
+    snapshot.add(&x1,     sizeof(x1));
+    snapshot.add(&x2,     sizeof(x2));
+}
+
+// Only the buffered half of sprite RAM is drawn
+bool hwsprites::changed()
+{
+    bool changed = Utils::update_copy(last_ramBuff, ramBuff, sizeof(ramBuff));
+    changed |= Utils::update_copy(&last_x1, &x1, sizeof(x1));
+    changed |= Utils::update_copy(&last_x2, &x2, sizeof(x2));
+    return changed;
+}
+
 // Copy back buffer to main ram, ready for blit
 void hwsprites::swap()
 {
@@ -139,24 +174,103 @@ void hwsprites::swap()
     }
 }
 
-#define draw_pixel()                                                                                  \
-{                                                                                                     \
-    if (x >= x1 && x < x2 && pix != 0 && pix != 15)                                                   \
-    {                                                                                                 \
-        if (shadow && pix == 0xa)                                                                     \
-        {                                                                                             \
-            pPixel[x] &= 0xfff;                                                                       \
-            pPixel[x] += ((S16_PALETTE_ENTRIES * 2) - ((video.read_pal16(pPixel[x]) & 0x8000) >> 3)); \
-        }                                                                                             \
-        else                                                                                          \
-        {                                                                                             \
-            pPixel[x] = (pix | color);                                                                \
-        }                                                                                             \
-    }                                                                                                 \
+// Draw the eight pixels of one word of sprite data, scaled by hzoom.
+//
+// FLIP:   Read pixels from the low nibble first
+// XDELTA: Direction to draw in (1 or -1)
+// SHADOW: Sprite has shadows enabled (pixel 0xa darkens the existing pixel)
+// CLIP:   Test each pixel against the clip window. Not needed when the whole word is known to be inside.
+template <bool FLIP, int XDELTA, bool SHADOW, bool CLIP>
+inline int32_t hwsprites::draw_word(uint16_t* pPixel, const uint32_t pixels, int32_t x, int32_t& xacc, const int32_t hzoom, const int32_t color)
+{
+    for (int n = 0; n < 8; n++)
+    {
+        const int32_t pix = (pixels >> (FLIP ? (n << 2) : 28 - (n << 2))) & 0xf;
+        const bool opaque = pix != 0 && pix != 15;
+
+        while (xacc < 0x200)
+        {
+            if (opaque && (!CLIP || (x >= x1 && x < x2)))
+            {
+                if (SHADOW && pix == 0xa)
+                {
+                    pPixel[x] &= 0xfff;
+                    pPixel[x] += video.get_shadow_bank(pPixel[x]);
+                }
+                else
+                {
+                    pPixel[x] = (pix | color);
+                }
+            }
+            x += XDELTA;
+            xacc += hzoom;
+        }
+        xacc -= 0x200;
+    }
+    return x;
+}
+
+// Draw one row of a sprite. Returns the address of the last word read.
+//
+// A word of sprite data covers at most max_step pixels, so words that are entirely inside the 
+// clip window are drawn without testing each pixel.
+template <int WIDTH, bool FLIP, int XDELTA, bool SHADOW>
+uint16_t hwsprites::draw_row(uint16_t* pPixel, const uint32_t* spritedata, uint16_t addr, int32_t x, 
+                             const int32_t hzoom, const int32_t color, const int32_t max_step)
+{
+    int32_t xacc = 0;
+
+    // start at the word before (or after) because we preincrement (or predecrement) below
+    addr += FLIP ? 1 : -1;
+
+    while (XDELTA > 0 ? x < WIDTH : x >= 0)
+    {
+        const uint32_t pixels = spritedata[FLIP ? --addr : ++addr];
+
+        const bool inside = XDELTA > 0 ? (x >= x1 && x + max_step <= x2) 
+                                       : (x < x2 && x - max_step + 1 >= x1);
+        if (inside)
+            x = draw_word<FLIP, XDELTA, SHADOW, false>(pPixel, pixels, x, xacc, hzoom, color);
+        else
+            x = draw_word<FLIP, XDELTA, SHADOW, true>(pPixel, pixels, x, xacc, hzoom, color);
+
+        // stop if the second-to-last pixel in the group was 0xf
+        if (FLIP ? (pixels & 0x0f000000) == 0x0f000000 : (pixels & 0x000000f0) == 0x000000f0)
+            break;
+    }
+    return addr;
 }
 
 void hwsprites::render(const uint8_t priority)
 {
+    // Use the renderer compiled for this screen layout, so the strides are constant
+    switch (config.s16_width)
+    {
+        case S16_WIDTH_WIDE:
+            render_t<S16_WIDTH_WIDE, false>(priority);
+            break;
+
+        case S16_WIDTH << 1:
+            render_t<S16_WIDTH << 1, true>(priority);
+            break;
+
+        case S16_WIDTH_WIDE << 1:
+            render_t<S16_WIDTH_WIDE << 1, true>(priority);
+            break;
+
+        default:
+            render_t<S16_WIDTH, false>(priority);
+            break;
+    }
+}
+
+template <int WIDTH, bool HIRES>
+void hwsprites::render_t(const uint8_t priority)
+{
+    // Widescreen offset, in original System 16 pixels
+    const int32_t X_OFF  = (((HIRES ? WIDTH >> 1 : WIDTH) - S16_WIDTH) >> 1);
+    const int32_t HEIGHT = HIRES ? S16_HEIGHT << 1 : S16_HEIGHT;
+
     const uint32_t numbanks = SPRITES_LENGTH / 0x10000;
 
     for (uint16_t data = 0; data < SPRITE_RAM_SIZE; data += 8) 
@@ -184,7 +298,7 @@ void hwsprites::render(const uint8_t priority)
         int32_t xdelta = ((ramBuff[data+4] & 0x2000) != 0) ? 1 : -1;
         int32_t hzoom    = ramBuff[data+4] & 0x7ff;     
         int32_t color   = COLOR_BASE + ((ramBuff[data+5] & 0x7f) << 4);
-        int32_t x, y, ytarget, yacc = 0, pix;
+        int32_t y, ytarget, yacc = 0;
             
         // adjust X coordinate
         // note: the threshhold below is a guess. If it is too high, rachero will draw garbage
@@ -210,10 +324,10 @@ void hwsprites::render(const uint8_t priority)
         ytarget = top + ydelta * height;
 
         // Adjust for widescreen mode
-        xpos += config.s16_x_off;
+        xpos += X_OFF;
 
         // Adjust for hi-res mode
-        if (config.video.hires)
+        if (HIRES)
         {
             xpos <<= 1;
             top <<= 1;
@@ -222,64 +336,29 @@ void hwsprites::render(const uint8_t priority)
             vzoom >>= 1;
         }
 
+        // Pick the row kernel for this sprite
+        row_fn row;
+        if (flip)
+        {
+            if (xdelta > 0) row = shadow ? &hwsprites::draw_row<WIDTH, true, 1, true>  : &hwsprites::draw_row<WIDTH, true, 1, false>;
+            else            row = shadow ? &hwsprites::draw_row<WIDTH, true, -1, true> : &hwsprites::draw_row<WIDTH, true, -1, false>;
+        }
+        else
+        {
+            if (xdelta > 0) row = shadow ? &hwsprites::draw_row<WIDTH, false, 1, true>  : &hwsprites::draw_row<WIDTH, false, 1, false>;
+            else            row = shadow ? &hwsprites::draw_row<WIDTH, false, -1, true> : &hwsprites::draw_row<WIDTH, false, -1, false>;
+        }
+
+        // Most pixels a word of sprite data can cover at this zoom
+        const int32_t max_step = (0x1000 + hzoom - 1) / hzoom;
+
         for (y = top; y != ytarget; y += ydelta)
         {
             // skip drawing if not within the cliprect
-            if (y >= 0 && y < config.s16_height)
+            if (y >= 0 && y < HEIGHT)
             {
-                uint16_t* pPixel = &video.pixels[y * config.s16_width];
-                int32_t xacc = 0;
-
-                // non-flipped case
-                if (flip == 0)
-                {
-                    // start at the word before because we preincrement below
-                    ramBuff[data+7] = (addr - 1);
-
-                    for (x = xpos; (xdelta > 0 && x < config.s16_width) || (xdelta < 0 && x >= 0); )
-                    {
-                        uint32_t pixels = spritedata[++ramBuff[data+7]]; // Add to base sprite data the vzoom value
-
-                        // draw four pixels
-                        pix = (pixels >> 28) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 24) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 20) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 16) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 12) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >>  8) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >>  4) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >>  0) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-
-                        // stop if the second-to-last pixel in the group was 0xf
-                        if ((pixels & 0x000000f0) == 0x000000f0)
-                            break;
-                    }
-                }
-                // flipped case
-                else
-                {
-                    // start at the word after because we predecrement below
-                    ramBuff[data+7] = (addr + 1);
-
-                    for (x = xpos; (xdelta > 0 && x < config.s16_width) || (xdelta < 0 && x >= 0); )
-                    {
-                        uint32_t pixels = spritedata[--ramBuff[data+7]];
-
-                        // draw four pixels
-                        pix = (pixels >>  0) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >>  4) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >>  8) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 12) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 16) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 20) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 24) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-                        pix = (pixels >> 28) & 0xf; while (xacc < 0x200) { draw_pixel(); x += xdelta; xacc += hzoom; } xacc -= 0x200;
-
-                        // stop if the second-to-last pixel in the group was 0xf
-                        if ((pixels & 0x0f000000) == 0x0f000000)
-                            break;
-                    }
-                }
+                uint16_t* pPixel = &video.pixels[y * WIDTH];
+                ramBuff[data+7] = (this->*row)(pPixel, spritedata, addr, xpos, hzoom, color, max_step);
             }
             // accumulate zoom factors; if we carry into the high bit, skip an extra row
             yacc += vzoom; 
@@ -3,19 +3,29 @@
 #include "stdint.hpp"
 
 class video;
+class EngineSnapshot;
 
 class hwsprites
 {
 public:
     hwsprites();
     ~hwsprites();
+    // Size of converted sprites in bytes
+    static const uint32_t DECODED_SIZE = 0x100000;
+
     void init(const uint8_t*);
+    const uint8_t* get_decoded();
+    void set_decoded(const uint8_t* src);
     void reset();
     void set_x_clip(bool);
     void swap();
     uint8_t read(const uint16_t adr);
     void write(const uint16_t adr, const uint16_t data);
     void render(const uint8_t);
+    void register_state(EngineSnapshot&);
+
+    // True if the sprite list or clip window has changed since the last call
+    bool changed();
 
 private:
     // Clip values.
@@ -31,5 +41,21 @@ private:
     // Two halves of RAM
     uint16_t ram[SPRITE_RAM_SIZE];
     uint16_t ramBuff[SPRITE_RAM_SIZE];
+
+    // Sprite list and clip window when changed() was last called
+    uint16_t last_ramBuff[SPRITE_RAM_SIZE];
+    uint16_t last_x1, last_x2;
+
+    template <int WIDTH, bool HIRES> void render_t(const uint8_t);
+
+    // Sprite row kernels, specialised on flip, direction and shadow
+    typedef uint16_t (hwsprites::*row_fn)(uint16_t*, const uint32_t*, uint16_t, int32_t, const int32_t, const int32_t, const int32_t);
+
+    template <int WIDTH, bool FLIP, int XDELTA, bool SHADOW>
+    uint16_t draw_row(uint16_t* pPixel, const uint32_t* spritedata, uint16_t addr, int32_t x, 
+                      const int32_t hzoom, const int32_t color, const int32_t max_step);
+
+    template <bool FLIP, int XDELTA, bool SHADOW, bool CLIP>
+    inline int32_t draw_word(uint16_t* pPixel, const uint32_t pixels, int32_t x, int32_t& xacc, const int32_t hzoom, const int32_t color);
 };
 
@@ -3,6 +3,8 @@
 #include "romloader.hpp"
 #include "hwvideo/hwtiles.hpp"
 #include "frontend/config.hpp"
+#include "enginesnapshot.hpp"
+#include "utils.hpp"
 #include <cstring>
 
 /***************************************************************************
@@ -82,6 +84,12 @@ hwtiles::hwtiles(void)
         tile_banks[i] = i;
 
     set_x_clamp(CENTRE);
+
+    memset(last_text_ram, 0, sizeof(last_text_ram));
+    memset(last_tile_ram, 0, sizeof(last_tile_ram));
+    memset(last_tile_banks, 0, sizeof(last_tile_banks));
+    last_x_clamp  = 0;
+    tiles_changed = true;
 }
 
 hwtiles::~hwtiles(void)
@@ -112,25 +120,58 @@ void hwtiles::init(uint8_t* src_tiles, const bool hires)
         }
         memcpy(tiles_backup, tiles, TILES_LENGTH * sizeof(uint32_t));
     }
+    tiles_changed = true;
     
-    if (hires)
-    {
-        s16_width_noscale = config.s16_width >> 1;
-        render8x8_tile_mask      = &hwtiles::render8x8_tile_mask_hires;
-        render8x8_tile_mask_clip = &hwtiles::render8x8_tile_mask_clip_hires;
-    }
-    else
+    s16_width_noscale = hires ? config.s16_width >> 1 : config.s16_width;
+
+    // Pick the renderers compiled for this screen layout. The layout only changes on init.
+    switch (config.s16_width)
     {
-        s16_width_noscale = config.s16_width;
-        render8x8_tile_mask      = &hwtiles::render8x8_tile_mask_lores;
-        render8x8_tile_mask_clip = &hwtiles::render8x8_tile_mask_clip_lores;
+        case S16_WIDTH_WIDE:
+            set_renderers<S16_WIDTH_WIDE, false>();
+            break;
+
+        case S16_WIDTH << 1:
+            set_renderers<S16_WIDTH << 1, true>();
+            break;
+
+        case S16_WIDTH_WIDE << 1:
+            set_renderers<S16_WIDTH_WIDE << 1, true>();
+            break;
+
+        default:
+            set_renderers<S16_WIDTH, false>();
+            break;
     }
 }
 
+template <int WIDTH, bool HIRES>
+void hwtiles::set_renderers()
+{
+    render_tile_layer_fn = &hwtiles::render_tile_layer_t<WIDTH, HIRES>;
+    render_text_layer_fn = &hwtiles::render_text_layer_t<WIDTH, HIRES>;
+    render_all_tiles_fn  = &hwtiles::render_all_tiles_t<WIDTH, HIRES>;
+}
+
+// Converted tiles, for the graphics cache
+const uint8_t* hwtiles::get_decoded()
+{
+    return (const uint8_t*) tiles;
+}
+
+// Restore previously converted tiles, instead of converting them in init()
+void hwtiles::set_decoded(const uint8_t* src)
+{
+    memcpy(tiles, src, DECODED_SIZE);
+    memcpy(tiles_backup, tiles, DECODED_SIZE);
+    tiles_changed = true;
+}
+
 // Patch Tileset with new data
 void hwtiles::patch_tiles(RomLoader* patch)
 {
     memcpy(tiles_backup, tiles, TILES_LENGTH * sizeof(uint32_t));
+    tiles_changed = true;
 
     for (uint32_t i = 0; i < patch->length;)
     {
@@ -149,6 +190,7 @@ void hwtiles::patch_tiles(RomLoader* patch)
 void hwtiles::restore_tiles()
 {
     memcpy(tiles, tiles_backup, TILES_LENGTH * sizeof(uint32_t));
+    tiles_changed = true;
 }
 
 // Set Tilemap X Clamp
@@ -175,33 +217,72 @@ void hwtiles::set_x_clamp(const uint16_t props)
     }
 }
 
+// Register tile RAM with an engine snapshot.
+// Page and scroll values are read back from text RAM before each frame is drawn.
+void hwtiles::register_state(EngineSnapshot& snapshot)
+{
+    snapshot.add(text_ram,    sizeof(text_ram));
+    snapshot.add(tile_ram,    sizeof(tile_ram));
+    snapshot.add(tile_banks,  sizeof(tile_banks));
+    snapshot.add(&x_clamp,    sizeof(x_clamp));
+}
+
+// Page select and scroll registers are part of text RAM
+bool hwtiles::changed()
+{
+    bool changed  = tiles_changed;
+    tiles_changed = false;
+
+    // Every copy is brought up to date, so don't stop at the first difference
+    changed |= Utils::update_copy(last_text_ram,   text_ram,   sizeof(text_ram));
+    changed |= Utils::update_copy(last_tile_ram,   tile_ram,   sizeof(tile_ram));
+    changed |= Utils::update_copy(last_tile_banks, tile_banks, sizeof(tile_banks));
+    changed |= Utils::update_copy(&last_x_clamp,   &x_clamp,   sizeof(x_clamp));
+    return changed;
+}
+
 void hwtiles::update_tile_values()
 {
     for (int i = 0; i < 4; i++)
     {
-        page[i] = ((text_ram[0xe80 + (i * 2) + 0] << 8) | text_ram[0xe80 + (i * 2) + 1]);
+        page[i] = text_ram[(0xe80 >> 1) + i];
 
-        scroll_x[i] = ((text_ram[0xe98 + (i * 2) + 0] << 8) | text_ram[0xe98 + (i * 2) + 1]);
-        scroll_y[i] = ((text_ram[0xe90 + (i * 2) + 0] << 8) | text_ram[0xe90 + (i * 2) + 1]);
+        scroll_x[i] = text_ram[(0xe98 >> 1) + i];
+        scroll_y[i] = text_ram[(0xe90 >> 1) + i];
     }
 }
 
 // A quick and dirty debug function to display the contents of tile memory.
 void hwtiles::render_all_tiles(uint16_t* buf)
+{
+    (this->*render_all_tiles_fn)(buf);
+}
+
+template <int WIDTH, bool HIRES>
+void hwtiles::render_all_tiles_t(uint16_t* buf)
 {
     uint32_t Code = 0, Colour = 5, x, y;
     for (y = 0; y < 224; y += 8) 
     {
         for (x = 0; x < 320; x += 8) 
         {
-            (this->*render8x8_tile_mask)(buf, Code, x, y, Colour, 3, 0, TILEMAP_COLOUR_OFFSET);
+            render8x8_tile<WIDTH, HIRES, false>(buf, Code, x, y, Colour);
             Code++;
         }
     }
 }
 
-void hwtiles::render_tile_layer(uint16_t* buf, uint8_t page_index, uint8_t priority_draw)
+// coverage: Optional count of covered scanlines from each line (see HWRoad). Tiles that would be 
+//           completely overdrawn are skipped.
+void hwtiles::render_tile_layer(uint16_t* buf, uint8_t page_index, uint8_t priority_draw, const uint8_t* coverage)
+{
+    (this->*render_tile_layer_fn)(buf, page_index, priority_draw, coverage);
+}
+
+template <int WIDTH, bool HIRES>
+void hwtiles::render_tile_layer_t(uint16_t* buf, uint8_t page_index, uint8_t priority_draw, const uint8_t* coverage)
 {
+    const int16_t NOSCALE_WIDTH = HIRES ? WIDTH >> 1 : WIDTH;
     int16_t Colour, x, y, Priority = 0;
 
     uint16_t ActPage = 0;
@@ -211,9 +292,9 @@ void hwtiles::render_tile_layer(uint16_t* buf, uint8_t page_index, uint8_t prior
 
     // Need to support this at each row/column
     if ((xScroll & 0x8000) != 0)
-        xScroll = (text_ram[0xf80 + (0x40 * page_index) + 0] << 8) | text_ram[0xf80 + (0x40 * page_index) + 1];
+        xScroll = text_ram[(0xf80 + (0x40 * page_index)) >> 1];
     if ((yScroll & 0x8000) != 0)
-        yScroll = (text_ram[0xf16 + (0x40 * page_index) + 0] << 8) | text_ram[0xf16 + (0x40 * page_index) + 1];
+        yScroll = text_ram[(0xf16 + (0x40 * page_index)) >> 1];
 
     for (int my = 0; my < 64; my++) 
     {
@@ -228,9 +309,9 @@ void hwtiles::render_tile_layer(uint16_t* buf, uint8_t page_index, uint8_t prior
             if (my >= 32 && mx >= 64)                  // bottom right page
                 ActPage = (EffPage >> 12) & 0x0f;
 
-            uint32_t TileIndex = 64 * 32 * 2 * ActPage + ((2 * 64 * my) & 0xfff) + ((2 * mx) & 0x7f);
+            uint32_t TileIndex = 64 * 32 * ActPage + ((64 * my) & 0x7ff) + (mx & 0x3f);
 
-            uint16_t Data = (tile_ram[TileIndex + 0] << 8) | tile_ram[TileIndex + 1];
+            uint16_t Data = tile_ram[TileIndex];
 
             Priority = (Data >> 15) & 1;
 
@@ -259,18 +340,18 @@ void hwtiles::render_tile_layer(uint16_t* buf, uint8_t page_index, uint8_t prior
                 if (y < -288)
                     y += 512;
 
-                uint16_t ColourOff = TILEMAP_COLOUR_OFFSET;
-                if (Colour >= 0x20)
-					ColourOff = 0x100 | TILEMAP_COLOUR_OFFSET;
-                if (Colour >= 0x40)
-					ColourOff = 0x200 | TILEMAP_COLOUR_OFFSET;
-                if (Colour >= 0x60)
-					ColourOff = 0x300 | TILEMAP_COLOUR_OFFSET;
-
-                if (x > 7 && x < (s16_width_noscale - 8) && y > 7 && y <= (S16_HEIGHT - 8))
-                    (this->*render8x8_tile_mask)(buf, Code, x, y, Colour, 3, 0, ColourOff);
-                else if (x > -8 && x < s16_width_noscale && y > -8 && y < S16_HEIGHT)
-					(this->*render8x8_tile_mask_clip)(buf, Code, x, y, Colour, 3, 0, ColourOff);
+                if (coverage && y > -8 && y < S16_HEIGHT)
+                {
+                    const int16_t top    = y < 0 ? 0 : y;
+                    const int16_t bottom = y + 8 > S16_HEIGHT ? S16_HEIGHT : y + 8;
+                    if (coverage[top] >= bottom - top)
+                        continue;
+                }
+
+                if (x > 7 && x < (NOSCALE_WIDTH - 8) && y > 7 && y <= (S16_HEIGHT - 8))
+                    render8x8_tile<WIDTH, HIRES, false>(buf, Code, x, y, Colour);
+                else if (x > -8 && x < NOSCALE_WIDTH && y > -8 && y < S16_HEIGHT)
+					render8x8_tile<WIDTH, HIRES, true>(buf, Code, x, y, Colour);
             } // end priority check
         }
     } // end for loop
@@ -278,13 +359,20 @@ void hwtiles::render_tile_layer(uint16_t* buf, uint8_t page_index, uint8_t prior
 
 void hwtiles::render_text_layer(uint16_t* buf, uint8_t priority_draw)
 {
+    (this->*render_text_layer_fn)(buf, priority_draw);
+}
+
+template <int WIDTH, bool HIRES>
+void hwtiles::render_text_layer_t(uint16_t* buf, uint8_t priority_draw)
+{
+    const int16_t NOSCALE_WIDTH = HIRES ? WIDTH >> 1 : WIDTH;
     uint16_t mx, my, Code, Colour, x, y, Priority, TileIndex = 0;
 
     for (my = 0; my < 32; my++) 
     {
         for (mx = 0; mx < 64; mx++) 
         {
-            Code = (text_ram[TileIndex + 0] << 8) | text_ram[TileIndex + 1];
+            Code = text_ram[TileIndex];
             Priority = (Code >> 15) & 1;
 
             if (Priority == priority_draw) 
@@ -303,202 +391,61 @@ void hwtiles::render_text_layer(uint16_t* buf, uint8_t priority_draw)
 
                     // We also adjust the text layer for wide-screen below. But don't allow painting in the 
                     // wide-screen areas to avoid graphical glitches.
-                    if (x > 7 && x < (s16_width_noscale - 8) && y > 7 && y <= (S16_HEIGHT - 8))
-                        (this->*render8x8_tile_mask)(buf, Code, x + config.s16_x_off, y, Colour, 3, 0, TILEMAP_COLOUR_OFFSET);
-                    else if (x > -8 && x < s16_width_noscale && y >= 0 && y < S16_HEIGHT) 
-                        (this->*render8x8_tile_mask_clip)(buf, Code, x + config.s16_x_off, y, Colour, 3, 0, TILEMAP_COLOUR_OFFSET);
+                    if (x > 7 && x < (NOSCALE_WIDTH - 8) && y > 7 && y <= (S16_HEIGHT - 8))
+                        render8x8_tile<WIDTH, HIRES, false>(buf, Code, x + config.s16_x_off, y, Colour);
+                    else if (x > -8 && x < NOSCALE_WIDTH && y >= 0 && y < S16_HEIGHT) 
+                        render8x8_tile<WIDTH, HIRES, true>(buf, Code, x + config.s16_x_off, y, Colour);
                 }
             }
-            TileIndex += 2;
-        }
-    }
-}
-
-void hwtiles::render8x8_tile_mask_lores(
-    uint16_t *buf,
-    uint16_t nTileNumber, 
-    uint16_t StartX, 
-    uint16_t StartY, 
-    uint16_t nTilePalette, 
-    uint16_t nColourDepth, 
-    uint16_t nMaskColour, 
-    uint16_t nPaletteOffset) 
-{
-    uint32_t nPalette = (nTilePalette << nColourDepth) | nMaskColour;
-    uint32_t* pTileData = tiles + (nTileNumber << 3);
-    buf += (StartY * config.s16_width) + StartX;
-
-    for (int y = 0; y < 8; y++) 
-    {
-        uint32_t p0 = *pTileData;
-
-        if (p0 != nMaskColour) 
-        {
-            uint32_t c7 = p0 & 0xf;
-            uint32_t c6 = (p0 >> 4) & 0xf;
-            uint32_t c5 = (p0 >> 8) & 0xf;
-            uint32_t c4 = (p0 >> 12) & 0xf;
-            uint32_t c3 = (p0 >> 16) & 0xf;
-            uint32_t c2 = (p0 >> 20) & 0xf;
-            uint32_t c1 = (p0 >> 24) & 0xf;
-            uint32_t c0 = (p0 >> 28);
-
-            if (c0) buf[0] = nPalette + c0;
-            if (c1) buf[1] = nPalette + c1;
-            if (c2) buf[2] = nPalette + c2;
-            if (c3) buf[3] = nPalette + c3;
-            if (c4) buf[4] = nPalette + c4;
-            if (c5) buf[5] = nPalette + c5;
-            if (c6) buf[6] = nPalette + c6;
-            if (c7) buf[7] = nPalette + c7;
+            TileIndex++;
         }
-        buf += config.s16_width;
-        pTileData++;
     }
 }
 
-void hwtiles::render8x8_tile_mask_clip_lores(
+// Draw an 8x8 tile with colour 0 transparent.
+//
+// WIDTH: Width of the output buffer
+// HIRES: Double each pixel in both directions
+// CLIP:  Tile is partially off screen, so test each pixel
+template <int WIDTH, bool HIRES, bool CLIP>
+inline void hwtiles::render8x8_tile(
     uint16_t *buf,
     uint16_t nTileNumber, 
     int16_t StartX, 
     int16_t StartY, 
-    uint16_t nTilePalette, 
-    uint16_t nColourDepth, 
-    uint16_t nMaskColour, 
-    uint16_t nPaletteOffset) 
+    uint16_t nTilePalette) 
 {
-    uint32_t nPalette = (nTilePalette << nColourDepth) | nMaskColour;
-    uint32_t* pTileData = tiles + (nTileNumber << 3);
-    buf += (StartY * config.s16_width) + StartX;
-
-    for (int y = 0; y < 8; y++) 
-    {
-        if ((StartY + y) >= 0 && (StartY + y) < S16_HEIGHT) 
-        {
-            uint32_t p0 = *pTileData;
-
-            if (p0 != nMaskColour) 
-            {
-                uint32_t c7 = p0 & 0xf;
-                uint32_t c6 = (p0 >> 4) & 0xf;
-                uint32_t c5 = (p0 >> 8) & 0xf;
-                uint32_t c4 = (p0 >> 12) & 0xf;
-                uint32_t c3 = (p0 >> 16) & 0xf;
-                uint32_t c2 = (p0 >> 20) & 0xf;
-                uint32_t c1 = (p0 >> 24) & 0xf;
-                uint32_t c0 = (p0 >> 28);
-
-                if (c0 && 0 + StartX >= 0 && 0 + StartX < config.s16_width) buf[0] = nPalette + c0;
-                if (c1 && 1 + StartX >= 0 && 1 + StartX < config.s16_width) buf[1] = nPalette + c1;
-                if (c2 && 2 + StartX >= 0 && 2 + StartX < config.s16_width) buf[2] = nPalette + c2;
-                if (c3 && 3 + StartX >= 0 && 3 + StartX < config.s16_width) buf[3] = nPalette + c3;
-                if (c4 && 4 + StartX >= 0 && 4 + StartX < config.s16_width) buf[4] = nPalette + c4;
-                if (c5 && 5 + StartX >= 0 && 5 + StartX < config.s16_width) buf[5] = nPalette + c5;
-                if (c6 && 6 + StartX >= 0 && 6 + StartX < config.s16_width) buf[6] = nPalette + c6;
-                if (c7 && 7 + StartX >= 0 && 7 + StartX < config.s16_width) buf[7] = nPalette + c7;
-            }
-        }
-        buf += config.s16_width;
-        pTileData++;
-    }
-}
+    // Clip against the width in original System 16 pixels
+    const int CLIP_WIDTH = HIRES ? WIDTH >> 1 : WIDTH;
+    const int SCALE      = HIRES ? 2 : 1;
 
-// ------------------------------------------------------------------------------------------------
-// Additional routines for Hi-Res Mode.
-// Note that the tilemaps are displayed at the same resolution, we just want everything to be
-// proportional.
-// ------------------------------------------------------------------------------------------------
-void hwtiles::render8x8_tile_mask_hires(
-    uint16_t *buf,
-    uint16_t nTileNumber, 
-    uint16_t StartX, 
-    uint16_t StartY, 
-    uint16_t nTilePalette, 
-    uint16_t nColourDepth, 
-    uint16_t nMaskColour, 
-    uint16_t nPaletteOffset) 
-{
-    uint32_t nPalette = (nTilePalette << nColourDepth) | nMaskColour;
-    uint32_t* pTileData = tiles + (nTileNumber << 3);
-    buf += ((StartY << 1) * config.s16_width) + (StartX << 1);
+    const uint32_t nPalette   = nTilePalette << 3;
+    const uint32_t* pTileData = tiles + (nTileNumber << 3);
+    buf += (StartY * SCALE * WIDTH) + (StartX * SCALE);
 
-    for (int y = 0; y < 8; y++) 
+    for (int y = 0; y < 8; y++, buf += WIDTH * SCALE) 
     {
-        uint32_t p0 = *pTileData;
+        const uint32_t p0 = *pTileData++;
 
-        if (p0 != nMaskColour) 
-        {
-            uint32_t c7 = p0 & 0xf;
-            uint32_t c6 = (p0 >> 4) & 0xf;
-            uint32_t c5 = (p0 >> 8) & 0xf;
-            uint32_t c4 = (p0 >> 12) & 0xf;
-            uint32_t c3 = (p0 >> 16) & 0xf;
-            uint32_t c2 = (p0 >> 20) & 0xf;
-            uint32_t c1 = (p0 >> 24) & 0xf;
-            uint32_t c0 = (p0 >> 28);
-
-            if (c0) set_pixel_x4(&buf[0],  nPalette + c0);
-            if (c1) set_pixel_x4(&buf[2],  nPalette + c1);
-            if (c2) set_pixel_x4(&buf[4],  nPalette + c2);
-            if (c3) set_pixel_x4(&buf[6],  nPalette + c3);
-            if (c4) set_pixel_x4(&buf[8],  nPalette + c4);
-            if (c5) set_pixel_x4(&buf[10], nPalette + c5);
-            if (c6) set_pixel_x4(&buf[12], nPalette + c6);
-            if (c7) set_pixel_x4(&buf[14], nPalette + c7);
-        }
-        buf += (config.s16_width << 1);
-        pTileData++;
-    }
-}
+        if (p0 == 0)
+            continue;
 
-void hwtiles::render8x8_tile_mask_clip_hires(
-    uint16_t *buf,
-    uint16_t nTileNumber, 
-    int16_t StartX, 
-    int16_t StartY, 
-    uint16_t nTilePalette, 
-    uint16_t nColourDepth, 
-    uint16_t nMaskColour, 
-    uint16_t nPaletteOffset) 
-{
-    uint32_t nPalette = (nTilePalette << nColourDepth) | nMaskColour;
-    uint32_t* pTileData = tiles + (nTileNumber << 3);
-    buf += ((StartY << 1) * config.s16_width) + (StartX << 1);
+        if (CLIP && ((StartY + y) < 0 || (StartY + y) >= S16_HEIGHT))
+            continue;
 
-    for (int y = 0; y < 8; y++) 
-    {
-        if ((StartY + y) >= 0 && (StartY + y) < S16_HEIGHT) 
+        for (int i = 0; i < 8; i++)
         {
-            uint32_t p0 = *pTileData;
+            const uint32_t c = (p0 >> (28 - (i << 2))) & 0xf;
 
-            if (p0 != nMaskColour) 
+            if (c && (!CLIP || (i + StartX >= 0 && i + StartX < CLIP_WIDTH)))
             {
-                uint32_t c7 = p0 & 0xf;
-                uint32_t c6 = (p0 >> 4) & 0xf;
-                uint32_t c5 = (p0 >> 8) & 0xf;
-                uint32_t c4 = (p0 >> 12) & 0xf;
-                uint32_t c3 = (p0 >> 16) & 0xf;
-                uint32_t c2 = (p0 >> 20) & 0xf;
-                uint32_t c1 = (p0 >> 24) & 0xf;
-                uint32_t c0 = (p0 >> 28);
-
-                if (c0 && 0 + StartX >= 0 && 0 + StartX < s16_width_noscale) set_pixel_x4(&buf[0],  nPalette + c0);
-                if (c1 && 1 + StartX >= 0 && 1 + StartX < s16_width_noscale) set_pixel_x4(&buf[2],  nPalette + c1);
-                if (c2 && 2 + StartX >= 0 && 2 + StartX < s16_width_noscale) set_pixel_x4(&buf[4],  nPalette + c2);
-                if (c3 && 3 + StartX >= 0 && 3 + StartX < s16_width_noscale) set_pixel_x4(&buf[6],  nPalette + c3);
-                if (c4 && 4 + StartX >= 0 && 4 + StartX < s16_width_noscale) set_pixel_x4(&buf[8],  nPalette + c4);
-                if (c5 && 5 + StartX >= 0 && 5 + StartX < s16_width_noscale) set_pixel_x4(&buf[10], nPalette + c5);
-                if (c6 && 6 + StartX >= 0 && 6 + StartX < s16_width_noscale) set_pixel_x4(&buf[12], nPalette + c6);
-                if (c7 && 7 + StartX >= 0 && 7 + StartX < s16_width_noscale) set_pixel_x4(&buf[14], nPalette + c7);
+                uint16_t* p = buf + (i * SCALE);
+                p[0] = nPalette + c;
+
+                // Hires Mode: Set 4 pixels instead of one.
+                if (HIRES)
+                    p[1] = p[WIDTH] = p[WIDTH + 1] = nPalette + c;
             }
         }
-        buf += (config.s16_width << 1);
-        pTileData++;
     }
 }
-
-// Hires Mode: Set 4 pixels instead of one.
-void hwtiles::set_pixel_x4(uint16_t *buf, uint32_t data)
-{
-    buf[0] = buf[1] = buf[0  + config.s16_width] = buf[1 + config.s16_width] = data;
-}
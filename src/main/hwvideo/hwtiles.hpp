@@ -3,6 +3,7 @@
 #include "stdint.hpp"
 
 class RomLoader;
+class EngineSnapshot;
 
 class hwtiles
 {
@@ -14,20 +15,30 @@ public:
         CENTRE,
     };
 
-    uint8_t text_ram[0x1000]; // Text RAM
-    uint8_t tile_ram[0x10000]; // Tile RAM
+    // Stored as native-endian words. Index with the byte address >> 1.
+    uint16_t text_ram[0x800];  // Text RAM (0x1000 bytes)
+    uint16_t tile_ram[0x8000]; // Tile RAM (0x10000 bytes)
 
     hwtiles(void);
     ~hwtiles(void);
 
+    // Size of converted tiles in bytes
+    static const uint32_t DECODED_SIZE = 0x10000 * sizeof(uint32_t);
+
     void init(uint8_t* src_tiles, const bool hires);
+    const uint8_t* get_decoded();
+    void set_decoded(const uint8_t* src);
     void patch_tiles(RomLoader* patch);
     void restore_tiles();
     void set_x_clamp(const uint16_t);
     void update_tile_values();
-    void render_tile_layer(uint16_t*, uint8_t, uint8_t);
+    void render_tile_layer(uint16_t*, uint8_t, uint8_t, const uint8_t* coverage = NULL);
     void render_text_layer(uint16_t*, uint8_t);
     void render_all_tiles(uint16_t*);
+    void register_state(EngineSnapshot&);
+
+    // True if anything the tile layers are drawn from has changed since the last call
+    bool changed();
 
 private:
     int16_t x_clamp;
@@ -45,68 +56,31 @@ private:
 
     uint8_t tile_banks[2];
 
+    // Tile state when changed() was last called
+    uint16_t last_text_ram[0x800];
+    uint16_t last_tile_ram[0x8000];
+    uint8_t  last_tile_banks[2];
+    int16_t  last_x_clamp;
+    bool     tiles_changed; // Converted tiles replaced or patched
+
     static const uint16_t NUM_TILES = 0x2000; // Length of graphic rom / 24
     static const uint16_t TILEMAP_COLOUR_OFFSET = 0x1c00;
     
-    void (hwtiles::*render8x8_tile_mask)(
-        uint16_t *buf,
-        uint16_t nTileNumber, 
-        uint16_t StartX, 
-        uint16_t StartY, 
-        uint16_t nTilePalette, 
-        uint16_t nColourDepth, 
-        uint16_t nMaskColour, 
-        uint16_t nPaletteOffset); 
-        
-    void (hwtiles::*render8x8_tile_mask_clip)(
-        uint16_t *buf,
-        uint16_t nTileNumber, 
-        int16_t StartX, 
-        int16_t StartY, 
-        uint16_t nTilePalette, 
-        uint16_t nColourDepth, 
-        uint16_t nMaskColour, 
-        uint16_t nPaletteOffset); 
-        
-    void render8x8_tile_mask_lores(
-        uint16_t *buf,
-        uint16_t nTileNumber, 
-        uint16_t StartX, 
-        uint16_t StartY, 
-        uint16_t nTilePalette, 
-        uint16_t nColourDepth, 
-        uint16_t nMaskColour, 
-        uint16_t nPaletteOffset); 
-
-    void render8x8_tile_mask_clip_lores(
-        uint16_t *buf,
-        uint16_t nTileNumber, 
-        int16_t StartX, 
-        int16_t StartY, 
-        uint16_t nTilePalette, 
-        uint16_t nColourDepth, 
-        uint16_t nMaskColour, 
-        uint16_t nPaletteOffset);
-        
-    void render8x8_tile_mask_hires(
-        uint16_t *buf,
-        uint16_t nTileNumber, 
-        uint16_t StartX, 
-        uint16_t StartY, 
-        uint16_t nTilePalette, 
-        uint16_t nColourDepth, 
-        uint16_t nMaskColour, 
-        uint16_t nPaletteOffset); 
-        
-    void render8x8_tile_mask_clip_hires(
+    // Layer renderers compiled for the current screen layout. Chosen by init().
+    void (hwtiles::*render_tile_layer_fn)(uint16_t*, uint8_t, uint8_t, const uint8_t*);
+    void (hwtiles::*render_text_layer_fn)(uint16_t*, uint8_t);
+    void (hwtiles::*render_all_tiles_fn)(uint16_t*);
+
+    template <int WIDTH, bool HIRES> void set_renderers();
+    template <int WIDTH, bool HIRES> void render_tile_layer_t(uint16_t*, uint8_t, uint8_t, const uint8_t*);
+    template <int WIDTH, bool HIRES> void render_text_layer_t(uint16_t*, uint8_t);
+    template <int WIDTH, bool HIRES> void render_all_tiles_t(uint16_t*);
+
+    template <int WIDTH, bool HIRES, bool CLIP>
+    inline void render8x8_tile(
         uint16_t *buf,
         uint16_t nTileNumber, 
         int16_t StartX, 
         int16_t StartY, 
-        uint16_t nTilePalette, 
-        uint16_t nColourDepth, 
-        uint16_t nMaskColour, 
-        uint16_t nPaletteOffset);
-        
-    inline void set_pixel_x4(uint16_t *buf, uint32_t data);
+        uint16_t nTilePalette);
 };
\ No newline at end of file
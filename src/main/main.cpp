@@ -7,6 +7,7 @@
 
 // Error reporting
 #include <iostream>
+#include <ctime>
 
 // SDL Library
 #include <SDL.h>
@@ -32,11 +33,18 @@
 #include "romloader.hpp"
 #include "trackloader.hpp"
 #include "stdint.hpp"
+#include "utils.hpp"
 #include "main.hpp"
 #include "setup.hpp"
+#include "runahead.hpp"
 #include "engine/outrun.hpp"
+#include "engine/ohud.hpp"
+#include "frontend/audiorender.hpp"
 #include "frontend/config.hpp"
 #include "frontend/menu.hpp"
+#include "frontend/replay.hpp"
+#include "frontend/replaycheck.hpp"
+#include "frontend/runaheadbench.hpp"
 
 #include "cannonboard/interface.hpp"
 #include "engine/oinputs.hpp"
@@ -55,6 +63,7 @@ double cannonball::frame_ms    = 0;
 int    cannonball::frame       = 0;
 bool   cannonball::tick_frame  = true;
 int    cannonball::fps_counter = 0;
+int    cannonball::skip_counter = 0;
 
 #ifdef COMPILE_SOUND_CODE
 Audio cannonball::audio;
@@ -112,6 +121,15 @@ static void process_events(void)
                 // Handle quit requests (like Ctrl-c).
                 state = STATE_QUIT;
                 break;
+
+            // The window may need drawing again, even though the game hasn't changed
+            #ifdef SDL2
+            case SDL_WINDOWEVENT:
+            #else
+            case SDL_VIDEOEXPOSE:
+            #endif
+                video.force_redraw();
+                break;
         }
     }
 }
@@ -119,6 +137,59 @@ static void process_events(void)
 // Pause Engine
 bool pause_engine;
 
+// Longest time to sleep waiting for input when idle (ms). CannonBoard input doesn't wake the loop.
+static const int IDLE_TIMEOUT = 100;
+
+// Turbo: Run the engine as fast as possible, without sound.
+// The screen is only drawn as often as it would be at normal speed.
+static bool turbo;
+static Timer turbo_draw;
+
+// Frameskip: When drawing falls behind, the engine and sound keep running but frames aren't drawn
+static bool skip_draw;
+static int skip_run;                // Frames skipped in a row
+static uint32_t frames_skipped;     // Total frames skipped
+
+// Time trial replays are saved to this directory, if set
+static const char* replay_dir = NULL;
+static Replay replay;
+
+// Run-ahead: Draw the game a few frames ahead of the real one
+static RunAhead runahead;
+
+static void set_turbo(bool enable)
+{
+    turbo = enable;
+    turbo_draw.start();
+
+    if (!turbo)
+        ohud.draw_turbo(0);
+}
+
+// Save the replay once the time trial reaches the game over screen.
+// Leaving the race early abandons it.
+static void update_replay()
+{
+    if (state != STATE_GAME)
+    {
+        replay.cancel();
+    }
+    else if (outrun.game_state == GS_GAMEOVER)
+    {
+        replay.finish();
+
+        char name[64];
+        time_t now = time(NULL);
+        strftime(name, sizeof(name), "ttrial-%Y%m%d-%H%M%S", localtime(&now));
+
+        const std::string filename = std::string(replay_dir) + "/" + name + "-" + Utils::to_string((int) replay.settings.level) + ".rpl";
+        if (replay.save(filename))
+            std::cout << "Replay saved to " << filename << std::endl;
+        else
+            std::cerr << "Unable to save replay to " << filename << std::endl;
+    }
+}
+
 static void tick()
 {
     frame++;
@@ -138,10 +209,19 @@ static void tick()
 
     process_events();
 
+    if (input.has_pressed(Input::TURBO))
+        set_turbo(!turbo);
+
+    // Record controls before the engine reads them
+    if (replay.is_recording())
+        replay.add_frame();
+
     if (tick_frame)
         oinputs.tick(packet); // Do Controls
     oinputs.do_gear();        // Digital Gear
 
+    bool engine_ticked = false;
+
     switch (state)
     {
         case STATE_GAME:
@@ -159,12 +239,14 @@ static void tick()
             {
                 outrun.tick(packet, tick_frame);
                 input.frame_done(); // Denote keys read
+                engine_ticked = true;
 
                 #ifdef COMPILE_SOUND_CODE
                 // Tick audio program code
                 osoundint.tick();
                 // Tick SDL Audio
-                audio.tick();
+                if (!turbo)
+                    audio.tick();
                 #endif
             }
             else
@@ -182,6 +264,16 @@ static void tick()
             else
             {
                 pause_engine = false;
+
+                // Time trials always start from centred controls, so they can be replayed.
+                // Without the fixed random seed, the race is seeded from the clock and can't be.
+                if (outrun.cannonball_mode == Outrun::MODE_TTRIAL)
+                {
+                    oinputs.init();
+                    if (replay_dir != NULL && !config.cannonboard.enabled && config.engine.randomgen)
+                        replay.start();
+                }
+
                 outrun.init();
                 state = STATE_GAME;
             }
@@ -195,7 +287,8 @@ static void tick()
             // Tick audio program code
             osoundint.tick();
             // Tick SDL Audio
-            audio.tick();
+            if (!turbo)
+                audio.tick();
             #endif
         }
         break;
@@ -207,12 +300,41 @@ static void tick()
             state = STATE_MENU;
             break;
     }
+    if (replay.is_recording())
+        update_replay();
+
     // Write CannonBoard Outputs
     if (config.cannonboard.enabled)
         cannonboard.write(outrun.outputs->dig_out, outrun.outputs->hw_motor_control);
 
+    #ifdef COMPILE_SOUND_CODE
+    // Draw audio buffer statistics
+    if (config.sound.stats && (state == STATE_GAME || state == STATE_MENU))
+    {
+        AudioStats stats;
+        audio.get_stats(stats);
+        ohud.draw_audio_stats(stats);
+    }
+    #endif
+
     // Draw SDL Video
-    video.draw_frame();  
+    if (skip_draw)
+    {
+        skip_run++;
+        frames_skipped++;
+    }
+    else if (!turbo || turbo_draw.get_ticks() >= frame_ms)
+    {
+        skip_run = 0;
+        turbo_draw.start();
+
+        // Only run ahead during the race itself. Other states load music and change modes.
+        if (engine_ticked && !turbo && config.controls.runahead > 0 &&
+            outrun.game_state >= GS_START1 && outrun.game_state <= GS_INGAME)
+            runahead.run(config.controls.runahead, packet, true);
+        else
+            video.draw_frame();
+    }
 }
 
 static void main_loop()
@@ -228,25 +350,85 @@ static void main_loop()
     double deltatime  = 0;
     int deltaintegral = 0;
 
+    // Time behind schedule, when frameskip is enabled
+    double lag = 0;
+    uint32_t skipped = 0;
+
+    // Turbo Speed Measurement
+    Timer turbo_count;
+    int turbo_ticks = 0;
+    turbo_count.start();
+
     while (state != STATE_QUIT)
     {
         frame_time.start();
         tick();
-        #ifdef COMPILE_SOUND_CODE
-        deltatime += (frame_ms * audio.adjust_speed());
-        #else
-        deltatime += frame_ms;
+
+        // Low Power: While paused with nothing changing on screen, sleep until there's input.
+        // The engine and sound aren't ticked when paused, so nothing is missed.
+        // SDL 1.2 can't wait for events with a timeout, so sleeps for the frame as normal.
+        #ifdef SDL2
+        if (state == STATE_GAME && pause_engine && video.static_frame)
+        {
+            SDL_WaitEventTimeout(NULL, IDLE_TIMEOUT);
+            frame_time.start();
+        }
         #endif
-        deltaintegral  = (int) deltatime;
-        t = frame_time.get_ticks();
 
-        // Cap Frame Rate: Sleep Remaining Frame Time
-        if (t < deltatime)
+        // Turbo: Don't cap the frame rate. Display speed as a multiple of real time every second.
+        if (turbo)
         {
-            SDL_Delay((Uint32) (deltatime - t));
+            turbo_ticks++;
+            lag = 0;
+            skip_draw = false;
+
+            const int elapsed = turbo_count.get_ticks();
+            if (elapsed >= 1000)
+            {
+                ohud.draw_turbo((int16_t) (turbo_ticks * frame_ms / elapsed));
+                turbo_ticks = 0;
+                turbo_count.start();
+            }
+        }
+        else
+        {
+            turbo_ticks = 0;
+            turbo_count.start();
+
+            #ifdef COMPILE_SOUND_CODE
+            deltatime += (frame_ms * audio.adjust_speed());
+            #else
+            deltatime += frame_ms;
+            #endif
+            deltaintegral  = (int) deltatime;
+            t = frame_time.get_ticks();
+
+            // Frameskip: Frames that overrun are paid back from the spare time of later frames.
+            // Skip drawing while more than a frame behind, but never more than the limit in a row.
+            if (config.video.frameskip)
+            {
+                lag += t - deltaintegral;
+                if (lag < 0)
+                {
+                    SDL_Delay((Uint32) -lag);
+                    lag = 0;
+                }
+                // Don't try to catch up with long stalls
+                else if (lag > frame_ms * (config.video.frameskip + 1))
+                {
+                    lag = frame_ms * (config.video.frameskip + 1);
+                }
+
+                skip_draw = lag >= frame_ms && skip_run < config.video.frameskip;
+            }
+            // Cap Frame Rate: Sleep Remaining Frame Time
+            else if (t < deltatime)
+            {
+                SDL_Delay((Uint32) (deltatime - t));
+            }
+            
+            deltatime -= deltaintegral;
         }
-        
-        deltatime -= deltaintegral;
 
         if (config.video.fps_count)
         {
@@ -254,18 +436,44 @@ static void main_loop()
             // One second has elapsed
             if (fps_count.get_ticks() >= 1000)
             {
-                fps_counter = frame;
-                frame       = 0;
+                skip_counter = frames_skipped - skipped;
+                fps_counter  = frame - skip_counter;
+                skipped      = frames_skipped;
+                frame        = 0;
                 fps_count.start();
             }
         }
     }
 
+    if (frames_skipped)
+        std::cout << "Frameskip: " << frames_skipped << " of " << cannonball::frame << " frames not drawn" << std::endl;
+
     quit_func(0);
 }
 
 int main(int argc, char* argv[])
 {
+    // Offline audio rendering. Doesn't require SDL video or audio.
+    if (argc >= 2 && strcmp(argv[1], "-render_audio") == 0)
+    {
+        AudioRender render;
+        return render.run(argc - 2, argv + 2);
+    }
+
+    // Headless time trial replay validation. Doesn't require SDL video or audio.
+    if (argc >= 2 && strcmp(argv[1], "-check_replays") == 0)
+    {
+        ReplayCheck check;
+        return check.run(argc - 2, argv + 2);
+    }
+
+    // Measure the cost of run-ahead. Doesn't require SDL video or audio.
+    if (argc >= 2 && strcmp(argv[1], "-benchmark_runahead") == 0)
+    {
+        RunAheadBench bench;
+        return bench.run(argc - 2, argv + 2);
+    }
+
     // Initialize timer and video systems
     if( SDL_Init( SDL_INIT_TIMER | SDL_INIT_VIDEO | SDL_INIT_JOYSTICK) == -1 ) 
     { 
@@ -277,11 +485,24 @@ int main(int argc, char* argv[])
 
     bool loaded = false;
 
+    // Start in turbo mode. F4 toggles it while running.
+    // Save a replay of each time trial to a directory.
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-turbo") == 0)
+            set_turbo(true);
+        else if (strcmp(argv[i], "-record") == 0 && i + 1 < argc)
+            replay_dir = argv[++i];
+    }
+
     // Load LayOut File
-    if (argc == 3 && strcmp(argv[1], "-file") == 0)
+    if (argc >= 3 && strcmp(argv[1], "-file") == 0)
     {
         if (trackloader.set_layout_track(argv[2]))
             loaded = roms.load_revb_roms(); 
+
+        // Replays only store the settings for the original tracks
+        replay_dir = NULL;
     }
     // Load Roms Only
     else
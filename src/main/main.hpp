@@ -28,6 +28,9 @@ namespace cannonball
     // FPS Counter
     extern int fps_counter;
 
+    // Frames skipped in the last second, when frameskip is enabled
+    extern int skip_counter;
+
     // Engine Master State
     extern int state;
     
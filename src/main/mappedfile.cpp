@@ -0,0 +1,124 @@
+/***************************************************************************
+    Memory Mapped File.
+
+    Maps a file read-only into the address space, so it can be read
+    directly without first being copied into a buffer.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include "mappedfile.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <cstddef> // NULL
+
+MappedFile::MappedFile()
+{
+    data    = NULL;
+    size    = 0;
+    mtime   = 0;
+#ifdef _WIN32
+    file    = INVALID_HANDLE_VALUE;
+    mapping = NULL;
+#else
+    fd      = -1;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const char* filename)
+{
+    close();
+
+#ifdef _WIN32
+    file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    DWORD high = 0;
+    DWORD low  = GetFileSize(file, &high);
+    if (low == INVALID_FILE_SIZE || high != 0 || low == 0)
+    {
+        close();
+        return false;
+    }
+    size = low;
+
+    FILETIME modified;
+    if (GetFileTime(file, NULL, NULL, &modified))
+        mtime = ((uint64_t) modified.dwHighDateTime << 32) | modified.dwLowDateTime;
+
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+    {
+        close();
+        return false;
+    }
+
+    data = (const uint8_t*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL)
+    {
+        close();
+        return false;
+    }
+#else
+    fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64_t) st.st_size > 0xFFFFFFFF)
+    {
+        close();
+        return false;
+    }
+    size  = (uint32_t) st.st_size;
+    mtime = (uint64_t) st.st_mtime;
+
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        close();
+        return false;
+    }
+    data = (const uint8_t*) map;
+#endif
+    return true;
+}
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+    if (data)
+        UnmapViewOfFile(data);
+    if (mapping)
+        CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+    mapping = NULL;
+    file    = INVALID_HANDLE_VALUE;
+#else
+    if (data)
+        munmap((void*) data, size);
+    if (fd >= 0)
+        ::close(fd);
+    fd = -1;
+#endif
+    data  = NULL;
+    size  = 0;
+    mtime = 0;
+}
@@ -0,0 +1,42 @@
+/***************************************************************************
+    Memory Mapped File.
+
+    Maps a file read-only into the address space, so it can be read
+    directly without first being copied into a buffer.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include "stdint.hpp"
+
+class MappedFile
+{
+public:
+    // Start of file in memory (NULL if not open)
+    const uint8_t* data;
+
+    // Size of file in bytes
+    uint32_t size;
+
+    // Last modification time (platform specific units)
+    uint64_t mtime;
+
+    MappedFile();
+    ~MappedFile();
+
+    bool open(const char* filename);
+    void close();
+    bool is_open() const { return data != NULL; }
+
+private:
+    // Platform specific handles
+#ifdef _WIN32
+    void* file;
+    void* mapping;
+#else
+    int fd;
+#endif
+};
@@ -10,20 +10,293 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <map>
+#include <vector>
+#include <cstring>
 #include <cstddef>       // for std::size_t
 #include <boost/crc.hpp> // CRC Checking via Boost library.
+#include <SDL.h>
 
 #include "stdint.hpp"
 #include "romloader.hpp"
+#include "mappedfile.hpp"
 #include "setup.hpp"
 
 #ifdef __APPLE__
 #include "CoreFoundation/CoreFoundation.h"
 #endif
 
+// ------------------------------------------------------------------------------------------------
+// Queued Loading
+//
+// Files are memory mapped and loaded across several threads. Files that are interleaved into the
+// same destination are grouped, so their bytes can be combined and written a word at a time.
+//
+// CRCs are cached in FILENAME_ROMCRC, keyed by path, size and modification time, so unchanged
+// files aren't hashed again on the next boot.
+// ------------------------------------------------------------------------------------------------
+
+// Number of threads used to load roms
+static const int LOAD_THREADS = 4;
+
+struct RomFile
+{
+    RomLoader* loader;
+    std::string filename;
+    std::string path;
+    int offset;
+    int length;
+    uint32_t expected_crc;
+    uint8_t interleave;
+
+    // Results, filled in by the loading thread
+    int status;
+    uint32_t size;
+    uint64_t mtime;
+    uint32_t crc;
+    bool crc_cached;
+    std::string log;
+};
+
+struct RomCrc
+{
+    uint32_t size;
+    uint64_t mtime;
+    uint32_t crc;
+};
+
+// Pending files
+static std::vector<RomFile> rom_queue;
+
+// Files interleaved together, as indices into rom_queue
+static std::vector<std::vector<int> > rom_groups;
+
+// Next group to be loaded, shared by the loading threads
+static int next_group;
+static SDL_mutex* group_lock;
+
+// Cached CRCs by path. Read-only while the loading threads are running.
+static std::map<std::string, RomCrc> crc_cache;
+static bool crc_cache_loaded = false;
+
+static void set_bundle_directory()
+{
+#ifdef __APPLE__    
+    CFBundleRef mainBundle = CFBundleGetMainBundle();
+    CFURLRef resourcesURL = CFBundleCopyResourcesDirectoryURL(mainBundle);
+    char bundlepath[PATH_MAX];
+
+    if (!CFURLGetFileSystemRepresentation(resourcesURL, TRUE, (UInt8 *)bundlepath, PATH_MAX))
+    {
+        // error!
+    }
+
+    CFRelease(resourcesURL);
+    chdir(bundlepath);
+#endif
+}
+
+// Cache format: one file per line. <size> <mtime> <crc> <path>
+static void load_crc_cache()
+{
+    if (crc_cache_loaded)
+        return;
+
+    crc_cache_loaded = true;
+
+    std::ifstream in(FILENAME_ROMCRC);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream ss(line);
+        RomCrc entry;
+        std::string path;
+        ss >> entry.size >> entry.mtime >> std::hex >> entry.crc >> std::dec >> std::ws;
+        std::getline(ss, path);
+
+        if (!ss.fail() && !path.empty())
+            crc_cache[path] = entry;
+    }
+}
+
+static void save_crc_cache()
+{
+    std::ofstream out(FILENAME_ROMCRC);
+    if (!out)
+        return;
+
+    for (std::map<std::string, RomCrc>::iterator it = crc_cache.begin(); it != crc_cache.end(); ++it)
+        out << it->second.size << " " << it->second.mtime << " " << std::hex << it->second.crc << std::dec << " " << it->first << "\n";
+}
+
+// Map, verify and copy a group of files into their destination.
+// Runs on a loading thread, so results are stored rather than printed.
+static void load_group(const std::vector<int>& group)
+{
+    const int count = group.size();
+    MappedFile files[RomLoader::INTERLEAVE4];
+    bool complete = true;
+
+    for (int i = 0; i < count; i++)
+    {
+        RomFile& r = rom_queue[group[i]];
+        MappedFile& f = files[i];
+
+        if (!f.open(r.path.c_str()))
+        {
+            r.log    = "cannot open rom: " + r.filename;
+            r.status = 1;
+            complete = false;
+            continue;
+        }
+
+        r.size  = f.size;
+        r.mtime = f.mtime;
+
+        const uint32_t bytes = f.size < (uint32_t) r.length ? f.size : r.length;
+        if (bytes < (uint32_t) r.length)
+            complete = false;
+
+        // Check CRC on file, unless it's unchanged since it was last checked
+        std::map<std::string, RomCrc>::const_iterator it = crc_cache.find(r.path);
+        if (it != crc_cache.end() && it->second.size == r.size && it->second.mtime == r.mtime)
+        {
+            r.crc        = it->second.crc;
+            r.crc_cached = true;
+        }
+        else
+        {
+            boost::crc_32_type result;
+            result.process_bytes(f.data, bytes);
+            r.crc = result.checksum();
+        }
+
+        if (r.expected_crc != r.crc)
+        {
+            std::ostringstream ss;
+            ss << std::hex << r.filename << " has incorrect checksum.\nExpected: " << r.expected_crc << " Found: " << r.crc;
+            r.log = ss.str();
+        }
+    }
+
+    RomFile& first = rom_queue[group[0]];
+    uint8_t* dst   = first.loader->rom + first.offset;
+
+    // Interleave a full set of files together, a word at a time
+    if (complete && count == 2)
+    {
+        const uint8_t* a = files[0].data;
+        const uint8_t* b = files[1].data;
+        for (int i = 0; i < first.length; i++)
+        {
+            const uint8_t word[2] = {a[i], b[i]};
+            memcpy(dst + (i << 1), word, 2);
+        }
+    }
+    else if (complete && count == 4)
+    {
+        const uint8_t* a = files[0].data;
+        const uint8_t* b = files[1].data;
+        const uint8_t* c = files[2].data;
+        const uint8_t* d = files[3].data;
+        for (int i = 0; i < first.length; i++)
+        {
+            const uint8_t word[4] = {a[i], b[i], c[i], d[i]};
+            memcpy(dst + (i << 2), word, 4);
+        }
+    }
+    // Otherwise copy each file individually
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            RomFile& r = rom_queue[group[i]];
+            if (!files[i].is_open())
+                continue;
+
+            const uint8_t* src   = files[i].data;
+            const int bytes      = files[i].size < (uint32_t) r.length ? files[i].size : r.length;
+            uint8_t* rom         = r.loader->rom + r.offset;
+
+            if (r.interleave == RomLoader::NORMAL)
+                memcpy(rom, src, bytes);
+            else
+            {
+                for (int j = 0; j < bytes; j++)
+                    rom[j * r.interleave] = src[j];
+            }
+        }
+    }
+}
+
+static int load_thread(void*)
+{
+    while (true)
+    {
+        SDL_LockMutex(group_lock);
+        const int group = next_group++;
+        SDL_UnlockMutex(group_lock);
+
+        if (group >= (int) rom_groups.size())
+            return 0;
+
+        load_group(rom_groups[group]);
+    }
+}
+
+// Find the files that can be interleaved together: same destination and length, 
+// with consecutive offsets covering the full interleave.
+static void build_groups()
+{
+    rom_groups.clear();
+    std::vector<bool> grouped(rom_queue.size(), false);
+
+    for (int i = 0; i < (int) rom_queue.size(); i++)
+    {
+        if (grouped[i])
+            continue;
+
+        const RomFile& r = rom_queue[i];
+        std::vector<int> group(1, i);
+        grouped[i] = true;
+
+        if (r.interleave != RomLoader::NORMAL && (r.offset % r.interleave) == 0)
+        {
+            std::vector<int> members(1, i);
+            for (int lane = 1; lane < r.interleave; lane++)
+            {
+                for (int j = i + 1; j < (int) rom_queue.size(); j++)
+                {
+                    const RomFile& o = rom_queue[j];
+                    if (!grouped[j] && o.loader == r.loader && o.length == r.length &&
+                        o.interleave == r.interleave && o.offset == r.offset + lane)
+                    {
+                        members.push_back(j);
+                        break;
+                    }
+                }
+            }
+
+            if ((int) members.size() == r.interleave)
+            {
+                for (int j = 1; j < (int) members.size(); j++)
+                    grouped[members[j]] = true;
+                group = members;
+            }
+        }
+
+        rom_groups.push_back(group);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+
 RomLoader::RomLoader()
 {
     loaded = false;
+    crc    = 0;
+    words  = NULL;
 }
 
 RomLoader::~RomLoader()
@@ -33,68 +306,128 @@ RomLoader::~RomLoader()
 void RomLoader::init(const uint32_t length)
 {
     this->length = length;
+    this->crc    = 0;
     rom = new uint8_t[length];
 }
 
 void RomLoader::unload(void)
 {
     delete[] rom;
+    delete[] words;
+    words = NULL;
+}
+
+// Decode the loaded rom into native-endian words. 
+// Call again if the contents of the rom change.
+void RomLoader::make_native()
+{
+    if (words == NULL)
+        words = new uint16_t[length >> 1];
+
+    for (uint32_t i = 0; i < (length >> 1); i++)
+        words[i] = (rom[i << 1] << 8) | rom[(i << 1) + 1];
 }
 
 int RomLoader::load(const char* filename, const int offset, const int length, const int expected_crc, const uint8_t interleave)
 {
+    queue(filename, offset, length, expected_crc, interleave);
+    return load_queued();
+}
 
-#ifdef __APPLE__    
-    CFBundleRef mainBundle = CFBundleGetMainBundle();
-    CFURLRef resourcesURL = CFBundleCopyResourcesDirectoryURL(mainBundle);
-    char bundlepath[PATH_MAX];
+// Queue a file to be loaded by load_queued()
+void RomLoader::queue(const char* filename, const int offset, const int length, const int expected_crc, const uint8_t interleave)
+{
+    RomFile r;
+    r.loader       = this;
+    r.filename     = filename;
+    r.path         = std::string(DIRECTORY_ROMS) + filename;
+    r.offset       = offset;
+    r.length       = length;
+    r.expected_crc = expected_crc;
+    r.interleave   = interleave;
+    r.status       = 0;
+    r.size         = 0;
+    r.mtime        = 0;
+    r.crc          = 0;
+    r.crc_cached   = false;
+    rom_queue.push_back(r);
+}
 
-    if (!CFURLGetFileSystemRepresentation(resourcesURL, TRUE, (UInt8 *)bundlepath, PATH_MAX))
-    {
-        // error!
-    }
+// Load all queued files.
+// Returns the number of files that failed to load.
+int RomLoader::load_queued()
+{
+    if (rom_queue.empty())
+        return 0;
 
-    CFRelease(resourcesURL);
-    chdir(bundlepath);
-#endif
+    set_bundle_directory();
+    load_crc_cache();
+    build_groups();
 
-    std::string path = DIRECTORY_ROMS;
-    path += std::string(filename);
+    // Load on the calling thread when there is nothing to gain from more
+    next_group = 0;
+    const int threads = rom_groups.size() < (size_t) LOAD_THREADS ? rom_groups.size() : LOAD_THREADS;
+    group_lock = SDL_CreateMutex();
 
-    // Open rom file
-    std::ifstream src(path.c_str(), std::ios::in | std::ios::binary);
-    if (!src)
+    std::vector<SDL_Thread*> workers;
+    for (int i = 1; i < threads && group_lock != NULL; i++)
     {
-        std::cout << "cannot open rom: " << filename << std::endl;
-        loaded = false;
-        return 1; // fail
+#ifdef SDL2
+        SDL_Thread* t = SDL_CreateThread(load_thread, "romloader", NULL);
+#else
+        SDL_Thread* t = SDL_CreateThread(load_thread, NULL);
+#endif
+        if (t != NULL)
+            workers.push_back(t);
     }
 
-    // Read file
-    char* buffer = new char[length];
-    src.read(buffer, length);
-
-    // Check CRC on file
-    boost::crc_32_type result;
-    result.process_bytes(buffer, (size_t) src.gcount());
-
-    if (expected_crc != result.checksum())
+    if (group_lock != NULL)
+        load_thread(NULL);
+    else
     {
-        std::cout << std::hex << 
-            filename << " has incorrect checksum.\nExpected: " << expected_crc << " Found: " << result.checksum() << std::endl;
+        for (int i = 0; i < (int) rom_groups.size(); i++)
+            load_group(rom_groups[i]);
     }
 
-    // Interleave file as necessary
-    for (int i = 0; i < length; i++)
+    for (int i = 0; i < (int) workers.size(); i++)
+        SDL_WaitThread(workers[i], NULL);
+
+    if (group_lock != NULL)
+        SDL_DestroyMutex(group_lock);
+    group_lock = NULL;
+
+    // Report results in the order the files were queued and update the CRC cache
+    int failed = 0;
+    bool cache_dirty = false;
+
+    for (int i = 0; i < (int) rom_queue.size(); i++)
     {
-        rom[(i * interleave) + offset] = buffer[i];
+        RomFile& r = rom_queue[i];
+
+        if (!r.log.empty())
+            std::cout << r.log << std::endl;
+
+        failed += r.status;
+        r.loader->loaded = (r.status == 0);
+        r.loader->crc    = ((r.loader->crc << 5) | (r.loader->crc >> 27)) ^ r.crc;
+
+        if (r.status == 0 && !r.crc_cached)
+        {
+            RomCrc entry;
+            entry.size  = r.size;
+            entry.mtime = r.mtime;
+            entry.crc   = r.crc;
+            crc_cache[r.path] = entry;
+            cache_dirty = true;
+        }
     }
 
-    // Clean Up
-    delete[] buffer;
-    src.close();
-    loaded = true;
-    return 0; // success
+    if (cache_dirty)
+        save_crc_cache();
+
+    rom_queue.clear();
+    rom_groups.clear();
+    return failed;
 }
 
 // Load Binary File (LayOut Levels, Tilemap Data etc.)
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <cassert>
+
 class RomLoader
 {
 
@@ -18,17 +20,27 @@ public:
 
     uint8_t* rom;
 
+    // Native-endian copy of the rom, one entry per 68000 word.
+    // Built by make_native() once loading has finished. NULL until then.
+    uint16_t* words;
+
     // Size of rom
     uint32_t length;
 
     // Successfully loaded
     bool loaded;
 
+    // Combined CRC of the files loaded, in load order
+    uint32_t crc;
+
     RomLoader();
     ~RomLoader();
     void init(uint32_t);
     int load(const char* filename, const int offset, const int length, const int expected_crc, const uint8_t mode = NORMAL);
+    void queue(const char* filename, const int offset, const int length, const int expected_crc, const uint8_t mode = NORMAL);
+    static int load_queued();
     int load_binary(const char* filename);
+    void make_native();
     void unload(void);
 
     // ----------------------------------------------------------------------------
@@ -69,6 +81,38 @@ public:
         return rom[addr];
     }
 
+    // Aligned word and long reads from the native-endian table.
+    // Same results as read16/read32, without assembling the value a byte at a time.
+    //
+    // The caller must guarantee the address is even, as the 68000 did for every word and long
+    // read. Alignment and bounds are only checked by asserts in debug builds. In release builds
+    // an odd address silently reads the word at addr & ~1, which differs from read16/read32.
+    inline uint16_t read16_aligned(uint32_t addr)
+    {
+        assert(words != NULL && (addr & 1) == 0 && addr + 1 < length);
+        return words[addr >> 1];
+    }
+
+    inline uint32_t read32_aligned(uint32_t addr)
+    {
+        assert(words != NULL && (addr & 1) == 0 && addr + 3 < length);
+        return ((uint32_t) words[addr >> 1] << 16) | words[(addr >> 1) + 1];
+    }
+
+    inline uint16_t read16_aligned(uint32_t* addr)
+    {
+        uint16_t data = read16_aligned(*addr);
+        *addr += 2;
+        return data;
+    }
+
+    inline uint32_t read32_aligned(uint32_t* addr)
+    {
+        uint32_t data = read32_aligned(*addr);
+        *addr += 4;
+        return data;
+    }
+
     // ----------------------------------------------------------------------------
     // Used by translated Z80 Code
     // Note that the endian is reversed compared with the 68000 code.
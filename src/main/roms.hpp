@@ -32,11 +32,14 @@ public:
     Roms();
     ~Roms();
     bool load_revb_roms();
+    bool load_sound_roms();
     bool load_japanese_roms();
     bool load_pcm_rom(bool);
 
 private:
     int jap_rom_status;
+
+    void queue_sound_roms();
 };
 
 extern Roms roms;
\ No newline at end of file
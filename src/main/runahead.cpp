@@ -0,0 +1,83 @@
+/***************************************************************************
+    Run-Ahead.
+
+    Hides a frame or two of the game's own input latency by drawing the
+    game as it will be a few frames from now.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <cstring>
+
+#ifdef SDL2
+#include "sdl2/input.hpp"
+#else
+#include "sdl/input.hpp"
+#endif
+
+#include "main.hpp"
+#include "video.hpp"
+#include "runahead.hpp"
+#include "enginesnapshot.hpp"
+#include "frontend/config.hpp"
+#include "engine/outrun.hpp"
+#include "engine/oinputs.hpp"
+
+RunAhead::RunAhead()
+{
+    snapshot = NULL;
+}
+
+RunAhead::~RunAhead()
+{
+    delete snapshot;
+}
+
+// Run the engine ahead of the real frame, optionally draw the result, then put everything back.
+void RunAhead::run(int frames, Packet* packet, bool draw)
+{
+    // Created on first use, once the engine and sound chips are running
+    if (snapshot == NULL)
+        snapshot = new EngineSnapshot();
+    else
+        snapshot->save();
+
+    // Input isn't part of the engine state, but the engine clears some presses as it reads them
+    bool keys[sizeof(input.keys)], keys_old[sizeof(input.keys_old)];
+    memcpy(keys,     input.keys,     sizeof(keys));
+    memcpy(keys_old, input.keys_old, sizeof(keys_old));
+
+    const int haptic = config.controls.haptic;
+    config.controls.haptic = 0;
+
+    for (int i = 0; i < frames; i++)
+        tick_engine(packet);
+
+    config.controls.haptic = haptic;
+
+    if (draw)
+        video.draw_frame();
+
+    snapshot->load();
+    memcpy(input.keys,     keys,     sizeof(keys));
+    memcpy(input.keys_old, keys_old, sizeof(keys_old));
+}
+
+// Advance the engine by one frame, as the main loop does in game.
+void RunAhead::tick_engine(Packet* packet)
+{
+    cannonball::frame++;
+
+    if (config.fps == 60)
+        cannonball::tick_frame = cannonball::frame & 1;
+    else if (config.fps == 120)
+        cannonball::tick_frame = (cannonball::frame & 3) == 1;
+
+    if (cannonball::tick_frame)
+        oinputs.tick(packet);
+    oinputs.do_gear();
+
+    outrun.tick(packet, cannonball::tick_frame);
+    input.frame_done();
+}
@@ -0,0 +1,35 @@
+/***************************************************************************
+    Run-Ahead.
+
+    Hides a frame or two of the game's own input latency. Once the real
+    frame has been run, the engine is saved and run a few frames further
+    using the current controls. That future frame is drawn, then the saved
+    state is restored, so the frames ahead never affect the real game.
+
+    Sound and force feedback are not produced for the frames ahead, and
+    anything they queue is thrown away when the state is restored.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include "stdint.hpp"
+
+class EngineSnapshot;
+struct Packet;
+
+class RunAhead
+{
+public:
+    RunAhead();
+    ~RunAhead();
+
+    void run(int frames, Packet* packet, bool draw);
+
+    static void tick_engine(Packet* packet);
+
+private:
+    EngineSnapshot* snapshot;
+};
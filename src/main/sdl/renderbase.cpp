@@ -8,6 +8,13 @@ RenderBase::RenderBase()
 
     orig_width  = 0;
     orig_height = 0;
+
+    // The resultant values are the same as MAME
+    for (int i = 0; i < 32; i++)
+    {
+        expand5[i]        = i * 255 / 31;
+        expand5_shadow[i] = expand5[i] * 202 / 256;
+    }
 }
 
 // Setup screen size
@@ -33,25 +40,15 @@ bool RenderBase::sdl_screen_size()
     return true;
 }
 
-// See: SDL_PixelFormat
-#define CURRENT_RGB() (r << Rshift) | (g << Gshift) | (b << Bshift);
-
+// Components are 5-bit values. Shifts are from the SDL_PixelFormat.
+// Called for each palette entry written since the last frame.
 void RenderBase::convert_palette(uint32_t adr, uint32_t r, uint32_t g, uint32_t b)
 {
     adr >>= 1;
 
-    r = r * 255 / 31;
-    g = g * 255 / 31;
-    b = b * 255 / 31;
-
-    rgb[adr] = CURRENT_RGB();
+    rgb[adr] = (expand5[r] << Rshift) | (expand5[g] << Gshift) | (expand5[b] << Bshift);
       
     // Create shadow / highlight colours at end of RGB array
-    // The resultant values are the same as MAME
-    r = r * 202 / 256;
-    g = g * 202 / 256;
-    b = b * 202 / 256;
-        
     rgb[adr + S16_PALETTE_ENTRIES] =
-    rgb[adr + (S16_PALETTE_ENTRIES * 2)] = CURRENT_RGB();
+    rgb[adr + (S16_PALETTE_ENTRIES * 2)] = (expand5_shadow[r] << Rshift) | (expand5_shadow[g] << Gshift) | (expand5_shadow[b] << Bshift);
 }
\ No newline at end of file
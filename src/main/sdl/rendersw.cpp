@@ -9,23 +9,33 @@
 ***************************************************************************/
 
 #include <iostream>
+#include <cstring>
 
 #include "rendersw.hpp"
 #include "frontend/config.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RENDER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RENDER_NEON
+#include <arm_neon.h>
+#endif
+
 RenderSW::RenderSW()
 {
-    scan_pixels = NULL;
-    pix         = NULL;
+    pix      = NULL;
+    scan_row = NULL;
+    xmap     = NULL;
+    ymap     = NULL;
 }
 
 RenderSW::~RenderSW()
 {
-    if (scan_pixels) 
-        delete[] scan_pixels;
-
-    if (pix)
-        delete[] pix;
+    delete[] pix;
+    delete[] scan_row;
+    delete[] xmap;
+    delete[] ymap;
 }
 
 bool RenderSW::init(int src_width, int src_height, 
@@ -150,16 +160,15 @@ bool RenderSW::init(int src_width, int src_height,
     Gmask  = surface->format->Gmask;
     Bmask  = surface->format->Bmask;
 
-    // Doubled intermediate pixel array for scanlines
-    if (scanlines)
-    {
-        if (scan_pixels) delete[] scan_pixels;
-        scan_pixels = new uint32_t[(src_width * 2) * (src_height * 2)];
-    }
+    // Scanlines are disabled in stretch mode, and there's no room for them when the screen isn't scaled
+    this->scanlines = scale_factor == 1 ? 0 : scanlines;
+
+    delete[] pix;
+    delete[] scan_row;
+    pix      = new uint32_t[src_width * src_height];
+    scan_row = new uint32_t[src_width];
 
-    if (pix)
-        delete[] pix;
-    pix = new uint32_t[src_width * src_height];
+    build_maps();
 
     return true;
 }
@@ -184,131 +193,175 @@ bool RenderSW::finalize_frame()
     return true;
 }
 
+// Palette conversion, scanlines and scaling in a single pass over the destination. 
+// Each source row is converted once. Destination rows that repeat the previous one are copied.
 void RenderSW::draw_frame(uint16_t* pixels)
 {
-    // Do Scaling
-    if (scale_factor != 1)
-    {
-        uint32_t* pixx = pix;
+    uint32_t* dst  = screen_pixels + screen_xoff + screen_yoff;
+    int converted  = 0;  // Source rows converted so far
+    int last       = -1; // Row of the source image drawn to the previous destination row
 
-        // Lookup real RGB value from rgb array for backbuffer
-        for (int i = 0; i < (src_width * src_height); i++)
-            *(pixx++) = rgb[*(pixels++) & ((S16_PALETTE_ENTRIES * 3) - 1)];
+    for (int y = 0; y < dst_height; y++, dst += scn_width)
+    {
+        const int row = ymap[y];
 
-        // Scanlines: (Full Screen or Windowed). Potentially slow. 
-        if (scanlines)
+        if (row == last)
         {
-            // Add the scanlines. Double image in the process to create space for the scanlines.
-            scanlines_32bpp(pix, src_width, src_height, scan_pixels, scanlines);
-
-            // Now scale up again
-            scale(scan_pixels, src_width * 2, src_height * 2, 
-                  screen_pixels + screen_xoff + screen_yoff, dst_width, dst_height);
+            memcpy(dst, dst - scn_width, dst_width * sizeof(uint32_t));
+            continue;
         }
-        // Windowed: Use Faster Scaling algorithm
-        else if (video_mode == video_settings_t::MODE_WINDOW)
+        last = row;
+
+        const int  sy       = scanlines ? row >> 1 : row;
+        const bool scanline = scanlines && (row & 1);
+
+        // A scanline is interpolated with the next source row, so that must be converted too
+        const int needed = std::min(scanline ? sy + 2 : sy + 1, src_height);
+        for (; converted < needed; converted++)
         {
-            scalex(pix, src_width, src_height, screen_pixels, scale_factor); 
+            uint32_t* pixx        = pix    + (converted * src_width);
+            const uint16_t* spix  = pixels + (converted * src_width);
+
+            // Lookup real RGB value from rgb array for backbuffer
+            for (int x = 0; x < src_width; x++)
+                pixx[x] = rgb[spix[x] & ((S16_PALETTE_ENTRIES * 3) - 1)];
         }
-        // Full Screen: Stretch screen. May not be an integer multiple of original size.
-        //                              Therefore, scaling is slower.
-        else
+
+        const uint32_t* src = pix + (sy * src_width);
+
+        if (scanline)
         {
-            scale(pix, src_width, src_height, 
-                  screen_pixels + screen_xoff + screen_yoff, dst_width, dst_height);
+            scanline_row(src, sy + 1 < src_height ? src + src_width : NULL, scan_row, scanlines);
+            src = scan_row;
         }
+
+        expand_row(src, dst);
     }
+}
+
+// Map each destination pixel to the source pixel it's copied from.
+// The stepping matches the separate scaling passes this replaces, so the output is unchanged.
+void RenderSW::build_maps()
+{
+    delete[] xmap;
+    delete[] ymap;
+    xmap = new uint16_t[dst_width];
+    ymap = new uint16_t[dst_height];
+
     // No Scaling
+    if (scale_factor == 1)
+    {
+        for (int x = 0; x < dst_width; x++)  xmap[x] = x;
+        for (int y = 0; y < dst_height; y++) ymap[y] = y;
+    }
+    // Windowed: Integer multiple of original size
+    else if (!scanlines && video_mode == video_settings_t::MODE_WINDOW)
+    {
+        for (int x = 0; x < dst_width; x++)  xmap[x] = x / scale_factor;
+        for (int y = 0; y < dst_height; y++) ymap[y] = y / scale_factor;
+    }
+    // Fixed point (16.16) stepping through the source. 
+    // With scanlines, the source is doubled in size to create space for the scanlines.
     else
     {
-        uint32_t* spix = screen_pixels;
-    
-        // Lookup real RGB value from rgb array for backbuffer
-        for (int i = 0; i < (src_width * src_height); i++)
-            *(spix++) = rgb[*(pixels++) & ((S16_PALETTE_ENTRIES * 3) - 1)];
+        const int shift = scanlines ? 1 : 0;
+        const int xstep = ((src_width  << shift) << 16) / dst_width;
+        const int ystep = ((src_height << shift) << 16) / dst_height;
+
+        for (int x = 0; x < dst_width; x++)  xmap[x] = ((x * xstep) >> 16) >> shift;
+        for (int y = 0; y < dst_height; y++) ymap[y] = (y * ystep) >> 16;
     }
 
-    // Example: Set the pixel at 10,10 to red
-    //pixels[( 10 * surface->w ) + 10] = 0xFF0000;
-    // ------------------------------------------------------------------------      
+    // Check for an integer horizontal scale, which doesn't need the map
+    xrepeat = 0;
+    if (dst_width % src_width == 0)
+    {
+        const int repeat = dst_width / src_width;
+        bool match = true;
+        for (int x = 0; x < dst_width && match; x++)
+            match = xmap[x] == x / repeat;
+        if (match)
+            xrepeat = repeat;
+    }
 }
 
-// Fastest scaling algorithm. Scales proportionally.
-void RenderSW::scalex(uint32_t* src, const int srcwid, const int srchgt, uint32_t* dest, const int scale)
+// Scale one row of source pixels to the destination width
+void RenderSW::expand_row(const uint32_t* src, uint32_t* dst)
 {
-    const int destwid = srcwid * scale;
+    int x = 0;
 
-    for (int y = 0; y < srchgt; y++)
+    switch (xrepeat)
     {
-        int src_inc = 0;
-    
-        // First Row
-        for (int x = 0; x < destwid; x++)
-        {
-            *dest++ = *src;
-            if (++src_inc == scale)
+        case 1:
+            memcpy(dst, src, src_width * sizeof(uint32_t));
+            return;
+
+        case 2:
+        #if defined RENDER_SSE2
+            for (; x + 4 <= src_width; x += 4, dst += 8)
             {
-                src_inc = 0;
-                src++;
+                __m128i s = _mm_loadu_si128((const __m128i*) (src + x));
+                _mm_storeu_si128((__m128i*) (dst + 0), _mm_unpacklo_epi32(s, s));
+                _mm_storeu_si128((__m128i*) (dst + 4), _mm_unpackhi_epi32(s, s));
             }
-        }
-        // Make additional copies of this row
-        for (int i = 0; i < scale-1; i++)
-        {
-            memcpy(dest, dest - destwid, destwid * sizeof(uint32_t)); 
-            dest += destwid;
-        }
-    }
-}
-
-/**
-* 
-* Fixed point image scaling code (16.16)
-* 
-* Speed increases when scaling smaller images. Scaling images up is expensive.
-* 
-* src          pointer to the image we want to scale
-* srcwid       how wide is the entire source image?
-* srchgt       how tall is the entire source image?
-* dest         pointer to the bitmap we want to scale into (destination)
-* dstwid       how wide do we want the source image to be?
-* dsthgt       how tall do we want the source image to be?
-* 
-* @author Chris White
-* 
-*/
-void RenderSW::scale( uint32_t* src, int srcwid, int srchgt, 
-                      uint32_t* dst, int dstwid, int dsthgt)
-{
-    int xstep = (srcwid << 16) / dstwid; // calculate distance (in source) between
-    int ystep = (srchgt << 16) / dsthgt; // pixels (in dest)
-    int srcy  = 0; // y-cordinate in source image
-        
-    for (int y = 0; y < dsthgt; y++)
-    {
-        int srcx = 0; // reset our x counter before each row...
+        #elif defined RENDER_NEON
+            for (; x + 4 <= src_width; x += 4, dst += 8)
+            {
+                uint32x4_t s = vld1q_u32(src + x);
+                uint32x4x2_t d = vzipq_u32(s, s);
+                vst1q_u32(dst + 0, d.val[0]);
+                vst1q_u32(dst + 4, d.val[1]);
+            }
+        #endif
+            for (; x < src_width; x++)
+            {
+                *dst++ = src[x];
+                *dst++ = src[x];
+            }
+            return;
 
-        for (int x = 0; x < dstwid; x++)
-        {
-            *dst++ = *(src + (srcx >> 16));  // copy next pixel
-            srcx += xstep;                   // move through source image
-        }
+        case 3:
+            for (; x < src_width; x++)
+            {
+                *dst++ = src[x];
+                *dst++ = src[x];
+                *dst++ = src[x];
+            }
+            return;
 
-        // Ensure we wrap to the next line correctly, when destination screen size
-        // is different aspect ratio (e.g. wider)
-        if (scn_width > dstwid)
-            dst += (scn_width - dstwid);
-            
-        //
-        // figure out if we are still on the same row as last time
-        // through the loop, and if so we move the source pointer accordingly.
-        // If not, we add nothing to the source counter, and go back to the beginning
-        // of the row (in the source image) we just drew.
-        //
-
-        srcy += ystep;                  // move through the source image...
-        src += ((srcy >> 16) * srcwid); // and possibly to the next row.
-        srcy &= 0xffff;                 // set up the y-coordinate between 0 and 1
+        case 4:
+        #if defined RENDER_SSE2
+            for (; x + 4 <= src_width; x += 4, dst += 16)
+            {
+                __m128i s = _mm_loadu_si128((const __m128i*) (src + x));
+                _mm_storeu_si128((__m128i*) (dst + 0),  _mm_shuffle_epi32(s, 0x00));
+                _mm_storeu_si128((__m128i*) (dst + 4),  _mm_shuffle_epi32(s, 0x55));
+                _mm_storeu_si128((__m128i*) (dst + 8),  _mm_shuffle_epi32(s, 0xAA));
+                _mm_storeu_si128((__m128i*) (dst + 12), _mm_shuffle_epi32(s, 0xFF));
+            }
+        #elif defined RENDER_NEON
+            for (; x < src_width; x++, dst += 4)
+                vst1q_u32(dst, vdupq_n_u32(src[x]));
+        #endif
+            for (; x < src_width; x++)
+            {
+                *dst++ = src[x];
+                *dst++ = src[x];
+                *dst++ = src[x];
+                *dst++ = src[x];
+            }
+            return;
+
+        case 0:
+            for (; x < dst_width; x++)
+                dst[x] = src[xmap[x]];
+            return;
+
+        default:
+            for (; x < src_width; x++)
+                for (int i = 0; i < xrepeat; i++)
+                    *dst++ = src[x];
+            return;
     }
 }
 
@@ -344,91 +397,42 @@ void RenderSW::scale( uint32_t* src, int srcwid, int srchgt,
 
 // Modified version of the original to handle different 32bpp formats.
 
-// Note that this takes an unscaled source pixel array as input, and then 
-// doubles it up, in order to insert the scanlines.
+// Note that this creates a single scanline row at source resolution, from the row above 
+// (src1) and the row below (src2). The final scanline has no row below, so src2 is NULL.
 
-void RenderSW::scanlines_32bpp(uint32_t* src, const int width, const int height, 
-                               uint32_t* dst, int percent, bool interpolate)
+void RenderSW::scanline_row(const uint32_t* src1, const uint32_t* src2, uint32_t* dst, int percent)
 {
-    const int dst_width1 = width << 1;
-    const int dst_width2 = width << 2;
-    
-    uint32_t* sBuf = dst;              // Normal Scanline
-    uint32_t* pBuf = dst + dst_width1; // Darkened Scanline
-    
-    for (int y = 0; y < height; y++)
-    {
-        // Double the pixels for this row
-        for (int x = 0; x < width; x++)
-        {
-            *dst++ = *src;
-            *dst++ = *src++;
-        }
-
-        // Omit one row.
-        // We will fill the omitted row with a scanline later
-        dst += dst_width1;
-    }
-        
     // Optimization for black scanlines
     if (percent == 100)
     {
-        for (int h = 0; h < height; h++) 
-        {
-            memset(pBuf, 0, dst_width1 * sizeof(uint32_t));
-            pBuf += dst_width2; // Advance two lines
-        }
+        memset(dst, 0, src_width * sizeof(uint32_t));
         return;
     }
 
-    if (interpolate) 
+    if (src2) 
     {
-        uint32_t* tBuf = sBuf + dst_width2;    // Next Scanline (For Interpolation)
-        int percent_orig = percent;            // Backup for final scanline
-
         percent = ((100-percent) << 8) / 200;
-        for (int h = 0; h < height-1; h++) 
-        {
-            for (int w = 0; w < dst_width1; w++) 
-            {
-                uint32_t pixel1 = sBuf[w]; // Normal Pixel
-                uint32_t pixel2 = tBuf[w]; // Pixel to interpolate
-                uint32_t r = (( ((pixel1 & Rmask)+(pixel2 & Rmask)) * percent) >> 8) & Rmask;
-                uint32_t g = (( ((pixel1 & Gmask)+(pixel2 & Gmask)) * percent) >> 8) & Gmask;
-                uint32_t b = (( ((pixel1 & Bmask)+(pixel2 & Bmask)) * percent) >> 8) & Bmask;
-                pBuf[w] = r | g | b;
-            }
-            sBuf += dst_width2; // Advance two lines
-            tBuf += dst_width2;
-            pBuf += dst_width2;
-        }
-
-        // Do final scanline (no interpolation with next line)
-        percent = ((100-percent_orig) << 8) / 100;
-        for (int w = 0; w < dst_width1; w++) 
+        for (int w = 0; w < src_width; w++) 
         {
-            uint32_t pixel = sBuf[w];
-            uint32_t r = (( (pixel & Rmask) * percent) >> 8) & Rmask;
-            uint32_t g = (( (pixel & Gmask) * percent) >> 8) & Gmask;
-            uint32_t b = (( (pixel & Bmask) * percent) >> 8) & Bmask;
-            pBuf[w] = r | g | b;
+            uint32_t pixel1 = src1[w]; // Normal Pixel
+            uint32_t pixel2 = src2[w]; // Pixel to interpolate
+            uint32_t r = (( ((pixel1 & Rmask)+(pixel2 & Rmask)) * percent) >> 8) & Rmask;
+            uint32_t g = (( ((pixel1 & Gmask)+(pixel2 & Gmask)) * percent) >> 8) & Gmask;
+            uint32_t b = (( ((pixel1 & Bmask)+(pixel2 & Bmask)) * percent) >> 8) & Bmask;
+            dst[w] = r | g | b;
         }
     } 
+    // Do final scanline (no interpolation with next line)
     else 
     {
         percent = ((100-percent) << 8) / 100;
-        for (int h = 0; h < height; h++) 
+        for (int w = 0; w < src_width; w++) 
         {
-            for (int w = 0; w < dst_width1; w++) 
-            {
-                uint32_t pixel = sBuf[w];
-                uint32_t r = (( (pixel & Rmask) * percent) >> 8) & Rmask;
-                uint32_t g = (( (pixel & Gmask) * percent) >> 8) & Gmask;
-                uint32_t b = (( (pixel & Bmask) * percent) >> 8) & Bmask;
-                pBuf[w] = r | g | b;
-            }
-            sBuf += dst_width2; // Advance two lines
-            pBuf += dst_width2;
+            uint32_t pixel = src1[w];
+            uint32_t r = (( (pixel & Rmask) * percent) >> 8) & Rmask;
+            uint32_t g = (( (pixel & Gmask) * percent) >> 8) & Gmask;
+            uint32_t b = (( (pixel & Bmask) * percent) >> 8) & Bmask;
+            dst[w] = r | g | b;
         }
     }
 }
\ No newline at end of file
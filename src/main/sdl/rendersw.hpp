@@ -27,20 +27,27 @@ public:
     void draw_frame(uint16_t* pixels);
 
 private:
-    // Scanline pixels
-    uint32_t* scan_pixels;
-
-    // Pixel Conversion
+    // Palette converted source pixels. Each row is converted once per frame, when first needed.
     uint32_t* pix;
 
+    // Blended scanline row, at source resolution
+    uint32_t* scan_row;
+
+    // Source column for each destination column
+    uint16_t* xmap;
+
+    // Row of the (scanline doubled) source image for each destination row.
+    // With scanlines, odd rows are the scanlines between source rows.
+    uint16_t* ymap;
+
+    // Integer horizontal scale, where every source pixel is repeated the same number of times.
+    // 0 if the destination columns have to be looked up in xmap.
+    int xrepeat;
+
     // Scale the screen
     int scale_factor;
 
-    void scale( uint32_t* src, int srcwid, int srchgt, 
-                uint32_t* dest, int dstwid, int dsthgt);
-    
-    void scanlines_32bpp(uint32_t* src, const int width, const int height, 
-                         uint32_t* dst, int percent, const bool interpolate = true);
-
-    void scalex( uint32_t* src, const int srcwid, const int srchgt, uint32_t* dest, const int scale);
+    void build_maps();
+    void expand_row(const uint32_t* src, uint32_t* dst);
+    void scanline_row(const uint32_t* src1, const uint32_t* src2, uint32_t* dst, int percent);
 };
\ No newline at end of file
@@ -25,6 +25,7 @@
 
 #include "frontend/config.hpp" // fps
 #include "engine/audio/osoundint.hpp"
+#include "hwaudio/mixer.hpp"
 
 #ifdef COMPILE_SOUND_CODE
 
@@ -39,6 +40,7 @@ static int dsp_write_pos;
 static int dsp_read_pos;
 static int callbacktick;     // tick at which callback occured
 static int bytes_per_sample; // Number of bytes per sample entry (usually 4 bytes if stereo and 16-bit sound)
+static AudioStats stats;     // Buffer health, updated by both the callback and Audio::tick
 
 // SDL Audio Callback Function
 extern void fill_audio(void *udata, Uint8 *stream, int len);
@@ -128,13 +130,12 @@ void Audio::start_audio()
         dsp_buffer_bytes = CHANNELS * dsp_buffer_samps * (BITS / 8);
         dsp_buffer = new uint8_t[dsp_buffer_bytes];
 
-        // Create Buffer For Mixing
-        uint16_t buffer_size = (FREQ / config.fps) * CHANNELS;
-        mix_buffer = new uint16_t[buffer_size];
-
         clear_buffers();
         clear_wav();
 
+        stats.reset(FREQ, SAMPLES);
+        stats_frames = 0;
+
         SDL_PauseAudioDevice(dev,0);
     }
 }
@@ -150,10 +151,6 @@ void Audio::clear_buffers()
     for (int i = 0; i < dsp_buffer_bytes; i++)
         dsp_buffer[i] = 0;
 
-    uint16_t buffer_size = (FREQ / config.fps) * CHANNELS;
-    for (int i = 0; i < buffer_size; i++)
-        mix_buffer[i] = 0;
-
     callbacktick = 0;
 }
 
@@ -162,12 +159,12 @@ void Audio::stop_audio()
     if (sound_enabled)
     {
         sound_enabled = false;
+        clear_wav();
 
         SDL_PauseAudioDevice(dev,1);
         SDL_CloseAudioDevice(dev);
 
         delete[] dsp_buffer;
-        delete[] mix_buffer;
     }
 }
 
@@ -194,6 +191,7 @@ void Audio::tick()
     int bytes_written = 0;
     int newpos;
     double bytes_per_ms;
+    uint32_t waits = 0;
 
     if (!sound_enabled) return;
 
@@ -201,34 +199,8 @@ void Audio::tick()
     osoundint.pcm->stream_update();
     osoundint.ym->stream_update();
 
-    // Get the audio buffers we've just output
-    int16_t *pcm_buffer = osoundint.pcm->get_buffer();
-    int16_t *ym_buffer  = osoundint.ym->get_buffer();
-    int16_t *wav_buffer = wavfile.data;
-
     int samples_written = osoundint.pcm->buffer_size;
 
-    // And mix them into the mix_buffer
-    for (int i = 0; i < samples_written; i++)
-    {
-        int32_t mix_data = wav_buffer[wavfile.pos] + pcm_buffer[i] + ym_buffer[i];
-
-        // Clip mix data
-        if (mix_data >= (1 << 15))
-            mix_data = (1 << 15);
-        else if (mix_data < -(1 << 15))
-            mix_data = -(1 << 15);
-
-        mix_buffer[i] = mix_data;
-
-        // Loop wav files
-        if (++wavfile.pos >= wavfile.length)
-            wavfile.pos = 0;
-    }
-
-    // Cast mix_buffer to a byte array, to align it with internal SDL format 
-    uint8_t* mbuf8 = (uint8_t*) mix_buffer;
-
     // produce samples from the sound emulation
     bytes_per_ms = (bytes_per_sample) * (FREQ/1000.0);
     bytes_written = (BITS == 8 ? samples_written : samples_written*2);
@@ -249,22 +221,24 @@ void Audio::tick()
         // and delay until it runs and allows space.
         SDL_Delay(1);
         SDL_LockAudio();
-        //printf("sound buffer overflow:%d %d\n",gap, dsp_buffer_bytes);
+        waits++;
         gap = dsp_write_pos - dsp_read_pos;
     }
-    // now we copy the data into the buffer and adjust the positions
+    stats.record_frame((callbacktick != 0 ? gap_est : gap) / bytes_per_sample, waits);
+
+    // now we mix the data straight into the buffer and adjust the positions
     newpos = dsp_write_pos + bytes_written;
     if (newpos/dsp_buffer_bytes == dsp_write_pos/dsp_buffer_bytes) 
     {
         // no wrap
-        memcpy(dsp_buffer+(dsp_write_pos%dsp_buffer_bytes), mbuf8, bytes_written);
+        mix(dsp_buffer+(dsp_write_pos%dsp_buffer_bytes), 0, samples_written);
     }
     else 
     {
         // wraps
         int first_part_size = dsp_buffer_bytes - (dsp_write_pos%dsp_buffer_bytes);
-        memcpy(dsp_buffer+(dsp_write_pos%dsp_buffer_bytes), mbuf8, first_part_size);
-        memcpy(dsp_buffer, mbuf8+first_part_size, bytes_written-first_part_size);
+        mix(dsp_buffer+(dsp_write_pos%dsp_buffer_bytes), 0, first_part_size / 2);
+        mix(dsp_buffer, first_part_size / 2, (bytes_written-first_part_size) / 2);
     }
     dsp_write_pos = newpos;
 
@@ -277,9 +251,43 @@ void Audio::tick()
         dsp_write_pos -= dsp_buffer_bytes;
         dsp_read_pos -= dsp_buffer_bytes;
     }
+
+    // Periodically log buffer statistics
+    AudioStats log_stats;
+    bool log = config.sound.stats_log && ++stats_frames >= (uint32_t) (config.sound.stats_log * config.fps);
+    if (log)
+    {
+        log_stats    = stats;
+        stats_frames = 0;
+    }
+    SDL_UnlockAudio();
+
+    if (log)
+        std::cout << log_stats.to_string() << std::endl;
+}
+
+// Take a copy of the audio buffer statistics
+void Audio::get_stats(AudioStats& out)
+{
+    SDL_LockAudio();
+    out = stats;
     SDL_UnlockAudio();
 }
 
+// Mix the PCM, YM and custom music streams into a region of the output buffer
+//
+// dst:    Destination in the output buffer
+// offset: Sample offset into the sound chip buffers
+// length: Number of samples to mix
+void Audio::mix(uint8_t* dst, uint32_t offset, uint32_t length)
+{
+    int16_t* out = (int16_t*) dst;
+
+    Mixer::copy(out, osoundint.pcm->get_buffer() + offset, length, osoundint.pcm->get_gain());
+    Mixer::add (out, osoundint.ym->get_buffer()  + offset, length, osoundint.ym->get_gain());
+    wavfile.mix(out, length);
+}
+
 // Adjust the speed of the emulator, based on audio streaming performance.
 // This ensures that we avoid pops and crackles (in theory). 
 double Audio::adjust_speed()
@@ -318,85 +326,22 @@ double Audio::adjust_speed()
     return 1.0;
 }
 
-// Empty Wav Buffer
-static int16_t EMPTY_BUFFER[] = {0, 0, 0, 0};
-
+// Start streaming a custom music track.
+// The file is decoded on a background thread, so this returns immediately.
 void Audio::load_wav(const char* filename)
 {
     if (sound_enabled)
     {
         clear_wav();
 
-        // Load Wav File
-        SDL_AudioSpec wave;
-    
-        uint8_t *data;
-        uint32_t length;
-
-        pause_audio();
-
-        if( SDL_LoadWAV(filename, &wave, &data, &length) == NULL)
-        {
-            wavfile.loaded = 0;
-            resume_audio();
+        if (!wavfile.open(filename, FREQ))
             std::cout << "Could not load wav: " << filename << std::endl;
-            return;
-        }
-        
-        SDL_LockAudio();
-
-        // Halve Volume Of Wav File
-        uint8_t* data_vol = new uint8_t[length];
-	SDL_MixAudioFormat(data_vol, data, wave.format, length, SDL_MIX_MAXVOLUME / 2);
-
-        // WAV File Needs Conversion To Target Format
-        if (wave.format != AUDIO_S16 || wave.channels != 2 || wave.freq != FREQ)
-        {
-            SDL_AudioCVT cvt;
-            SDL_BuildAudioCVT(&cvt, wave.format, wave.channels, wave.freq,
-                                    AUDIO_S16,   CHANNELS,      FREQ);
-
-            cvt.buf = (uint8_t*) malloc(length*cvt.len_mult);
-            memcpy(cvt.buf, data_vol, length);
-            cvt.len = length;
-            SDL_ConvertAudio(&cvt);
-            SDL_FreeWAV(data);
-            delete[] data_vol;
-
-            wavfile.data = (int16_t*) cvt.buf;
-            wavfile.length = cvt.len_cvt / 2;
-            wavfile.pos = 0;
-            wavfile.loaded = 1;
-        }
-        // No Conversion Needed
-        else
-        {
-            SDL_FreeWAV(data);
-            wavfile.data = (int16_t*) data_vol;
-            wavfile.length = length / 2;
-            wavfile.pos = 0;
-            wavfile.loaded = 2;
-        }
-
-        resume_audio();
-        SDL_UnlockAudio();
     }
 }
 
 void Audio::clear_wav()
 {
-    if (wavfile.loaded)
-    {
-        if (wavfile.loaded == 1)
-            free(wavfile.data);
-        else
-            delete[] wavfile.data;        
-    }
-
-    wavfile.length = 1;
-    wavfile.data   = EMPTY_BUFFER;
-    wavfile.pos    = 0;
-    wavfile.loaded = false;
+    wavfile.close();
 }
 
 // SDL Audio Callback Function
@@ -450,6 +395,8 @@ void fill_audio(void *udata, Uint8 *stream, int len)
     }
     dsp_read_pos = newpos;
 
+    stats.record_callback(gap / bytes_per_sample, underflow_amount / bytes_per_sample);
+
     // Record the tick at which the callback occured.
     callbacktick = SDL_GetTicks();
 }
@@ -17,17 +17,12 @@
 #pragma once
 
 #include "globals.hpp"
+#include "wavstream.hpp"
+#include "audiostats.hpp"
 #include <SDL.h>
 
 #ifdef COMPILE_SOUND_CODE
 
-struct wav_t {
-    uint8_t loaded;
-    int16_t *data;
-    uint32_t pos;
-    uint32_t length;
-};
-
 class Audio
 {
 public:
@@ -44,6 +39,7 @@ public:
     double adjust_speed();
     void load_wav(const char* filename);
     void clear_wav();
+    void get_stats(AudioStats& out);
 
 private:
     // Sample Rate. Can't be changed easily for now, due to lack of SDL resampling.
@@ -65,10 +61,8 @@ private:
     // allowed "spread" between too many and too few samples in the buffer (ms)
     const static int SND_SPREAD = 7;
     
-    // Buffer used to mix PCM and YM channels together
-    uint16_t* mix_buffer;
-
-    wav_t wavfile;
+    // Custom music
+    WavStream wavfile;
 
     // Estimated gap
     int gap_est;
@@ -76,7 +70,11 @@ private:
     // Cumulative audio difference
     double avg_gap;
 
+    // Frames since buffer statistics were last logged
+    uint32_t stats_frames;
+
     void clear_buffers();
+    void mix(uint8_t* dst, uint32_t offset, uint32_t length);
     void pause_audio();
     void resume_audio();
 
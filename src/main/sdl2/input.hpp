@@ -34,10 +34,11 @@ public:
         STEP  = 12,
         TIMER = 13,
         MENU = 14,     
+        TURBO = 15,
     };
 
-    bool keys[15];
-    bool keys_old[15];
+    bool keys[16];
+    bool keys_old[16];
 
     // Has gamepad been found?
     bool gamepad;
@@ -28,6 +28,10 @@ protected:
     // Palette Lookup
     uint32_t rgb[S16_PALETTE_ENTRIES * 3];    // Extended to hold shadow/hilight colours
 
+    // 5-bit colour component to 8-bit, for normal and shadowed colours
+    uint8_t expand5[32];
+    uint8_t expand5_shadow[32];
+
     uint32_t *screen_pixels;
 
     // Original Screen Width & Height
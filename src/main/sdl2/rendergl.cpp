@@ -1,9 +1,13 @@
 /***************************************************************************
-    Open GL Video Rendering.
+    Open GL 3.3 Core Profile Video Rendering.
+
+    Requires OpenGL 3.3. If it isn't available, init() fails and Video
+    falls back to the SDL2 surface renderer.
 
     Useful References:
-    http://www.sdltutorials.com/sdl-opengl-tutorial-basics
     http://www.opengl.org/wiki/Common_Mistakes
+    http://www.opengl.org/wiki/Pixel_Buffer_Object
+    http://www.opengl.org/wiki/Buffer_Object_Streaming
     http://open.gl/textures
 
     Copyright Chris White.
@@ -15,11 +19,146 @@
 #include "rendergl.hpp"
 #include "frontend/config.hpp"
 
-const static uint32_t SCANLINE_TEXTURE[] = { 0x00000000, 0xff000000 }; // BGRA 8-8-8-8-REV
+// ------------------------------------------------------------------------------------------------
+// Shaders
+// ------------------------------------------------------------------------------------------------
+
+// Quad generated from the vertex index, drawn as a 4 vertex triangle strip.
+// The viewport positions it on screen.
+static const char* VERTEX_SHADER =
+    "#version 330 core\n"
+    "out vec2 tex_coord;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 pos    = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+    "    tex_coord   = vec2(pos.x, 1.0 - pos.y);\n"
+    "    gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+// Each line of the original screen fades to dark over its lower half, then back again.
+// This matches the blended 1x2 scanline texture used by the fixed function renderer.
+static const char* FRAGMENT_SHADER =
+    "#version 330 core\n"
+    "uniform sampler2D screen;\n"
+    "uniform float scanline_count;\n"
+    "uniform float scanline_strength;\n"
+    "in vec2 tex_coord;\n"
+    "out vec4 frag_colour;\n"
+    "void main()\n"
+    "{\n"
+    "    vec3 colour = texture(screen, tex_coord).rgb;\n"
+    "    float shade = abs(2.0 * fract(tex_coord.y * scanline_count + 0.25) - 1.0);\n"
+    "    frag_colour = vec4(colour * (1.0 - scanline_strength * shade), 1.0);\n"
+    "}\n";
+
+// ------------------------------------------------------------------------------------------------
+// GL 3.3 entry points. These are looked up at runtime, as system headers only guarantee GL 1.1.
+// ------------------------------------------------------------------------------------------------
+
+static PFNGLCREATESHADERPROC        pglCreateShader;
+static PFNGLSHADERSOURCEPROC        pglShaderSource;
+static PFNGLCOMPILESHADERPROC       pglCompileShader;
+static PFNGLGETSHADERIVPROC         pglGetShaderiv;
+static PFNGLGETSHADERINFOLOGPROC    pglGetShaderInfoLog;
+static PFNGLDELETESHADERPROC        pglDeleteShader;
+static PFNGLCREATEPROGRAMPROC       pglCreateProgram;
+static PFNGLATTACHSHADERPROC        pglAttachShader;
+static PFNGLLINKPROGRAMPROC         pglLinkProgram;
+static PFNGLGETPROGRAMIVPROC        pglGetProgramiv;
+static PFNGLGETPROGRAMINFOLOGPROC   pglGetProgramInfoLog;
+static PFNGLDELETEPROGRAMPROC       pglDeleteProgram;
+static PFNGLUSEPROGRAMPROC          pglUseProgram;
+static PFNGLGETUNIFORMLOCATIONPROC  pglGetUniformLocation;
+static PFNGLUNIFORM1IPROC           pglUniform1i;
+static PFNGLUNIFORM1FPROC           pglUniform1f;
+static PFNGLGENVERTEXARRAYSPROC     pglGenVertexArrays;
+static PFNGLBINDVERTEXARRAYPROC     pglBindVertexArray;
+static PFNGLDELETEVERTEXARRAYSPROC  pglDeleteVertexArrays;
+static PFNGLGENBUFFERSPROC          pglGenBuffers;
+static PFNGLDELETEBUFFERSPROC       pglDeleteBuffers;
+static PFNGLBINDBUFFERPROC          pglBindBuffer;
+static PFNGLBUFFERDATAPROC          pglBufferData;
+static PFNGLMAPBUFFERRANGEPROC      pglMapBufferRange;
+static PFNGLUNMAPBUFFERPROC         pglUnmapBuffer;
+static PFNGLFENCESYNCPROC           pglFenceSync;
+static PFNGLCLIENTWAITSYNCPROC      pglClientWaitSync;
+static PFNGLDELETESYNCPROC          pglDeleteSync;
+
+#define GL_LOAD(type, name) if (!(p##name = (type) SDL_GL_GetProcAddress(#name))) return false;
+
+static bool load_gl_functions()
+{
+    GL_LOAD(PFNGLCREATESHADERPROC,       glCreateShader);
+    GL_LOAD(PFNGLSHADERSOURCEPROC,       glShaderSource);
+    GL_LOAD(PFNGLCOMPILESHADERPROC,      glCompileShader);
+    GL_LOAD(PFNGLGETSHADERIVPROC,        glGetShaderiv);
+    GL_LOAD(PFNGLGETSHADERINFOLOGPROC,   glGetShaderInfoLog);
+    GL_LOAD(PFNGLDELETESHADERPROC,       glDeleteShader);
+    GL_LOAD(PFNGLCREATEPROGRAMPROC,      glCreateProgram);
+    GL_LOAD(PFNGLATTACHSHADERPROC,       glAttachShader);
+    GL_LOAD(PFNGLLINKPROGRAMPROC,        glLinkProgram);
+    GL_LOAD(PFNGLGETPROGRAMIVPROC,       glGetProgramiv);
+    GL_LOAD(PFNGLGETPROGRAMINFOLOGPROC,  glGetProgramInfoLog);
+    GL_LOAD(PFNGLDELETEPROGRAMPROC,      glDeleteProgram);
+    GL_LOAD(PFNGLUSEPROGRAMPROC,         glUseProgram);
+    GL_LOAD(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation);
+    GL_LOAD(PFNGLUNIFORM1IPROC,          glUniform1i);
+    GL_LOAD(PFNGLUNIFORM1FPROC,          glUniform1f);
+    GL_LOAD(PFNGLGENVERTEXARRAYSPROC,    glGenVertexArrays);
+    GL_LOAD(PFNGLBINDVERTEXARRAYPROC,    glBindVertexArray);
+    GL_LOAD(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);
+    GL_LOAD(PFNGLGENBUFFERSPROC,         glGenBuffers);
+    GL_LOAD(PFNGLDELETEBUFFERSPROC,      glDeleteBuffers);
+    GL_LOAD(PFNGLBINDBUFFERPROC,         glBindBuffer);
+    GL_LOAD(PFNGLBUFFERDATAPROC,         glBufferData);
+    GL_LOAD(PFNGLMAPBUFFERRANGEPROC,     glMapBufferRange);
+    GL_LOAD(PFNGLUNMAPBUFFERPROC,        glUnmapBuffer);
+    GL_LOAD(PFNGLFENCESYNCPROC,          glFenceSync);
+    GL_LOAD(PFNGLCLIENTWAITSYNCPROC,     glClientWaitSync);
+    GL_LOAD(PFNGLDELETESYNCPROC,         glDeleteSync);
+    return true;
+}
 
-RenderGL::RenderGL()
+#undef GL_LOAD
+
+static GLuint create_shader(GLenum type, const char* src)
 {
+    GLuint shader = pglCreateShader(type);
+    pglShaderSource(shader, 1, &src, NULL);
+    pglCompileShader(shader);
 
+    GLint compiled = 0;
+    pglGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled)
+    {
+        char log[1024];
+        pglGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        std::cerr << "Error compiling shader: " << log << std::endl;
+        pglDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Give up waiting on a pixel buffer after 100ms (in nanoseconds)
+const static GLuint64 FENCE_TIMEOUT = 100000000;
+
+RenderGL::RenderGL()
+{
+    program   = 0;
+    vao       = 0;
+    texture   = 0;
+    pbo_index = 0;
+    glcontext = NULL;
+    window    = NULL;
+
+    for (int i = 0; i < PBO_COUNT; i++)
+    {
+        pbos[i]   = 0;
+        fences[i] = NULL;
+    }
 }
 
 bool RenderGL::init(int src_width, int src_height,
@@ -83,71 +222,51 @@ bool RenderGL::init(int src_width, int src_height,
         screen_yoff = 0;
     }
 
-    //int bpp = info->vfmt->BitsPerPixel;
-    const int bpp = 32;
-
-    // Frees (Deletes) existing surface
-    if (surface)
-        SDL_FreeSurface(surface);
+    SDL_ShowCursor(SDL_DISABLE);
 
-    // Create the window and rendering context: no longer setting video mode on SDL2.
-    surface = SDL_CreateRGBSurface(0, 0, 0, 32, 0, 0, 0, 0);
-    
-    if (!surface) {
-	    std::cerr << "Can't create rendering memory surface: " << SDL_GetError() << std::endl;
-	    return false;
-    }
+    // Request a 3.3 core profile. These must be set before the window is created.
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    #ifdef __APPLE__
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_FORWARD_COMPATIBLE_FLAG);
+    #endif
 
-    SDL_ShowCursor(SDL_DISABLE);
-    
     // scn_* values will be ignored if we pass any of the FULLSCREEN flags, as expected.
     // So these are here just for the windowed modes, and ignored otherwise.
     window = SDL_CreateWindow(
         "Cannonball", 0, 0, scn_width, scn_height, 
         flags);
 
-    // I don't know if there are platforms where ES is the default profile, so just in case
-    // I force a GL2 core profile here (deprecated functions disabled for good).
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 1);
+    if (!window)
+    {
+        std::cerr << "Window creation failed: " << SDL_GetError() << std::endl;
+        return false;
+    }
 
     glcontext = SDL_GL_CreateContext(window);
 
-    if (!surface)
+    if (!glcontext)
     {
-        std::cerr << "Video mode set failed: " << SDL_GetError() << std::endl;
+        std::cerr << "OpenGL 3.3 context creation failed: " << SDL_GetError() << std::endl;
+        close_window();
         return false;
     }
 
-    if (screen_pixels)
-        delete[] screen_pixels;
-    screen_pixels = new uint32_t[src_width * src_height];
-
-    // SDL Pixel Format Information
-    Rshift = surface->format->Rshift;
-    Gshift = surface->format->Gshift;
-    Bshift = surface->format->Bshift;
+    if (!load_gl_functions())
+    {
+        std::cerr << "OpenGL 3.3 functions not found" << std::endl;
+        close_window();
+        return false;
+    }
 
-    // This hack is necessary to fix an Apple OpenGL with SDL issue
-    #ifdef __APPLE__
-      #if SDL_BYTEORDER == SDL_LIL_ENDIAN
-        Rmask = 0x000000FF;
-        Gmask = 0x0000FF00;
-        Bmask = 0x00FF0000;
-        Rshift += 8;
-        Gshift -= 8;
-        Bshift += 8;
-      #else
-        Rmask = 0xFF000000;
-        Gmask = 0x00FF0000;
-        Bmask = 0x0000FF00;
-      #endif
-    #else
-        Rmask  = surface->format->Rmask;
-        Gmask  = surface->format->Gmask;
-        Bmask  = surface->format->Bmask;
-    #endif
+    // The texture is uploaded as BGRA 8-8-8-8-REV, which is a packed 0xAARRGGBB word on all platforms
+    Rshift = 16;
+    Gshift = 8;
+    Bshift = 0;
+    Rmask  = 0x00FF0000;
+    Gmask  = 0x0000FF00;
+    Bmask  = 0x000000FF;
 
     // --------------------------------------------------------------------------------------------
     // Initalize Open GL
@@ -155,23 +274,21 @@ bool RenderGL::init(int src_width, int src_height,
 
     // Disable dithering
     glDisable(GL_DITHER);
-    // Disable anti-aliasing
-    glDisable(GL_LINE_SMOOTH);
-    glDisable(GL_POINT_SMOOTH);
     // Disable depth buffer
     glDisable(GL_DEPTH_TEST);
 
     glClearColor(0, 0, 0, 0); // Black background
-    glShadeModel(GL_FLAT);
 
-    glViewport(0, 0, scn_width, scn_height);
+    // The quad fills the viewport, so position the viewport where the image should be drawn
+    glViewport(screen_xoff, screen_yoff, dst_width, dst_height);
 
-    // Initalize Texture ID
-    glGenTextures(scanlines ? 2 : 1, textures);
+    if (!init_shaders())
+        return false;
 
     // Screen Texture Setup
     const GLint param = config.video.filtering ? GL_LINEAR : GL_NEAREST;
-    glBindTexture(GL_TEXTURE_2D, textures[SCREEN]);
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, param);
@@ -181,106 +298,167 @@ bool RenderGL::init(int src_width, int src_height,
                 GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,    // Data format in pixel array
                 NULL);
 
-    // Scanline Texture Setup
-    if (scanlines)
+    // Pixel Buffer Setup
+    pglGenBuffers(PBO_COUNT, pbos);
+    for (int i = 0; i < PBO_COUNT; i++)
     {
-        glBindTexture(GL_TEXTURE_2D, textures[SCANLN]);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
-                     1, 2, 0,
-                     GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
-                     SCANLINE_TEXTURE);
+        pglBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbos[i]);
+        pglBufferData(GL_PIXEL_UNPACK_BUFFER, src_width * src_height * sizeof(uint32_t), NULL, GL_STREAM_DRAW);
+        fences[i] = NULL;
     }
+    pglBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    pbo_index = 0;
 
-    // Initalize D-List
-    dlist = glGenLists(1);
-    glNewList(dlist, GL_COMPILE);
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity();
-    glOrtho(0, scn_width, scn_height, 0, 0, 1);         // left, right, bottom, top, near, far
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // clear screen and depth buffer
-    glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, textures[SCREEN]);     // Select Screen Texture
-        glBegin(GL_QUADS);
-            glTexCoord2i(0, 1);
-            glVertex2i  (screen_xoff,             screen_yoff + dst_height);  // lower left
-            glTexCoord2i(0, 0);
-            glVertex2i  (screen_xoff,             screen_yoff);               // upper left
-            glTexCoord2i(1, 0);
-            glVertex2i  (screen_xoff + dst_width, screen_yoff);               // upper right
-            glTexCoord2i(1, 1);
-            glVertex2i  (screen_xoff + dst_width, screen_yoff + dst_height);  // lower right
-        glEnd();
-
-        if (scanlines)
-        {
-            glEnable(GL_BLEND);
-                glColor4ub(255, 255, 255, ((scanlines - 1) << 8) / 100);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glBindTexture(GL_TEXTURE_2D, textures[SCANLN]);
-                glBegin(GL_QUADS);
-                    glTexCoord2i(0, S16_HEIGHT);
-                    glVertex2i  (screen_xoff,             screen_yoff + dst_height);  // lower left
-                    glTexCoord2i(0, 0);
-                    glVertex2i  (screen_xoff,             screen_yoff);               // upper left
-                    glTexCoord2i(src_width, 0);
-                    glVertex2i  (screen_xoff + dst_width, screen_yoff);               // upper right
-                    glTexCoord2i(src_width, S16_HEIGHT);
-                    glVertex2i  (screen_xoff + dst_width, screen_yoff + dst_height);  // lower right
-                glEnd();
-            glDisable(GL_BLEND);
-        }
-    glDisable(GL_TEXTURE_2D);
-    glPopMatrix();
-    glEndList();
+    // Core profile requires a vertex array to be bound, even with no vertex attributes
+    pglGenVertexArrays(1, &vao);
+    pglBindVertexArray(vao);
+
+    // The program, texture and vertex array are left bound for draw_frame()
+    return true;
+}
+
+bool RenderGL::init_shaders()
+{
+    GLuint vertex_shader   = create_shader(GL_VERTEX_SHADER,   VERTEX_SHADER);
+    GLuint fragment_shader = create_shader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
+
+    if (!vertex_shader || !fragment_shader)
+        return false;
+
+    program = pglCreateProgram();
+    pglAttachShader(program, vertex_shader);
+    pglAttachShader(program, fragment_shader);
+    pglLinkProgram(program);
+
+    // The program keeps the shaders alive while they're attached
+    pglDeleteShader(vertex_shader);
+    pglDeleteShader(fragment_shader);
+
+    GLint linked = 0;
+    pglGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked)
+    {
+        char log[1024];
+        pglGetProgramInfoLog(program, sizeof(log), NULL, log);
+        std::cerr << "Error linking shader program: " << log << std::endl;
+        return false;
+    }
+
+    pglUseProgram(program);
+    pglUniform1i(pglGetUniformLocation(program, "screen"), 0);
+
+    // One scanline per line of the original System 16 screen, regardless of hi-res mode
+    pglUniform1f(pglGetUniformLocation(program, "scanline_count"), (GLfloat) S16_HEIGHT);
+    pglUniform1f(pglGetUniformLocation(program, "scanline_strength"), 
+                 scanlines ? (((scanlines - 1) << 8) / 100) / 255.0f : 0.0f);
 
     return true;
 }
 
 void RenderGL::disable()
 {
-    glDeleteLists(dlist, 1);
-    glDeleteTextures(scanlines ? 2 : 1, textures);
+    for (int i = 0; i < PBO_COUNT; i++)
+    {
+        if (fences[i])
+        {
+            pglDeleteSync(fences[i]);
+            fences[i] = NULL;
+        }
+    }
+
+    if (pbos[0])
+        pglDeleteBuffers(PBO_COUNT, pbos);
+    if (vao)
+        pglDeleteVertexArrays(1, &vao);
+    if (program)
+        pglDeleteProgram(program);
+    glDeleteTextures(1, &texture);
+
+    for (int i = 0; i < PBO_COUNT; i++)
+        pbos[i] = 0;
+    vao = program = texture = 0;
 
     // Deinit SDL2 GL context
     SDL_DestroyWindow(window);
     SDL_GL_DeleteContext(glcontext); 
 }
 
+// Undo a failed init, so another renderer can create the window instead
+void RenderGL::close_window()
+{
+    if (glcontext)
+        SDL_GL_DeleteContext(glcontext);
+    if (window)
+        SDL_DestroyWindow(window);
+
+    glcontext = NULL;
+    window    = NULL;
+
+    // Don't leave the core profile request behind for SDL's own renderers
+    SDL_GL_ResetAttributes();
+}
+
 bool RenderGL::start_frame()
 {
-    return !(SDL_MUSTLOCK(surface) && SDL_LockSurface(surface) < 0);
+    return true;
 }
 
 bool RenderGL::finalize_frame()
 {
-    if (SDL_MUSTLOCK(surface))
-        SDL_UnlockSurface(surface);
-
     return true;
 }
 
 void RenderGL::draw_frame(uint16_t* pixels)
 {
-    uint32_t* spix = screen_pixels;
+    const GLsizeiptr size = src_width * src_height * sizeof(uint32_t);
+
+    // Move to the next buffer in the ring. The GPU has normally finished uploading from it 
+    // already, as it was last used PBO_COUNT frames ago.
+    pbo_index = (pbo_index + 1) % PBO_COUNT;
 
-    // Lookup real RGB value from rgb array for backbuffer
-    for (int i = 0; i < (src_width * src_height); i++)
-        *(spix++) = rgb[*(pixels++) & ((S16_PALETTE_ENTRIES * 3) - 1)];
+    // Unused buffers are idle
+    bool idle = true;
+
+    if (fences[pbo_index])
+    {
+        GLenum result = pglClientWaitSync(fences[pbo_index], GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+        idle = result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+        pglDeleteSync(fences[pbo_index]);
+        fences[pbo_index] = NULL;
+    }
+
+    // Once the fence has signalled the buffer is idle, so map it without the driver synchronizing.
+    // If the wait timed out or failed, the GPU may still be reading it, so let the driver synchronize.
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+    if (idle)
+        access |= GL_MAP_UNSYNCHRONIZED_BIT;
+
+    pglBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbos[pbo_index]);
+    uint32_t* spix = (uint32_t*) pglMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, access);
+
+    if (spix)
+    {
+        // Lookup real RGB value from rgb array for backbuffer
+        for (int i = 0; i < (src_width * src_height); i++)
+            *(spix++) = rgb[*(pixels++) & ((S16_PALETTE_ENTRIES * 3) - 1)];
+
+        if (pglUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+        {
+            // With a bound pixel buffer, the upload is queued and the final argument is an offset
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0,            // target, LOD, xoff, yoff
+                    src_width, src_height,                     // texture width, texture height
+                    GL_BGRA,                                   // format of pixel data
+                    GL_UNSIGNED_INT_8_8_8_8_REV,               // data type of pixel data
+                    NULL);                                     // offset in pixel buffer
+
+            fences[pbo_index] = pglFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+    }
 
-    glBindTexture(GL_TEXTURE_2D, textures[SCREEN]);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0,            // target, LOD, xoff, yoff
-            src_width, src_height,                     // texture width, texture height
-            GL_BGRA,                                   // format of pixel data
-            GL_UNSIGNED_INT_8_8_8_8_REV,               // data type of pixel data
-            screen_pixels);                            // pointer in image memory
+    pglBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
-    glCallList(dlist);
-    //glFinish();
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 
     SDL_GL_SwapWindow(window);
 }
@@ -1,9 +1,17 @@
 /***************************************************************************
-    Open GL Video Rendering.  
+    Open GL 3.3 Core Profile Video Rendering.  
+
+    Frames are converted straight into a ring of pixel buffer objects and
+    uploaded to the screen texture asynchronously. Scanlines are applied 
+    in the fragment shader.
+
+    Requires OpenGL 3.3. If it isn't available, init() fails and Video
+    falls back to the SDL2 surface renderer.
     
     Useful References:
-    http://www.sdltutorials.com/sdl-opengl-tutorial-basics
     http://www.opengl.org/wiki/Common_Mistakes
+    http://www.opengl.org/wiki/Pixel_Buffer_Object
+    http://www.opengl.org/wiki/Buffer_Object_Streaming
     http://open.gl/textures
 
     Copyright Chris White.
@@ -31,13 +39,19 @@ public:
     void draw_frame(uint16_t* pixels);
 
 private:
-    // Texture IDs
-    const static int SCREEN = 0;
-    const static int SCANLN = 1;
+    // Pixel buffers in the upload ring. Each is reused every PBO_COUNT frames.
+    const static int PBO_COUNT = 3;
 
-    GLuint textures[2];
-    GLuint dlist; // GL display list
+    GLuint program;
+    GLuint vao;                 // Empty vertex array: the quad is generated in the vertex shader
+    GLuint texture;
+    GLuint pbos[PBO_COUNT];
+    GLsync fences[PBO_COUNT];   // Signalled once the GPU has finished uploading from each buffer
+    int pbo_index;
 
     SDL_GLContext glcontext;
     SDL_Window *window;
+
+    bool init_shaders();
+    void close_window();
 };
@@ -105,28 +105,6 @@ bool RenderSurface::init(int src_width, int src_height,
         SDL_ShowCursor(true);
     }
 
-    //int bpp = info->vfmt->BitsPerPixel;
-    const int bpp = 32;
-
-    // Frees (Deletes) existing surface
-    if (surface)
-        SDL_FreeSurface(surface);
-
-    surface = SDL_CreateRGBSurface(0,
-                                  src_width,
-                                  src_height,
-                                  bpp,
-                                  0,
-                                  0,
-                                  0,
-                                  0);
-
-    if (!surface)
-    {
-        std::cerr << "Surface creation failed: " << SDL_GetError() << std::endl;
-        return false;
-    }
-
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear"); 
     window = SDL_CreateWindow(
         "Cannonball", 0, 0, scn_width, scn_height, 
@@ -138,17 +116,20 @@ bool RenderSurface::init(int src_width, int src_height,
                                SDL_TEXTUREACCESS_STREAMING,
                                src_width, src_height);
 
-    // Convert the SDL pixel surface to 32 bit.
-    // This is potentially a larger surface area than the internal pixel array.
-    screen_pixels = (uint32_t*)surface->pixels;
-    
-    // SDL Pixel Format Information
-    Rshift = surface->format->Rshift;
-    Gshift = surface->format->Gshift;
-    Bshift = surface->format->Bshift;
-    Rmask  = surface->format->Rmask;
-    Gmask  = surface->format->Gmask;
-    Bmask  = surface->format->Bmask;
+    if (!texture)
+    {
+        std::cerr << "Texture creation failed: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    // The palette is converted straight into the locked texture, so use the texture's pixel format.
+    // ARGB8888 is a packed format: the shifts are the same on all platforms.
+    Rshift = 16;
+    Gshift = 8;
+    Bshift = 0;
+    Rmask  = 0x00FF0000;
+    Gmask  = 0x0000FF00;
+    Bmask  = 0x000000FF;
 
     return true;
 }
@@ -162,13 +143,19 @@ void RenderSurface::disable()
 
 bool RenderSurface::start_frame()
 {
+    // Lock the streaming texture. draw_frame() writes into it directly.
+    void* pixels;
+    if (SDL_LockTexture(texture, NULL, &pixels, &texture_pitch) < 0)
+        return false;
+
+    screen_pixels = (uint32_t*) pixels;
     return true;
 }
 
 bool RenderSurface::finalize_frame()
 {
     // SDL2 block
-    SDL_UpdateTexture(texture, NULL, screen_pixels, src_width * sizeof (Uint32));
+    SDL_UnlockTexture(texture);
     SDL_RenderClear(renderer);
     SDL_RenderCopy(renderer, texture, &src_rect, &dst_rect);
     SDL_RenderPresent(renderer);
@@ -179,9 +166,15 @@ bool RenderSurface::finalize_frame()
 
 void RenderSurface::draw_frame(uint16_t* pixels)
 {
-    uint32_t* spix = screen_pixels;
+    // Texture rows may be padded, so step by the pitch returned from SDL_LockTexture()
+    const int pitch = texture_pitch / sizeof(uint32_t);
+    uint32_t* row   = screen_pixels;
 
     // Lookup real RGB value from rgb array for backbuffer
-    for (int i = 0; i < (src_width * src_height); i++)
-	*(spix++) = rgb[*(pixels++) & ((S16_PALETTE_ENTRIES * 3) - 1)];
-}
+    for (int y = 0; y < src_height; y++, row += pitch)
+    {
+        uint32_t* spix = row;
+        for (int x = 0; x < src_width; x++)
+            *(spix++) = rgb[*(pixels++) & ((S16_PALETTE_ENTRIES * 3) - 1)];
+    }
+}
\ No newline at end of file
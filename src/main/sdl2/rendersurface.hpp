@@ -38,6 +38,9 @@ private:
     // SDL2 texture
     SDL_Texture *texture;
 
+    // Row pitch of the locked texture in bytes
+    int texture_pitch;
+
     // SDL2 blitting rects for hw scaling 
     // ratio correction using SDL_RenderCopy()
     SDL_Rect src_rect;
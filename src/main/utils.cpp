@@ -6,6 +6,7 @@
 ***************************************************************************/
 
 #include <sstream>
+#include <cstring>
 #include "utils.hpp"
 
 // Convert value to string
@@ -42,4 +43,13 @@ uint32_t Utils::from_hex_string(std::string s)
     ss >> x;
     // output it as a signed type
     return static_cast<unsigned int>(x);
-}
\ No newline at end of file
+}
+
+bool Utils::update_copy(void* copy, const void* src, uint32_t size)
+{
+    if (memcmp(copy, src, size) == 0)
+        return false;
+
+    memcpy(copy, src, size);
+    return true;
+}
@@ -10,6 +10,10 @@
 #include <string>
 #include "stdint.hpp"
 
+#ifdef _MSC_VER
+#include <intrin.h> // _BitScanForward
+#endif
+
 class Utils
 {
 public:
@@ -18,5 +22,28 @@ public:
     static std::string to_hex_string(int i);
     static uint32_t from_hex_string(std::string s);
 
+    // Bring a copy of a block of memory up to date. Returns true if it was out of date.
+    static bool update_copy(void* copy, const void* src, uint32_t size);
+
+    // Index of the lowest set bit. Value must be non-zero.
+    static inline uint8_t find_first_set(uint32_t value)
+    {
+    #if defined(__GNUC__)
+        return __builtin_ctz(value);
+    #elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, value);
+        return (uint8_t) index;
+    #else
+        uint8_t index = 0;
+        while (!(value & 1))
+        {
+            value >>= 1;
+            index++;
+        }
+        return index;
+    #endif
+    }
+
 private:
 };
\ No newline at end of file
@@ -10,16 +10,21 @@
 ***************************************************************************/
 
 #include <iostream>
+#include <cstring>
 
 #include "video.hpp"
+#include "gfxcache.hpp"
+#include "enginesnapshot.hpp"
 #include "setup.hpp"
 #include "globals.hpp"
+#include "utils.hpp"
 #include "frontend/config.hpp"
 
 #ifdef WITH_OPENGL
 
 #if defined SDL2
 #include "sdl2/rendergl.hpp"
+#include "sdl2/rendersurface.hpp" // Fallback when OpenGL 3.3 is unavailable
 #else
 #include "sdl/rendergl.hpp"
 #endif
@@ -60,6 +65,10 @@ Video::Video(void)
     pixels       = NULL;
     sprite_layer = new hwsprites();
     tile_layer   = new hwtiles();
+    static_frame = false;
+    last_enabled = false;
+    redraw       = true;
+    memset(last_palette, 0, sizeof(last_palette));
 }
 
 Video::~Video(void)
@@ -80,27 +89,38 @@ int Video::init(Roms* roms, video_settings_t* settings)
     if (pixels) delete[] pixels;
     pixels = new uint16_t[config.s16_width * config.s16_height];
 
+    // Converted graphics from a previous boot, if the roms are unchanged
+    GfxCache cache;
+    const bool have_roms = roms->tiles.rom && roms->sprites.rom && roms->road.rom;
+    const bool cached    = have_roms && cache.load(FILENAME_GFXCACHE, roms, tile_layer, sprite_layer, &hwroad);
+
     // Convert S16 tiles to a more useable format
-    tile_layer->init(roms->tiles.rom, config.video.hires != 0);
+    tile_layer->init(cached ? NULL : roms->tiles.rom, config.video.hires != 0);
     
     clear_tile_ram();
     clear_text_ram();
+
+    // Convert S16 sprites
+    sprite_layer->init(cached ? NULL : roms->sprites.rom);
+
+    // Convert S16 Road Stuff
+    hwroad.init(cached ? NULL : roms->road.rom);
+
+    if (have_roms && !cached)
+        cache.save(FILENAME_GFXCACHE, roms, tile_layer, sprite_layer, &hwroad);
+
     if (roms->tiles.rom)
     {
         delete[] roms->tiles.rom;
         roms->tiles.rom = NULL;
     }
 
-    // Convert S16 sprites
-    sprite_layer->init(roms->sprites.rom);
     if (roms->sprites.rom)
     {
         delete[] roms->sprites.rom;
         roms->sprites.rom = NULL;
     }
 
-    // Convert S16 Road Stuff
-    hwroad.init(roms->road.rom, config.video.hires != 0);
     if (roms->road.rom)
     {
         delete[] roms->road.rom;
@@ -116,6 +136,16 @@ void Video::disable()
     renderer->disable();
 }
 
+// Register video RAM with an engine snapshot.
+// The palette is copied separately with get_palette() and set_palette(), so the renderer only
+// converts the entries that differ.
+void Video::register_state(EngineSnapshot& snapshot)
+{
+    tile_layer->register_state(snapshot);
+    sprite_layer->register_state(snapshot);
+    hwroad.register_state(snapshot);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Configure video settings from config file
 // ------------------------------------------------------------------------------------------------
@@ -148,16 +178,41 @@ int Video::set_video_mode(video_settings_t* settings)
     if (settings->scale < 1)
         settings->scale = 1;
 
+    #if defined WITH_OPENGL && defined SDL2
+    // If OpenGL 3.3 isn't available, use the SDL2 surface renderer instead
+    if (!renderer->init(config.s16_width, config.s16_height, settings->scale, settings->mode, settings->scanlines))
+    {
+        std::cerr << "Falling back to the SDL2 surface renderer" << std::endl;
+        delete renderer;
+        renderer = new RenderSurface();
+
+        if (!renderer->init(config.s16_width, config.s16_height, settings->scale, settings->mode, settings->scanlines))
+            return 0;
+    }
+    #else
     renderer->init(config.s16_width, config.s16_height, settings->scale, settings->mode, settings->scanlines);
+    #endif
+
+    // Pixel format may have changed, so convert the whole palette again
+    mark_palette_all();
+    redraw = true;
 
     return 1;
 }
 
 void Video::draw_frame()
 {
+    // Static screens, menus and pause: Nothing to compose, convert or upload
+    static_frame = !frame_changed();
+    if (static_frame)
+        return;
+
     // Renderer Specific Frame Setup
     if (!renderer->start_frame())
+    {
+        redraw = true;
         return;
+    }
 
     if (!enabled)
     {
@@ -170,68 +225,100 @@ void Video::draw_frame()
         // OutRun Hardware Video Emulation
         tile_layer->update_tile_values();
 
+        // Scanlines filled by the road foreground are skipped by the earlier layers
+        hwroad.update_coverage();
+
         (hwroad.*hwroad.render_background)(pixels);
-        tile_layer->render_tile_layer(pixels, 1, 0);      // background layer
-        tile_layer->render_tile_layer(pixels, 0, 0);      // foreground layer
+        tile_layer->render_tile_layer(pixels, 1, 0, hwroad.coverage); // background layer
+        tile_layer->render_tile_layer(pixels, 0, 0, hwroad.coverage); // foreground layer
         (hwroad.*hwroad.render_foreground)(pixels);
         sprite_layer->render(8);
         tile_layer->render_text_layer(pixels, 1);
      }
 
+    flush_palette();
     renderer->draw_frame(pixels);
     renderer->finalize_frame();
 }
 
+void Video::force_redraw()
+{
+    redraw = true;
+}
+
+// Compare everything a frame is composed from with the last composed frame.
+// Comparing the video RAM with a copy is far cheaper than composing, converting and uploading a frame.
+bool Video::frame_changed()
+{
+    bool changed = redraw;
+    redraw = false;
+
+    // Every copy is brought up to date, so don't stop at the first difference
+    changed |= Utils::update_copy(&last_enabled, &enabled, sizeof(enabled));
+    changed |= Utils::update_copy(last_palette, palette, sizeof(palette));
+    changed |= tile_layer->changed();
+    changed |= sprite_layer->changed();
+    changed |= hwroad.changed();
+    return changed;
+}
+
 // ---------------------------------------------------------------------------
 // Text Handling Code
 // ---------------------------------------------------------------------------
 
+// Text and Tile RAM are stored as native-endian words. 
+// Byte accesses select the high byte of a word for even addresses, as on the 68000.
+
 void Video::clear_text_ram()
 {
-    for (uint32_t i = 0; i <= 0xFFF; i++)
-        tile_layer->text_ram[i] = 0;
+    fill_text16(0, 0, 0x800);
 }
 
 void Video::write_text8(uint32_t addr, const uint8_t data)
 {
-    tile_layer->text_ram[addr & 0xFFF] = data;
+    uint16_t* word = &tile_layer->text_ram[(addr & 0xFFF) >> 1];
+    if (addr & 1)
+        *word = (*word & 0xFF00) | data;
+    else
+        *word = (*word & 0x00FF) | (data << 8);
 }
 
 void Video::write_text16(uint32_t* addr, const uint16_t data)
 {
-    tile_layer->text_ram[*addr & 0xFFF] = (data >> 8) & 0xFF;
-    tile_layer->text_ram[(*addr+1) & 0xFFF] = data & 0xFF;
-
+    tile_layer->text_ram[(*addr & 0xFFF) >> 1] = data;
     *addr += 2;
 }
 
 void Video::write_text16(uint32_t addr, const uint16_t data)
 {
-    tile_layer->text_ram[addr & 0xFFF] = (data >> 8) & 0xFF;
-    tile_layer->text_ram[(addr+1) & 0xFFF] = data & 0xFF;
+    tile_layer->text_ram[(addr & 0xFFF) >> 1] = data;
 }
 
 void Video::write_text32(uint32_t* addr, const uint32_t data)
 {
-    tile_layer->text_ram[*addr & 0xFFF] = (data >> 24) & 0xFF;
-    tile_layer->text_ram[(*addr+1) & 0xFFF] = (data >> 16) & 0xFF;
-    tile_layer->text_ram[(*addr+2) & 0xFFF] = (data >> 8) & 0xFF;
-    tile_layer->text_ram[(*addr+3) & 0xFFF] = data & 0xFF;
-
+    tile_layer->text_ram[(*addr & 0xFFF) >> 1]       = data >> 16;
+    tile_layer->text_ram[((*addr + 2) & 0xFFF) >> 1] = data & 0xFFFF;
     *addr += 4;
 }
 
 void Video::write_text32(uint32_t addr, const uint32_t data)
 {
-    tile_layer->text_ram[addr & 0xFFF] = (data >> 24) & 0xFF;
-    tile_layer->text_ram[(addr+1) & 0xFFF] = (data >> 16) & 0xFF;
-    tile_layer->text_ram[(addr+2) & 0xFFF] = (data >> 8) & 0xFF;
-    tile_layer->text_ram[(addr+3) & 0xFFF] = data & 0xFF;
+    tile_layer->text_ram[(addr & 0xFFF) >> 1]       = data >> 16;
+    tile_layer->text_ram[((addr + 2) & 0xFFF) >> 1] = data & 0xFFFF;
 }
 
 uint8_t Video::read_text8(uint32_t addr)
 {
-    return tile_layer->text_ram[addr & 0xFFF];
+    uint16_t word = tile_layer->text_ram[(addr & 0xFFF) >> 1];
+    return (addr & 1) ? word & 0xFF : word >> 8;
+}
+
+// Fill a number of words of Text RAM with the same value
+void Video::fill_text16(uint32_t addr, const uint16_t data, const uint32_t count)
+{
+    uint32_t index = (addr & 0xFFF) >> 1;
+    for (uint32_t i = 0; i < count; i++)
+        tile_layer->text_ram[(index + i) & 0x7FF] = data;
 }
 
 // ---------------------------------------------------------------------------
@@ -240,52 +327,66 @@ uint8_t Video::read_text8(uint32_t addr)
 
 void Video::clear_tile_ram()
 {
-    for (uint32_t i = 0; i <= 0xFFFF; i++)
-        tile_layer->tile_ram[i] = 0;
+    fill_tile16(0, 0, 0x8000);
 }
 
 void Video::write_tile8(uint32_t addr, const uint8_t data)
 {
-    tile_layer->tile_ram[addr & 0xFFFF] = data;
+    uint16_t* word = &tile_layer->tile_ram[(addr & 0xFFFF) >> 1];
+    if (addr & 1)
+        *word = (*word & 0xFF00) | data;
+    else
+        *word = (*word & 0x00FF) | (data << 8);
 } 
 
 void Video::write_tile16(uint32_t* addr, const uint16_t data)
 {
-    tile_layer->tile_ram[*addr & 0xFFFF] = (data >> 8) & 0xFF;
-    tile_layer->tile_ram[(*addr+1) & 0xFFFF] = data & 0xFF;
-
+    tile_layer->tile_ram[(*addr & 0xFFFF) >> 1] = data;
     *addr += 2;
 }
 
 void Video::write_tile16(uint32_t addr, const uint16_t data)
 {
-    tile_layer->tile_ram[addr & 0xFFFF] = (data >> 8) & 0xFF;
-    tile_layer->tile_ram[(addr+1) & 0xFFFF] = data & 0xFF;
+    tile_layer->tile_ram[(addr & 0xFFFF) >> 1] = data;
 }   
 
 void Video::write_tile32(uint32_t* addr, const uint32_t data)
 {
-    tile_layer->tile_ram[*addr & 0xFFFF] = (data >> 24) & 0xFF;
-    tile_layer->tile_ram[(*addr+1) & 0xFFFF] = (data >> 16) & 0xFF;
-    tile_layer->tile_ram[(*addr+2) & 0xFFFF] = (data >> 8) & 0xFF;
-    tile_layer->tile_ram[(*addr+3) & 0xFFFF] = data & 0xFF;
-
+    tile_layer->tile_ram[(*addr & 0xFFFF) >> 1]       = data >> 16;
+    tile_layer->tile_ram[((*addr + 2) & 0xFFFF) >> 1] = data & 0xFFFF;
     *addr += 4;
 }
 
 void Video::write_tile32(uint32_t addr, const uint32_t data)
 {
-    tile_layer->tile_ram[addr & 0xFFFF] = (data >> 24) & 0xFF;
-    tile_layer->tile_ram[(addr+1) & 0xFFFF] = (data >> 16) & 0xFF;
-    tile_layer->tile_ram[(addr+2) & 0xFFFF] = (data >> 8) & 0xFF;
-    tile_layer->tile_ram[(addr+3) & 0xFFFF] = data & 0xFF;
+    tile_layer->tile_ram[(addr & 0xFFFF) >> 1]       = data >> 16;
+    tile_layer->tile_ram[((addr + 2) & 0xFFFF) >> 1] = data & 0xFFFF;
 }
 
 uint8_t Video::read_tile8(uint32_t addr)
 {
-    return tile_layer->tile_ram[addr & 0xFFFF];
+    uint16_t word = tile_layer->tile_ram[(addr & 0xFFFF) >> 1];
+    return (addr & 1) ? word & 0xFF : word >> 8;
 }
 
+// Fill a number of words of Tile RAM with the same value
+void Video::fill_tile16(uint32_t addr, const uint16_t data, const uint32_t count)
+{
+    uint32_t index = (addr & 0xFFFF) >> 1;
+    for (uint32_t i = 0; i < count; i++)
+        tile_layer->tile_ram[(index + i) & 0x7FFF] = data;
+}
+
+// Fill a number of longs of Tile RAM with the same value
+void Video::fill_tile32(uint32_t addr, const uint32_t data, const uint32_t count)
+{
+    uint32_t index = (addr & 0xFFFF) >> 1;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        tile_layer->tile_ram[index++ & 0x7FFF] = data >> 16;
+        tile_layer->tile_ram[index++ & 0x7FFF] = data & 0xFFFF;
+    }
+}
 
 // ---------------------------------------------------------------------------
 // Sprite Handling Code
@@ -303,77 +404,137 @@ void Video::write_sprite16(uint32_t* addr, const uint16_t data)
 
 void Video::write_pal8(uint32_t* palAddr, const uint8_t data)
 {
-    palette[*palAddr & 0x1fff] = data;
-    refresh_palette(*palAddr & 0x1fff);
+    uint32_t adr = *palAddr & 0x1fff;
+    uint16_t* word = &palette[adr >> 1];
+    if (adr & 1)
+        *word = (*word & 0xFF00) | data;
+    else
+        *word = (*word & 0x00FF) | (data << 8);
+    mark_palette(adr);
     *palAddr += 1;
 }
 
 void Video::write_pal16(uint32_t* palAddr, const uint16_t data)
 {    
     uint32_t adr = *palAddr & 0x1fff;
-    palette[adr]   = (data >> 8) & 0xFF;
-    palette[adr+1] = data & 0xFF;
-    refresh_palette(adr);
+    palette[adr >> 1] = data;
+    mark_palette(adr);
     *palAddr += 2;
 }
 
 void Video::write_pal32(uint32_t* palAddr, const uint32_t data)
 {    
-    uint32_t adr = *palAddr & 0x1fff;
-
-    palette[adr]   = (data >> 24) & 0xFF;
-    palette[adr+1] = (data >> 16) & 0xFF;
-    palette[adr+2] = (data >> 8) & 0xFF;
-    palette[adr+3] = data & 0xFF;
-
-    refresh_palette(adr);
-    refresh_palette(adr+2);
-
+    write_pal32(*palAddr, data);
     *palAddr += 4;
 }
 
 void Video::write_pal32(uint32_t adr, const uint32_t data)
 {    
     adr &= 0x1fff;
+    palette[adr >> 1]                  = data >> 16;
+    palette[((adr + 2) & 0x1fff) >> 1] = data & 0xFFFF;
+    mark_palette(adr);
+    mark_palette(adr + 2);
+}
 
-    palette[adr]   = (data >> 24) & 0xFF;
-    palette[adr+1] = (data >> 16) & 0xFF;
-    palette[adr+2] = (data >> 8) & 0xFF;
-    palette[adr+3] = data & 0xFF;
-    refresh_palette(adr);
-    refresh_palette(adr+2);
+// Copy a number of words from ROM to Palette RAM.
+void Video::copy_pal_rom(uint32_t adr, RomLoader* rom, uint32_t src, const uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        adr &= 0x1fff;
+        palette[adr >> 1] = rom->read16_aligned(src);
+        mark_palette(adr);
+        adr += 2;
+        src += 2;
+    }
 }
 
 uint8_t Video::read_pal8(uint32_t palAddr)
 {
-    return palette[palAddr & 0x1fff];
+    uint16_t word = palette[(palAddr & 0x1fff) >> 1];
+    return (palAddr & 1) ? word & 0xFF : word >> 8;
 }
 
 uint16_t Video::read_pal16(uint32_t palAddr)
 {
-    uint32_t adr = palAddr & 0x1fff;
-    return (palette[adr] << 8) | palette[adr+1];
+    return palette[(palAddr & 0x1fff) >> 1];
 }
 
 uint16_t Video::read_pal16(uint32_t* palAddr)
 {
     uint32_t adr = *palAddr & 0x1fff;
     *palAddr += 2;
-    return (palette[adr] << 8)| palette[adr+1];
+    return palette[adr >> 1];
 }
 
 uint32_t Video::read_pal32(uint32_t* palAddr)
 {
     uint32_t adr = *palAddr & 0x1fff;
     *palAddr += 4;
-    return (palette[adr] << 24) | (palette[adr+1] << 16) | (palette[adr+2] << 8) | palette[adr+3];
+    return ((uint32_t) palette[adr >> 1] << 16) | palette[((adr + 2) & 0x1fff) >> 1];
+}
+
+// Palette writes only flag the entry as changed. 
+// Changed entries are converted in one pass before the frame is drawn, 
+// so an entry written several times in a frame (e.g. during fades) is only converted once.
+void Video::mark_palette(uint32_t palAddr)
+{
+    const uint32_t entry = (palAddr & 0x1ffe) >> 1;
+    pal_dirty[entry >> 5] |= 1 << (entry & 31);
+    shadow_bank[entry] = (S16_PALETTE_ENTRIES * 2) - ((palette[entry] & 0x8000) >> 3);
+}
+
+void Video::get_palette(uint16_t* dst)
+{
+    memcpy(dst, palette, sizeof(palette));
+}
+
+void Video::set_palette(const uint16_t* src)
+{
+    for (uint32_t i = 0; i < S16_PALETTE_ENTRIES; i++)
+    {
+        if (palette[i] != src[i])
+        {
+            palette[i] = src[i];
+            mark_palette(i << 1);
+        }
+    }
+}
+
+void Video::mark_palette_all()
+{
+    for (uint32_t i = 0; i < S16_PALETTE_ENTRIES / 32; i++)
+        pal_dirty[i] = 0xFFFFFFFF;
+
+    for (uint32_t i = 0; i < S16_PALETTE_ENTRIES; i++)
+        shadow_bank[i] = (S16_PALETTE_ENTRIES * 2) - ((palette[i] & 0x8000) >> 3);
+}
+
+void Video::flush_palette()
+{
+    for (uint32_t i = 0; i < S16_PALETTE_ENTRIES / 32; i++)
+    {
+        uint32_t dirty = pal_dirty[i];
+        if (!dirty)
+            continue;
+
+        pal_dirty[i] = 0;
+
+        do
+        {
+            refresh_palette(((i << 5) + Utils::find_first_set(dirty)) << 1);
+            dirty &= dirty - 1;
+        }
+        while (dirty);
+    }
 }
 
 // Convert internal System 16 RRRR GGGG BBBB format palette to renderer output format
 void Video::refresh_palette(uint32_t palAddr)
 {
-    palAddr &= ~1;
-    uint32_t a = (palette[palAddr] << 8) | palette[palAddr + 1];
+    palAddr &= 0x1ffe;
+    uint32_t a = palette[palAddr >> 1];
     uint32_t r = (a & 0x000f) << 1; // r rrr0
     uint32_t g = (a & 0x00f0) >> 3; // g ggg0
     uint32_t b = (a & 0x0f00) >> 7; // b bbb0
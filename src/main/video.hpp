@@ -20,6 +20,7 @@
 
 class hwsprites;
 class RenderBase;
+class EngineSnapshot;
 
 struct video_settings_t;
 
@@ -32,6 +33,9 @@ public:
 
     bool enabled;
 
+    // Set when draw_frame() found nothing had changed, and left the last frame on screen
+    bool static_frame;
+
 	Video();
     ~Video();
     
@@ -40,6 +44,9 @@ public:
     int set_video_mode(video_settings_t* settings);
     void draw_frame();
 
+    // Compose and present the next frame, even if nothing has changed
+    void force_redraw();
+
     void clear_text_ram();
     void write_text8(uint32_t, const uint8_t);
 	void write_text16(uint32_t*, const uint16_t);
@@ -47,6 +54,7 @@ public:
     void write_text32(uint32_t*, const uint32_t);
     void write_text32(uint32_t, const uint32_t);
     uint8_t read_text8(uint32_t);
+    void fill_text16(uint32_t, const uint16_t, const uint32_t);
 
     void clear_tile_ram();    
     void write_tile8(uint32_t, const uint8_t);
@@ -55,6 +63,8 @@ public:
     void write_tile32(uint32_t*, const uint32_t);
     void write_tile32(uint32_t, const uint32_t);
     uint8_t read_tile8(uint32_t);
+    void fill_tile16(uint32_t, const uint16_t, const uint32_t);
+    void fill_tile32(uint32_t, const uint32_t, const uint32_t);
 
 	void write_sprite16(uint32_t*, const uint16_t);
 
@@ -62,16 +72,46 @@ public:
 	void write_pal16(uint32_t*, const uint16_t);
 	void write_pal32(uint32_t*, const uint32_t);
 	void write_pal32(uint32_t, const uint32_t);
+    void copy_pal_rom(uint32_t, RomLoader*, uint32_t, const uint32_t);
 	uint8_t read_pal8(uint32_t);
 	uint16_t read_pal16(uint32_t*);
 	uint16_t read_pal16(uint32_t);
     uint32_t read_pal32(uint32_t*);
 
+    // Copy the palette out, or back in. Only entries that change are converted again.
+    void get_palette(uint16_t* dst);
+    void set_palette(const uint16_t* src);
+
+    void register_state(EngineSnapshot&);
+
+    // Offset from a palette index to its shadow or highlight colour, depending on the entry's highlight bit
+    inline uint16_t get_shadow_bank(const uint16_t index)
+    {
+        return shadow_bank[index & (S16_PALETTE_ENTRIES - 1)];
+    }
+
 private:
     // SDL Renderer
     RenderBase* renderer;
     
-	uint8_t palette[S16_PALETTE_ENTRIES * 2]; // 2 Bytes Per Palette Entry
+	uint16_t palette[S16_PALETTE_ENTRIES]; // Native-endian, 1 Word Per Palette Entry
+
+    // Shadow / highlight offset for each palette entry. Updated as the palette is written.
+    uint16_t shadow_bank[S16_PALETTE_ENTRIES];
+
+    // Bit set for each palette entry written since the last frame was drawn
+    uint32_t pal_dirty[S16_PALETTE_ENTRIES / 32];
+
+    // Palette and state when the last frame was composed
+    uint16_t last_palette[S16_PALETTE_ENTRIES];
+    bool last_enabled;
+    bool redraw;
+
+    bool frame_changed();
+
+    void mark_palette(uint32_t);
+    void mark_palette_all();
+    void flush_palette();
     void refresh_palette(uint32_t);
 };
 
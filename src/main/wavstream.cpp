@@ -0,0 +1,300 @@
+/***************************************************************************
+    Streaming WAV Playback.
+
+    Used for custom music. Rather than decoding the entire file up front,
+    the file is memory mapped and decoded on a background thread into a
+    small ring buffer. Format, channel and sample rate conversion happen
+    incrementally as the ring buffer is refilled.
+
+    Output is 16-bit stereo at half volume, looping at the end of the file.
+
+    Supports uncompressed PCM (8, 16, 24 and 32-bit) and 32-bit float.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#include <cstring>
+#include "wavstream.hpp"
+#include "hwaudio/mixer.hpp"
+
+#ifdef COMPILE_SOUND_CODE
+
+static inline uint16_t le16(const uint8_t* p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t le32(const uint8_t* p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+WavStream::WavStream()
+{
+    thread  = NULL;
+    lock    = NULL;
+    cond    = NULL;
+    running = false;
+    pcm     = NULL;
+    frames  = 0;
+}
+
+WavStream::~WavStream()
+{
+    close();
+}
+
+bool WavStream::open(const char* filename, uint32_t freq)
+{
+    close();
+
+    if (!file.open(filename))
+        return false;
+
+    if (!parse_header())
+    {
+        file.close();
+        return false;
+    }
+
+    step       = (uint32_t) (((uint64_t) rate << 16) / freq);
+    frame_pos  = 0;
+    frame_frac = 0;
+    read_pos   = 0;
+    write_pos  = 0;
+
+    // Prime the first block, so that playback can begin on the next frame
+    fill(BLOCK_SIZE);
+    write_pos = BLOCK_SIZE;
+
+    lock    = SDL_CreateMutex();
+    cond    = SDL_CreateCond();
+    running = true;
+
+#ifdef SDL2
+    thread = SDL_CreateThread(decode_thread, "wavstream", this);
+#else
+    thread = SDL_CreateThread(decode_thread, this);
+#endif
+
+    if (thread == NULL)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void WavStream::close()
+{
+    if (thread)
+    {
+        SDL_LockMutex(lock);
+        running = false;
+        SDL_CondSignal(cond);
+        SDL_UnlockMutex(lock);
+        SDL_WaitThread(thread, NULL);
+        thread = NULL;
+    }
+
+    if (cond)
+    {
+        SDL_DestroyCond(cond);
+        cond = NULL;
+    }
+
+    if (lock)
+    {
+        SDL_DestroyMutex(lock);
+        lock = NULL;
+    }
+
+    running = false;
+    pcm     = NULL;
+    frames  = 0;
+    file.close();
+}
+
+// Locate the format and data chunks of the RIFF file.
+bool WavStream::parse_header()
+{
+    const uint8_t* d = file.data;
+    const uint32_t size = file.size;
+
+    if (size < 12 || memcmp(d, "RIFF", 4) != 0 || memcmp(d + 8, "WAVE", 4) != 0)
+        return false;
+
+    uint32_t data_len = 0;
+    uint16_t bits     = 0;
+    bool found_fmt    = false;
+    pcm               = NULL;
+
+    for (uint32_t pos = 12; pos + 8 <= size;)
+    {
+        const uint32_t len  = le32(d + pos + 4);
+        const uint32_t body = pos + 8;
+
+        if (memcmp(d + pos, "fmt ", 4) == 0 && len >= 16 && body + len <= size)
+        {
+            format     = le16(d + body);
+            channels   = le16(d + body + 2);
+            rate       = le32(d + body + 4);
+            bits       = le16(d + body + 14);
+
+            // Extensible format: real format is the start of the sub-format GUID
+            if (format == FMT_EXTENSIBLE && len >= 26)
+                format = le16(d + body + 24);
+
+            found_fmt = true;
+        }
+        else if (memcmp(d + pos, "data", 4) == 0)
+        {
+            pcm      = d + body;
+            data_len = (len > size - body) ? size - body : len;
+        }
+
+        if (len > size - body)
+            break;
+        pos = body + len + (len & 1); // Chunks are word aligned
+    }
+
+    // Reject implausible channel counts from malformed headers
+    if (!found_fmt || pcm == NULL || channels == 0 || channels > MAX_CHANNELS || rate == 0)
+        return false;
+
+    bool supported = (format == FMT_PCM   && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) ||
+                     (format == FMT_FLOAT && bits == 32);
+    if (!supported)
+        return false;
+
+    bytes_per_sample = bits >> 3;
+    frame_bytes      = (uint32_t) bytes_per_sample * channels;
+    if (frame_bytes == 0)
+        return false;
+    frames           = data_len / frame_bytes;
+
+    return frames != 0;
+}
+
+// Read a single sample, converted to signed 16-bit range
+int32_t WavStream::read_sample(const uint8_t* p)
+{
+    if (format == FMT_FLOAT)
+    {
+        float f;
+        uint32_t v = le32(p);
+        memcpy(&f, &v, sizeof(f));
+        if (f >= 1.0f)  return 32767;
+        if (f <= -1.0f) return -32768;
+        return (int32_t) (f * 32767.0f);
+    }
+
+    switch (bytes_per_sample)
+    {
+        case 1:  return (p[0] - 0x80) * 256;
+        case 2:  return (int16_t) le16(p);
+        case 3:  return (int16_t) le16(p + 1);
+        default: return (int16_t) le16(p + 2);
+    }
+}
+
+void WavStream::read_frame(uint32_t frame, int32_t& l, int32_t& r)
+{
+    const uint8_t* p = pcm + (frame * frame_bytes);
+    l = read_sample(p);
+    r = channels > 1 ? read_sample(p + bytes_per_sample) : l;
+}
+
+// Decode 'length' output samples (stereo interleaved), resampling with linear interpolation.
+void WavStream::decode(int16_t* dst, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i += 2)
+    {
+        int32_t l, r;
+        read_frame(frame_pos, l, r);
+
+        if (frame_frac)
+        {
+            int32_t l1, r1;
+            read_frame(frame_pos + 1 < frames ? frame_pos + 1 : 0, l1, r1);
+            const int32_t f = frame_frac >> 1; // 15-bit fraction avoids overflow
+            l += ((l1 - l) * f) >> 15;
+            r += ((r1 - r) * f) >> 15;
+        }
+
+        // Halve volume of wav file
+        dst[i]     = l >> 1;
+        dst[i + 1] = r >> 1;
+
+        frame_frac += step;
+        frame_pos  += frame_frac >> 16;
+        frame_frac &= 0xFFFF;
+
+        // Loop wav files
+        while (frame_pos >= frames)
+            frame_pos -= frames;
+    }
+}
+
+// Decode into the free area of the ring buffer. Does not advance write_pos.
+void WavStream::fill(uint32_t length)
+{
+    const uint32_t idx   = write_pos & RING_MASK;
+    const uint32_t first = (length < RING_SIZE - idx) ? length : RING_SIZE - idx;
+
+    decode(ring + idx, first);
+    decode(ring, length - first);
+}
+
+int WavStream::decode_thread(void* data)
+{
+    WavStream* ws = (WavStream*) data;
+
+    SDL_LockMutex(ws->lock);
+    while (ws->running)
+    {
+        // Wait for space in the ring buffer
+        if (RING_SIZE - (ws->write_pos - ws->read_pos) < BLOCK_SIZE)
+        {
+            SDL_CondWaitTimeout(ws->cond, ws->lock, 100);
+            continue;
+        }
+
+        // The consumer never reads beyond write_pos, so decode without holding the lock
+        SDL_UnlockMutex(ws->lock);
+        ws->fill(BLOCK_SIZE);
+        SDL_LockMutex(ws->lock);
+        ws->write_pos += BLOCK_SIZE;
+    }
+    SDL_UnlockMutex(ws->lock);
+
+    return 0;
+}
+
+void WavStream::mix(int16_t* dst, uint32_t length)
+{
+    if (!is_open())
+        return;
+
+    SDL_LockMutex(lock);
+    uint32_t avail = write_pos - read_pos;
+    SDL_UnlockMutex(lock);
+
+    if (avail > length)
+        avail = length;
+
+    const uint32_t idx   = read_pos & RING_MASK;
+    const uint32_t first = (avail < RING_SIZE - idx) ? avail : RING_SIZE - idx;
+
+    Mixer::add(dst,         ring + idx, first,         Mixer::GAIN_UNITY);
+    Mixer::add(dst + first, ring,       avail - first, Mixer::GAIN_UNITY);
+
+    SDL_LockMutex(lock);
+    read_pos += avail;
+    SDL_CondSignal(cond);
+    SDL_UnlockMutex(lock);
+}
+
+#endif
@@ -0,0 +1,88 @@
+/***************************************************************************
+    Streaming WAV Playback.
+
+    Used for custom music. Rather than decoding the entire file up front,
+    the file is memory mapped and decoded on a background thread into a
+    small ring buffer. Format, channel and sample rate conversion happen
+    incrementally as the ring buffer is refilled.
+
+    Output is 16-bit stereo at half volume, looping at the end of the file.
+
+    Supports uncompressed PCM (8, 16, 24 and 32-bit) and 32-bit float.
+
+    Copyright Chris White.
+    See license.txt for more details.
+***************************************************************************/
+
+#pragma once
+
+#include "globals.hpp"
+
+#ifdef COMPILE_SOUND_CODE
+
+#include <SDL.h>
+#include "mappedfile.hpp"
+
+class WavStream
+{
+public:
+    WavStream();
+    ~WavStream();
+
+    bool open(const char* filename, uint32_t freq);
+    void close();
+    bool is_open() const { return thread != NULL; }
+
+    // Mix the next 'length' samples into dst. Underflow is treated as silence.
+    void mix(int16_t* dst, uint32_t length);
+
+private:
+    // Ring buffer size in samples. Must be a power of 2.
+    // 16384 samples is ~185ms of 44.1kHz stereo.
+    static const uint32_t RING_SIZE  = 1 << 14;
+    static const uint32_t RING_MASK  = RING_SIZE - 1;
+
+    // Number of samples the decoder produces at a time
+    static const uint32_t BLOCK_SIZE = 1 << 12;
+
+    enum { FMT_PCM = 1, FMT_FLOAT = 3, FMT_EXTENSIBLE = 0xFFFE };
+
+    // Most source channels accepted. Only the first two are played.
+    static const uint16_t MAX_CHANNELS = 8;
+
+    MappedFile file;
+
+    // Source format
+    const uint8_t* pcm;         // Start of sample data
+    uint32_t frames;            // Number of sample frames
+    uint32_t rate;              // Sample rate
+    uint16_t format;            // PCM or float
+    uint16_t channels;          // Source channels
+    uint16_t bytes_per_sample;  // Bytes per sample (per channel)
+    uint32_t frame_bytes;       // Bytes per sample frame (all channels)
+
+    // Resampling state (16.16 fixed point)
+    uint32_t step;
+    uint32_t frame_pos;
+    uint32_t frame_frac;
+
+    // Ring buffer. Positions increment freely and are masked on access.
+    int16_t ring[RING_SIZE];
+    uint32_t read_pos;
+    uint32_t write_pos;
+
+    // Decoder thread
+    SDL_Thread* thread;
+    SDL_mutex* lock;
+    SDL_cond* cond;
+    bool running;
+
+    bool parse_header();
+    void decode(int16_t* dst, uint32_t length);
+    int32_t read_sample(const uint8_t* p);
+    void read_frame(uint32_t frame, int32_t& l, int32_t& r);
+    void fill(uint32_t length);
+    static int decode_thread(void* data);
+};
+
+#endif